@@ -47,7 +47,11 @@
 
 #if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
     /*Size of the memory available for `lv_malloc()` in bytes (>= 2kB)*/
-    #define LV_MEM_SIZE (64 * 1024U)          /*[bytes]*/
+    #ifdef UI_SIMULATOR
+        #define LV_MEM_SIZE (256 * 1024U)     /*64 bit pointers make every object bigger on the host*/
+    #else
+        #define LV_MEM_SIZE (64 * 1024U)          /*[bytes]*/
+    #endif
 
     /*Size of the memory expand for `lv_malloc()` in bytes*/
     #define LV_MEM_POOL_EXPAND_SIZE 0
@@ -395,7 +399,11 @@
 #define LV_FONT_MONTSERRAT_18 0
 #define LV_FONT_MONTSERRAT_20 0
 #define LV_FONT_MONTSERRAT_22 0
-#define LV_FONT_MONTSERRAT_24 0
+#ifdef UI_SUBSET_FONTS
+    #define LV_FONT_MONTSERRAT_24 0
+#else
+    #define LV_FONT_MONTSERRAT_24 1
+#endif
 #define LV_FONT_MONTSERRAT_26 0
 #define LV_FONT_MONTSERRAT_28 0
 #define LV_FONT_MONTSERRAT_30 0
@@ -407,7 +415,11 @@
 #define LV_FONT_MONTSERRAT_42 0
 #define LV_FONT_MONTSERRAT_44 0
 #define LV_FONT_MONTSERRAT_46 0
-#define LV_FONT_MONTSERRAT_48 1
+#ifdef UI_SUBSET_FONTS
+    #define LV_FONT_MONTSERRAT_48 0   /*The big clock uses the generated subset in src/fonts*/
+#else
+    #define LV_FONT_MONTSERRAT_48 1
+#endif
 /*Demonstrate special features*/
 #define LV_FONT_MONTSERRAT_28_COMPRESSED 0  /*bpp = 3*/
 #define LV_FONT_DEJAVU_16_PERSIAN_HEBREW 0  /*Hebrew, Arabic, Persian letters and all their forms*/
@@ -431,7 +443,11 @@
 #define LV_FONT_FMT_TXT_LARGE 0
 
 /*Enables/disables support for compressed fonts.*/
-#define LV_USE_FONT_COMPRESSED 0
+#ifdef UI_SUBSET_FONTS
+    #define LV_USE_FONT_COMPRESSED 1   /*font_airport_14*/
+#else
+    #define LV_USE_FONT_COMPRESSED 0
+#endif
 
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
@@ -743,7 +759,11 @@
  *==================*/
 
 /*1: Enable API to take snapshot for object*/
-#define LV_USE_SNAPSHOT 0
+#ifdef UI_STATIC_CARD_LAYERS
+    #define LV_USE_SNAPSHOT 1   /*Renders the cached card backgrounds*/
+#else
+    #define LV_USE_SNAPSHOT 0
+#endif
 
 /*1: Enable system monitor component*/
 #define LV_USE_SYSMON   0
@@ -0,0 +1,235 @@
+// Hardware independent helpers, see calc.h
+#include "calc.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <cmath>
+
+#ifndef DEG_TO_RAD
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#endif
+
+// Trim whitespace from string in-place
+void trim(char *str) {
+  char *start = str;
+  while (isspace((unsigned char)*start)) start++;
+  size_t len = strlen(start);
+  while (len > 0 && isspace((unsigned char)start[len - 1])) len--;
+  start[len] = '\0';
+  memmove(str, start, len + 1);
+}
+
+// ASCII transliteration of U+00A0..U+017F (Latin-1 Supplement and Latin Extended-A), never longer than
+// the two byte UTF-8 sequence it replaces. nullptr keeps the character, the built-in fonts have a glyph for it.
+static constexpr const char *LATIN_TO_ASCII[0x180 - 0xA0] = {
+    " ", "!", "c", "L", "", "Y", "|", "S", "\"", "c", "a", "<<", "-", "", "R", "-",  // U+00A0
+    nullptr, "+-", "2", "3", "'", "u", "P", ".", ",", "1", "o", ">>", "", "", "", "?",  // U+00B0
+    "A", "A", "A", "A", "A", "A", "AE", "C", "E", "E", "E", "E", "I", "I", "I", "I",  // U+00C0
+    "D", "N", "O", "O", "O", "O", "O", "x", "O", "U", "U", "U", "U", "Y", "TH", "ss",  // U+00D0
+    "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",  // U+00E0
+    "d", "n", "o", "o", "o", "o", "o", "/", "o", "u", "u", "u", "u", "y", "th", "y",  // U+00F0
+    "A", "a", "A", "a", "A", "a", "C", "c", "C", "c", "C", "c", "C", "c", "D", "d",  // U+0100
+    "D", "d", "E", "e", "E", "e", "E", "e", "E", "e", "E", "e", "G", "g", "G", "g",  // U+0110
+    "G", "g", "G", "g", "H", "h", "H", "h", "I", "i", "I", "i", "I", "i", "I", "i",  // U+0120
+    "I", "i", "IJ", "ij", "J", "j", "K", "k", "k", "L", "l", "L", "l", "L", "l", "L",  // U+0130
+    "l", "L", "l", "N", "n", "N", "n", "N", "n", "'n", "N", "n", "O", "o", "O", "o",  // U+0140
+    "O", "o", "OE", "oe", "R", "r", "R", "r", "R", "r", "S", "s", "S", "s", "S", "s",  // U+0150
+    "S", "s", "T", "t", "T", "t", "T", "t", "U", "u", "U", "u", "U", "u", "U", "u",  // U+0160
+    "U", "u", "U", "u", "W", "w", "Y", "y", "Y", "Z", "z", "Z", "z", "Z", "z", "s",  // U+0170
+};
+
+// Normalize string by replacing accented characters in-place, one pass over the UTF-8 input
+char *normalizeString(char *str) {
+  char *out = str;
+  for (const unsigned char *p = (const unsigned char *)str; *p;) {
+    if (*p < 0x80) {
+      *out++ = *p++;
+      continue;
+    }
+    int len = *p >= 0xF0 ? 4 : *p >= 0xE0 ? 3 : *p >= 0xC0 ? 2 : 1;
+    unsigned long codepoint = *p & (0x7F >> len);
+    int i = 1;
+    for (; i < len && (p[i] & 0xC0) == 0x80; i++) codepoint = (codepoint << 6) | (p[i] & 0x3F);
+    if (len == 1 || i < len) {  // Invalid sequence, copy the byte as is
+      *out++ = *p++;
+      continue;
+    }
+    const char *ascii = nullptr;
+    if (codepoint >= 0xA0 && codepoint < 0x180)
+      ascii = LATIN_TO_ASCII[codepoint - 0xA0];
+    else if (codepoint >= 0x218 && codepoint <= 0x21B)  // Romanian S and T with comma below
+      ascii = &"S\0s\0T\0t"[2 * (codepoint - 0x218)];
+    else if (codepoint == 0x1E9E)  // Capital sharp S
+      ascii = "SS";
+    else if (codepoint == 0x2013 || codepoint == 0x2014)  // En and em dash
+      ascii = "-";
+    else if (codepoint == 0x2018 || codepoint == 0x2019)  // Typographic single quotes
+      ascii = "'";
+    if (ascii) {
+      while (*ascii) *out++ = *ascii++;
+      p += len;
+    } else
+      for (i = 0; i < len; i++) *out++ = *p++;
+  }
+  *out = '\0';
+  return str;
+}
+
+void getFormattedDate(unsigned long epoch, char *buffer, size_t size) {
+  int year;
+  unsigned month, day;
+  civilFromDays(epoch / 86400L, year, month, day);
+  snprintf(buffer, size, "%02u.%02u.%04d", day, month, year);
+}
+
+void getFormattedTime(unsigned long epoch, char *buffer, size_t size) {
+  unsigned long timeSeconds = epoch % 86400;
+  snprintf(buffer, size, "%02u:%02u:%02u", (unsigned)(timeSeconds / 3600), (unsigned)((timeSeconds % 3600) / 60), (unsigned)(timeSeconds % 60));
+}
+
+int sunEventHours(long day, float lat, float lon, bool isRise, double zenith, double &utcHours) {
+  int year;
+  unsigned month, dayOfMonth;
+  civilFromDays(day, year, month, dayOfMonth);
+  int n1 = floor(275 * (int)month / 9);
+  int n2 = floor(((int)month + 9) / 12);
+  int n3 = (1 + floor((year - 4 * floor(year / 4) + 2) / 3));
+  int n = n1 - (n2 * n3) + (int)dayOfMonth - 30;
+  double lngHour = lon / 15.0;
+  double approxTime = isRise ? n + ((6 - lngHour) / 24.0) : n + ((18 - lngHour) / 24.0);
+  double meanAnomaly = (0.9856 * approxTime) - 3.289;
+  double trueLong = meanAnomaly + (1.916 * sin(DEG_TO_RAD * meanAnomaly)) + (0.020 * sin(2 * DEG_TO_RAD * meanAnomaly)) + 282.634;
+  if (trueLong >= 360.0) trueLong -= 360.0;
+  if (trueLong < 0.0) trueLong += 360.0;
+  double rightAsc = RAD_TO_DEG * atan(0.91764 * tan(DEG_TO_RAD * trueLong));
+  if (rightAsc < 0.0) rightAsc += 360.0;
+  if (rightAsc >= 360.0) rightAsc -= 360.0;
+  double lQuadrant = floor(trueLong / 90.0) * 90.0;
+  double raQuadrant = floor(rightAsc / 90.0) * 90.0;
+  rightAsc = rightAsc + (lQuadrant - raQuadrant);
+  rightAsc /= 15.0;
+  double sinDec = 0.39782 * sin(DEG_TO_RAD * trueLong);
+  double cosDec = cos(asin(sinDec));
+  double cosH = (cos(DEG_TO_RAD * zenith) - (sinDec * sin(DEG_TO_RAD * lat))) / (cosDec * cos(DEG_TO_RAD * lat));
+  if (cosH > 1) return SUN_ALWAYS_BELOW;
+  if (cosH < -1) return SUN_ALWAYS_ABOVE;
+  double hourAngle = isRise ? 360.0 - RAD_TO_DEG * acos(cosH) : RAD_TO_DEG * acos(cosH);
+  hourAngle /= 15.0;
+  double localMeanTime = hourAngle + rightAsc - (0.06571 * approxTime) - 6.622;
+  while (localMeanTime < 0) localMeanTime += 24.0;
+  while (localMeanTime >= 24) localMeanTime -= 24.0;
+  utcHours = localMeanTime - lngHour;
+  return SUN_EVENT_OK;
+}
+
+void sunEvent(unsigned long timeStamp, float lat, float lon, bool isRise, long timeOffset, char *result, size_t resultSize) {
+  double utcTime;
+  int status = sunEventHours(timeStamp / 86400, lat, lon, isRise, SUN_ZENITH_OFFICIAL, utcTime);
+  if (status == SUN_ALWAYS_BELOW) {
+    snprintf(result, resultSize, "No sunrise");
+    return;
+  }
+  if (status == SUN_ALWAYS_ABOVE) {
+    snprintf(result, resultSize, "No sunset");
+    return;
+  }
+  while (utcTime < 0) utcTime += 24.0;
+  while (utcTime >= 24) utcTime -= 24.0;
+  unsigned long eventSec = (unsigned long)(utcTime * 3600);
+  if (timeOffset != 0) {
+    long eventLocal = (long)eventSec + (timeOffset % 86400);
+    if (eventLocal < 0) eventLocal += 86400;
+    if (eventLocal >= 86400) eventLocal -= 86400;
+    eventSec = (unsigned long)eventLocal;
+  }
+  snprintf(result, resultSize, "%02u:%02u:%02u", (unsigned)(eventSec / 3600), (unsigned)((eventSec % 3600) / 60), (unsigned)(eventSec % 60));
+}
+
+int relativeHumidity(int temperature, int dewPoint) {
+  float t = temperature, d = dewPoint;
+  return 100 * exp((17.625 * d) / (243.04 + d)) / exp((17.625 * t) / (243.04 + t));
+}
+
+long daysFromCivil(int year, unsigned month, unsigned day) {
+  // Howard Hinnant's days_from_civil, constant time for any year
+  year -= month <= 2;
+  const long era = (year >= 0 ? year : year - 399) / 400;
+  const unsigned yoe = (unsigned)(year - era * 400);                            // [0, 399]
+  const unsigned doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;  // [0, 365]
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;                   // [0, 146096]
+  return era * 146097 + (long)doe - 719468;
+}
+
+void civilFromDays(long days, int &year, unsigned &month, unsigned &day) {
+  // Howard Hinnant's civil_from_days, inverse of daysFromCivil
+  days += 719468;
+  const long era = (days >= 0 ? days : days - 146096) / 146097;
+  const unsigned doe = (unsigned)(days - era * 146097);                     // [0, 146096]
+  const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;  // [0, 399]
+  const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);              // [0, 365]
+  const unsigned mp = (5 * doy + 2) / 153;                                   // [0, 11]
+  day = doy - (153 * mp + 2) / 5 + 1;
+  month = mp < 10 ? mp + 3 : mp - 9;
+  year = (int)(yoe + era * 400) + (month <= 2);
+}
+
+bool parseIsoUtc(const char *text, unsigned long &epoch) {
+  int year, month, day, hour, minute, second;
+  if (!text || sscanf(text, "%d-%d-%dT%d:%d:%d", &year, &month, &day, &hour, &minute, &second) != 6) return false;
+  if (year < 1970 || month < 1 || month > 12 || day < 1 || day > 31) return false;
+  epoch = (unsigned long)daysFromCivil(year, month, day) * 86400UL + hour * 3600UL + minute * 60UL + second;
+  return true;
+}
+
+int normalizeStationList(char *list, int maxIds) {
+  char *out = list;
+  int count = 0;
+  for (const char *p = list; *p && count < maxIds;) {
+    if (!isalnum((unsigned char)*p)) {
+      p++;
+      continue;
+    }
+    const char *start = p;
+    while (isalnum((unsigned char)*p)) p++;
+    if (p - start != 4) continue;  // Not an ICAO ID
+    if (count) *out++ = ',';
+    for (int i = 0; i < 4; i++) *out++ = toupper((unsigned char)start[i]);
+    count++;
+  }
+  *out = '\0';
+  return count;
+}
+
+int updateClockText(ClockText &clock, unsigned long epoch) {
+  int changed = 0;
+  long day = epoch / 86400;
+  if (day != clock.day) {
+    getFormattedDate(epoch, clock.date, sizeof(clock.date));
+    clock.day = day;
+    changed |= CLOCK_DATE_CHANGED;
+  }
+  long minute = epoch / 60;
+  if (minute != clock.minute) {
+    unsigned minuteOfDay = (epoch % 86400) / 60;
+    clock.time[0] = '0' + minuteOfDay / 600;
+    clock.time[1] = '0' + minuteOfDay / 60 % 10;
+    clock.time[3] = '0' + minuteOfDay % 60 / 10;
+    clock.time[4] = '0' + minuteOfDay % 10;
+    clock.minute = minute;
+    changed |= CLOCK_MINUTE_CHANGED;
+  }
+  unsigned second = epoch % 60;
+  char tens = '0' + second / 10, ones = '0' + second % 10;
+  if (clock.time[6] != tens || clock.time[7] != ones || changed) {
+    clock.time[6] = tens;
+    clock.time[7] = ones;
+    changed |= CLOCK_SECOND_CHANGED;
+  }
+  return changed;
+}
@@ -0,0 +1,61 @@
+// Hardware independent helpers: string handling, date and time formatting, sun events and humidity.
+// Nothing in here may depend on Arduino, WiFi or LVGL so it also compiles for the host.
+#pragma once
+
+#include <stddef.h>
+
+// Trim whitespace from string in-place
+void trim(char *str);
+
+// Normalize string in-place: Latin-1, Latin Extended-A and the Romanian letters become ASCII, other characters are kept
+char *normalizeString(char *str);
+
+// Format epoch seconds as "DD.MM.YYYY"
+void getFormattedDate(unsigned long epoch, char *buffer, size_t size);
+
+// Format epoch seconds as "HH:MM:SS"
+void getFormattedTime(unsigned long epoch, char *buffer, size_t size);
+
+// Clock and date text that is reformatted only in the fields that rolled over since the last update
+struct ClockText {
+  char time[9] = "--:--:--";
+  char date[11] = "--.--.----";
+  long day = -1;     // Days since 1970-01-01 of date
+  long minute = -1;  // Minutes since 1970-01-01 of time without the seconds
+};
+
+enum ClockChange { CLOCK_SECOND_CHANGED = 1, CLOCK_MINUTE_CHANGED = 2, CLOCK_DATE_CHANGED = 4 };
+
+// Bring the clock text to epoch, returns the ClockChange flags of the fields that were rewritten
+int updateClockText(ClockText &clock, unsigned long epoch);
+
+// Zenith angles of the sun for sunrise/sunset and the end of civil, nautical and astronomical twilight
+constexpr double SUN_ZENITH_OFFICIAL = 90.833;
+constexpr double SUN_ZENITH_CIVIL = 96.0;
+constexpr double SUN_ZENITH_NAUTICAL = 102.0;
+constexpr double SUN_ZENITH_ASTRONOMICAL = 108.0;
+
+enum SunEventResult { SUN_EVENT_OK = 0, SUN_ALWAYS_BELOW = 1, SUN_ALWAYS_ABOVE = -1 };
+
+// Time the sun crosses the zenith angle rising or setting on the local solar day `day` (days since 1970-01-01),
+// in hours UTC from the start of that day (may be negative or beyond 24). Returns a SunEventResult.
+int sunEventHours(long day, float lat, float lon, bool isRise, double zenith, double &utcHours);
+
+// Sunrise or sunset of the day containing timeStamp, formatted as "HH:MM:SS" local time
+void sunEvent(unsigned long timeStamp, float lat, float lon, bool isRise, long timeOffset, char *result, size_t resultSize);
+
+// Relative humidity in percent from temperature and dew point in °C (Magnus formula)
+int relativeHumidity(int temperature, int dewPoint);
+
+// Days since 1970-01-01 of a proleptic Gregorian date (month 1..12, day 1..31)
+long daysFromCivil(int year, unsigned month, unsigned day);
+
+// Proleptic Gregorian date of a day count since 1970-01-01
+void civilFromDays(long days, int &year, unsigned &month, unsigned &day);
+
+// Parse an ISO 8601 UTC timestamp like "2024-10-27T01:00:00Z" into epoch seconds
+bool parseIsoUtc(const char *text, unsigned long &epoch);
+
+// Rewrite a user entered list of ICAO IDs in-place as "AAAA,BBBB,...": upper case, 4 characters each,
+// separated by anything that is not a letter or digit. Returns the number of IDs kept (at most maxIds).
+int normalizeStationList(char *list, int maxIds);
@@ -0,0 +1,123 @@
+// Static card layers, see card_layers.h
+#ifdef UI_STATIC_CARD_LAYERS
+
+#include "card_layers.h"
+
+#include <stdlib.h>
+#ifdef ESP_PLATFORM
+#include <esp_heap_caps.h>
+#endif
+
+#include "theme.h"
+
+#define MAX_CARD_LAYERS 16
+
+struct CardLayer {
+  lv_obj_t *card = nullptr;
+  lv_obj_t *image = nullptr;  // Sibling of the card, behind all cards of the screen
+  lv_draw_buf_t buffer;
+  void *data = nullptr;
+  uint32_t dataSize = 0;
+  bool renderQueued = false;  // An async render after a size change is pending
+};
+
+CardLayerStats cardLayerStats;
+
+static CardLayer cardLayers[MAX_CARD_LAYERS];
+static int cardLayerCount = 0;
+static lv_style_t transparentCard;  // Added on top of theme.card once the layer shows the background
+
+// Layer buffers are big (ARGB8888 of the card plus its shadow), they go to PSRAM
+static void *layerAlloc(size_t size) {
+#ifdef ESP_PLATFORM
+  return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+  return malloc(size);
+#endif
+}
+
+// Snapshot the card without its children and place the image where the card (and its shadow) is
+static bool cardLayerRender(CardLayer &layer) {
+  lv_obj_t *card = layer.card;
+  lv_obj_remove_style(card, &transparentCard, LV_PART_MAIN);
+  lv_obj_update_layout(card);
+  int32_t ext = lv_obj_get_ext_draw_size(card);
+  uint32_t w = lv_obj_get_width(card) + 2 * ext;
+  uint32_t h = lv_obj_get_height(card) + 2 * ext;
+  uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_ARGB8888);
+  uint32_t size = stride * h;
+  if (size > layer.dataSize) {
+    free(layer.data);  // heap_caps_malloc memory is released with free() as well
+    cardLayerStats.bytes -= layer.dataSize;
+    layer.data = layerAlloc(size);
+    layer.dataSize = layer.data ? size : 0;
+    cardLayerStats.bytes += layer.dataSize;
+  }
+  if (!layer.data) return false;
+  cardLayerStats.renders++;
+  lv_draw_buf_init(&layer.buffer, w, h, LV_COLOR_FORMAT_ARGB8888, stride, layer.data, size);
+
+  // Only the background goes into the layer, the children stay live objects
+  uint32_t childCount = lv_obj_get_child_count(card);
+  bool wasHidden[32];
+  for (uint32_t i = 0; i < childCount && i < 32; i++) {
+    lv_obj_t *child = lv_obj_get_child(card, i);
+    wasHidden[i] = lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(child, LV_OBJ_FLAG_HIDDEN);
+  }
+  lv_result_t result = lv_snapshot_take_to_draw_buf(card, LV_COLOR_FORMAT_ARGB8888, &layer.buffer);
+  for (uint32_t i = 0; i < childCount && i < 32; i++)
+    if (!wasHidden[i]) lv_obj_remove_flag(lv_obj_get_child(card, i), LV_OBJ_FLAG_HIDDEN);
+  if (result != LV_RESULT_OK) return false;
+
+  if (!layer.image) {
+    layer.image = lv_image_create(lv_obj_get_parent(card));
+    lv_obj_remove_flag(layer.image, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_move_background(layer.image);
+  }
+  lv_image_set_src(layer.image, &layer.buffer);
+  lv_obj_set_pos(layer.image, lv_obj_get_x(card) - ext, lv_obj_get_y(card) - ext);
+  lv_obj_add_style(card, &transparentCard, LV_PART_MAIN);
+  lv_obj_invalidate(layer.image);
+  return true;
+}
+
+static void cardLayerRenderAsync(void *data) {
+  CardLayer &layer = *(CardLayer *)data;
+  layer.renderQueued = false;
+  cardLayerRender(layer);
+}
+
+// A new size is a new layout, the layer is rendered again. Not from inside the event: LV_EVENT_SIZE_CHANGED is sent
+// by the layout pass, and the snapshot would run the layout again from within it.
+static void cardSizeChangedEvent(lv_event_t *e) {
+  CardLayer &layer = *(CardLayer *)lv_event_get_user_data(e);
+  if (layer.renderQueued) return;
+  layer.renderQueued = true;
+  lv_async_call(cardLayerRenderAsync, &layer);
+}
+
+void cardLayerCreate(lv_obj_t *card) {
+  if (cardLayerCount == 0) {
+    lv_style_init(&transparentCard);
+    lv_style_set_bg_opa(&transparentCard, LV_OPA_TRANSP);
+    lv_style_set_border_opa(&transparentCard, LV_OPA_TRANSP);  // The width stays, it is part of the content area
+    lv_style_set_shadow_width(&transparentCard, 0);
+  }
+  if (cardLayerCount == MAX_CARD_LAYERS) return;
+  CardLayer &layer = cardLayers[cardLayerCount];
+  layer.card = card;
+  if (!cardLayerRender(layer)) {
+    lv_obj_remove_style(card, &transparentCard, LV_PART_MAIN);
+    return;
+  }
+  cardLayerCount++;
+  cardLayerStats.layers = cardLayerCount;
+  lv_obj_add_event_cb(card, cardSizeChangedEvent, LV_EVENT_SIZE_CHANGED, &layer);
+}
+
+void cardLayersInvalidate() {
+  for (int i = 0; i < cardLayerCount; i++) cardLayerRender(cardLayers[i]);
+}
+
+#endif
@@ -0,0 +1,30 @@
+// Static card layers, only compiled with -D UI_STATIC_CARD_LAYERS.
+// The background of each card (gradient, border, radius, shadow) is rendered once into an image buffer
+// in PSRAM and shown by an image behind the now transparent card, so a label update on the card only
+// re-renders text on top of a blit instead of rasterizing the card again.
+#pragma once
+
+#ifdef UI_STATIC_CARD_LAYERS
+
+#if defined(ESP_PLATFORM) && !defined(BOARD_HAS_PSRAM)
+#error "UI_STATIC_CARD_LAYERS needs PSRAM for the layer buffers"
+#endif
+
+#include <lvgl.h>
+
+// Render the background of the card into a cached layer, the card keeps drawing itself if that fails
+void cardLayerCreate(lv_obj_t *card);
+
+// Render all cached layers again, after a theme change. A card that changes size re-renders its own layer.
+void cardLayersInvalidate();
+
+// Layer buffers are ARGB8888 of the card and its shadow, close to a whole screen per screen of cards:
+// about 1.4 MB of PSRAM for the main screen on 800x480
+struct CardLayerStats {
+  uint32_t layers = 0;   // Cards with a cached background
+  uint32_t bytes = 0;    // Layer buffers allocated
+  uint32_t renders = 0;  // Snapshots taken since boot, the first of each card included
+};
+extern CardLayerStats cardLayerStats;
+
+#endif
@@ -0,0 +1,69 @@
+// Chunked transfer coding, see chunked.h
+#include "chunked.h"
+
+static int hexDigit(uint8_t c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// CR LF after the size and its extensions: data follows, or the trailers after the last chunk
+static void endSizeLine(ChunkedDecoder &d) {
+  if (!d.sizeDigits)
+    d.state = CHUNKED_ERROR;
+  else if (d.chunkLeft)
+    d.state = CHUNKED_DATA;
+  else {
+    d.state = CHUNKED_TRAILER;
+    d.lineEmpty = true;
+  }
+}
+
+void chunkedFrame(ChunkedDecoder &d, uint8_t c) {
+  switch (d.state) {
+    case CHUNKED_SIZE: {
+      int digit = hexDigit(c);
+      if (digit >= 0) {
+        // More than 256 MB is not a response for this station
+        if (d.chunkLeft >> 24) {
+          d.state = CHUNKED_ERROR;
+          return;
+        }
+        d.chunkLeft = d.chunkLeft << 4 | digit;
+        d.sizeDigits = true;
+      } else if (c == '\n') {
+        endSizeLine(d);
+      } else if (c == ';' || c == ' ' || c == '\t' || c == '\r') {
+        d.state = d.sizeDigits ? CHUNKED_EXTENSION : CHUNKED_ERROR;
+      } else {
+        d.state = CHUNKED_ERROR;
+      }
+      break;
+    }
+    case CHUNKED_EXTENSION:
+      if (c == '\n') endSizeLine(d);
+      break;
+    case CHUNKED_DATA_END:
+      // CR LF after the data, the next size line starts
+      if (c == '\n') {
+        d.state = CHUNKED_SIZE;
+        d.sizeDigits = false;
+        d.chunkLeft = 0;
+      } else if (c != '\r') {
+        d.state = CHUNKED_ERROR;
+      }
+      break;
+    case CHUNKED_TRAILER:
+      // Header lines, an empty line ends the body
+      if (c == '\n') {
+        if (d.lineEmpty) d.state = CHUNKED_DONE;
+        d.lineEmpty = true;
+      } else if (c != '\r') {
+        d.lineEmpty = false;
+      }
+      break;
+    default:
+      break;
+  }
+}
@@ -0,0 +1,24 @@
+// Decoder of the chunked transfer coding of HTTP/1.1 (RFC 9112 7.1), one byte at a time, so a response can be read
+// straight off the socket and the connection stays usable for the next request. Plain state, no buffer: the framing
+// bytes go through chunkedFrame() until the state is CHUNKED_DATA, then chunkLeft data bytes follow.
+#pragma once
+
+#include <stdint.h>
+
+enum ChunkedState { CHUNKED_SIZE, CHUNKED_EXTENSION, CHUNKED_DATA, CHUNKED_DATA_END, CHUNKED_TRAILER, CHUNKED_DONE, CHUNKED_ERROR };
+
+struct ChunkedDecoder {
+  uint8_t state = CHUNKED_SIZE;  // ChunkedState
+  bool sizeDigits = false;       // The size line has at least one hex digit
+  bool lineEmpty = true;         // Trailer line without any byte before its CR LF
+  uint32_t chunkLeft = 0;        // Size of the chunk, then its data bytes not read yet
+};
+
+// One byte of the framing, never called in CHUNKED_DATA. CHUNKED_DONE after the last chunk and its trailers,
+// CHUNKED_ERROR if the framing is broken.
+void chunkedFrame(ChunkedDecoder &decoder, uint8_t c);
+
+// One data byte was read
+inline void chunkedData(ChunkedDecoder &decoder) {
+  if (--decoder.chunkLeft == 0) decoder.state = CHUNKED_DATA_END;
+}
@@ -0,0 +1,57 @@
+// Versioned settings record, see config_record.h
+#include "config_record.h"
+
+#include <string.h>
+
+static_assert(sizeof(ConfigRecord) == offsetof(ConfigRecord, crc) + sizeof(uint32_t), "ConfigRecord must not be padded");
+
+// CRC-32 of zlib (IEEE 802.3). Bitwise, the record is only checked at boot and sealed on Save.
+static uint32_t crc32(const void *data, size_t len) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint32_t crc = 0xffffffff;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= bytes[i];
+    for (int bit = 0; bit < 8; bit++) crc = crc & 1 ? (crc >> 1) ^ 0xedb88320 : crc >> 1;
+  }
+  return ~crc;
+}
+
+void configRecordSeal(ConfigRecord &record) {
+  record.version = CONFIG_RECORD_VERSION;
+  record.crc = crc32(&record, offsetof(ConfigRecord, crc));
+}
+
+ConfigRecordStatus configRecordCheck(const ConfigRecord &record, size_t len) {
+  if (!len) return CONFIG_RECORD_MISSING;
+  if (len != sizeof(ConfigRecord)) return CONFIG_RECORD_BAD_SIZE;
+  if (record.crc != crc32(&record, offsetof(ConfigRecord, crc))) return CONFIG_RECORD_BAD_CRC;
+  if (record.version != CONFIG_RECORD_VERSION) return CONFIG_RECORD_BAD_VERSION;
+  return CONFIG_RECORD_OK;
+}
+
+bool configRecordSameSettings(const ConfigRecord &a, const ConfigRecord &b) {
+  return strncmp(a.ssid, b.ssid, sizeof(a.ssid)) == 0 && strncmp(a.password, b.password, sizeof(a.password)) == 0 &&
+         strncmp(a.metarId, b.metarId, sizeof(a.metarId)) == 0 && a.timeOffset == b.timeOffset && a.flags == b.flags &&
+         memcmp(a.spare, b.spare, sizeof(a.spare)) == 0;
+}
+
+bool configRecordMigrate(ConfigRecord &record, const ConfigKeys &keys) {
+  if (!keys.present) return false;
+  static_assert(sizeof(keys.ssid) == sizeof(record.ssid) && sizeof(keys.password) == sizeof(record.password) &&
+                    sizeof(keys.metarId) == sizeof(record.metarId),
+                "ConfigKeys and ConfigRecord strings differ in size");
+  // The keys were read into fixed buffers, they end at the last byte at the latest
+  memcpy(record.ssid, keys.ssid, sizeof(record.ssid));
+  record.ssid[sizeof(record.ssid) - 1] = '\0';
+  memcpy(record.password, keys.password, sizeof(record.password));
+  record.password[sizeof(record.password) - 1] = '\0';
+  memcpy(record.metarId, keys.metarId, sizeof(record.metarId));
+  record.metarId[sizeof(record.metarId) - 1] = '\0';
+  record.timeOffset = keys.timeOffset;
+  return true;
+}
+
+const char *configRecordStatusName(ConfigRecordStatus status) {
+  static const char *names[] = {"ok", "missing", "bad size", "bad version", "bad CRC"};
+  return names[status];
+}
@@ -0,0 +1,52 @@
+// Settings as one versioned NVS record: fixed layout, a CRC-32 over it and a write counter.
+// Loaded with a single read at boot and written only if a setting changed, so pressing Save without a change
+// does not wear the flash. Older firmware kept each setting in its own key, those are migrated once.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CONFIG_RECORD_VERSION 1
+#define CONFIG_RECORD_KEY "settings"  // NVS key in the "config" namespace
+
+// No padding, the CRC covers every byte before it
+struct ConfigRecord {
+  uint8_t version = CONFIG_RECORD_VERSION;
+  uint8_t flags = 0;        // Unused, 0
+  uint16_t reserved = 0;
+  uint32_t writeCount = 0;  // Times the record was written to flash, counted over the lifetime of the device
+  char ssid[64] = {0};
+  char password[64] = {0};
+  char metarId[100] = {0};
+  int32_t timeOffset = 0;
+  // Room for later settings (station rotation, polling and display tuning) without a new record layout.
+  // A new setting takes its bytes from here, 0 has to be its default so records written before stay valid.
+  uint8_t spare[64] = {0};
+  uint32_t crc = 0;
+};
+
+enum ConfigRecordStatus { CONFIG_RECORD_OK, CONFIG_RECORD_MISSING, CONFIG_RECORD_BAD_SIZE, CONFIG_RECORD_BAD_VERSION, CONFIG_RECORD_BAD_CRC };
+
+// Set version and CRC before the record is written
+void configRecordSeal(ConfigRecord &record);
+
+// Check a record read back with len bytes
+ConfigRecordStatus configRecordCheck(const ConfigRecord &record, size_t len);
+
+// Same settings, the version, counter and CRC are not compared
+bool configRecordSameSettings(const ConfigRecord &a, const ConfigRecord &b);
+
+// Settings of firmware before the record, one NVS key each
+struct ConfigKeys {
+  bool present = false;  // The "ssid" or the "metar_id" key exists
+  char ssid[64] = {0};
+  char password[64] = {0};
+  char metarId[100] = {0};
+  int32_t timeOffset = 0;
+};
+
+// Take the old keys into the settings of record, its write counter goes on. False if there are no keys to migrate.
+bool configRecordMigrate(ConfigRecord &record, const ConfigKeys &keys);
+
+// "ok", "missing", ... for the log
+const char *configRecordStatusName(ConfigRecordStatus status);
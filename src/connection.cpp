@@ -0,0 +1,108 @@
+// Persistent HTTPS connections, see connection.h
+#include "connection.h"
+
+#include <string.h>
+
+#ifndef MBEDTLS_PRIVATE
+#define MBEDTLS_PRIVATE(member) member  // mbedtls 2, the fields of mbedtls 3 are behind this macro
+#endif
+
+// WiFiClientSecure sets up the TLS context and runs the handshake in one call. Linked with
+// -Wl,--wrap=mbedtls_ssl_setup, the session to resume is set in between. Only the network task connects.
+static mbedtls_ssl_session *resumeSession = nullptr;
+
+extern "C" int __real_mbedtls_ssl_setup(mbedtls_ssl_context *ssl, const mbedtls_ssl_config *conf);
+
+extern "C" int __wrap_mbedtls_ssl_setup(mbedtls_ssl_context *ssl, const mbedtls_ssl_config *conf) {
+  int ret = __real_mbedtls_ssl_setup(ssl, conf);
+  if (ret == 0 && resumeSession && mbedtls_ssl_set_session(ssl, resumeSession) != 0) log_i("TLS session not offered for resumption");
+  return ret;
+}
+
+// After a new connection: keep its session for the next one. Returns true if the server resumed the session that
+// was offered, it then answers with the same session ID (RFC 5246 7.4.1.3, RFC 5077 3.4 for tickets).
+static bool saveSession(HostConnection &conn) {
+  mbedtls_ssl_context *ssl = conn.client.ssl();
+  if (!ssl) return false;
+  unsigned char offeredId[sizeof(conn.session.MBEDTLS_PRIVATE(id))];
+  size_t offeredLen = conn.sessionSaved ? conn.session.MBEDTLS_PRIVATE(id_len) : 0;
+  memcpy(offeredId, conn.session.MBEDTLS_PRIVATE(id), offeredLen);
+  mbedtls_ssl_session_free(&conn.session);
+  mbedtls_ssl_session_init(&conn.session);
+  conn.sessionSaved = mbedtls_ssl_get_session(ssl, &conn.session) == 0;
+  return conn.sessionSaved && offeredLen && conn.session.MBEDTLS_PRIVATE(id_len) == offeredLen &&
+         memcmp(conn.session.MBEDTLS_PRIVATE(id), offeredId, offeredLen) == 0;
+}
+
+// HostConnection as the transport of keepalive.h
+struct HttpsTransport {
+  HostConnection &conn;
+  bool resumedLast = false;
+
+  explicit HttpsTransport(HostConnection &conn) : conn(conn) {}
+  bool connected() { return conn.client.connected(); }
+  int request(const char *url) {
+    bool warm = conn.client.connected();
+    resumedLast = false;
+    if (!conn.http.begin(conn.client, url)) {
+      log_i("Failed to initialize HTTPS connection to %s", conn.host);
+      return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+    resumeSession = !warm && conn.sessionSaved ? &conn.session : nullptr;
+    unsigned long start = millis();
+    int httpCode = conn.http.GET();
+    resumeSession = nullptr;
+    if (httpCode < 0 && warm) {
+      log_i("Idle connection to %s was closed, reconnecting", conn.host);
+      return httpCode;
+    }
+    if (!warm && conn.client.connected()) resumedLast = saveSession(conn);
+    conn.lastTtfbMs = millis() - start;
+    if (httpCode > 0) {
+      conn.totalTtfbMs += conn.lastTtfbMs;
+      if (conn.lastTtfbMs > conn.maxTtfbMs) conn.maxTtfbMs = conn.lastTtfbMs;
+    }
+    return httpCode;
+  }
+  bool resumed() { return resumedLast; }
+  void stop() { conn.client.stop(); }
+  void end() { conn.http.end(); }
+};
+
+int connectionGet(HostConnection &conn, const char *url) {
+  if (!conn.initialized) {
+    conn.client.setInsecure();
+    // HTTP/1.1, useHTTP10() would turn reuse off. Chunked bodies are decoded by BodyStream.
+    conn.http.useHTTP10(false);
+    conn.http.setReuse(conn.keepAlive.persistent);
+    conn.http.setTimeout(10000);
+    static const char *headers[] = {"Transfer-Encoding"};
+    conn.http.collectHeaders(headers, 1);
+    conn.initialized = true;
+  }
+  HttpsTransport transport(conn);
+  int httpCode = keepAliveGet(conn.keepAlive, transport, url);
+  bool chunked = httpCode > 0 && conn.http.header("Transfer-Encoding").equalsIgnoreCase("chunked");
+  conn.body.begin(conn.http.getStream(), httpCode > 0 ? conn.http.getSize() : 0, chunked);
+  return httpCode;
+}
+
+void connectionEnd(HostConnection &conn) {
+  HttpsTransport transport(conn);
+  keepAliveEnd(conn.keepAlive, transport, conn.body);
+}
+
+void connectionRelease(HostConnection &conn, unsigned long nextUseMs) {
+  HttpsTransport transport(conn);
+  if (keepAliveRelease(conn.keepAlive, transport, nextUseMs))
+    log_i("%s: next request in %lu s, connection released, TLS session kept", conn.host, nextUseMs / 1000);
+}
+
+void logConnectionStats(const HostConnection &conn) {
+  const KeepAlive &k = conn.keepAlive;
+  unsigned long answered = k.requests ? k.requests : 1;
+  log_i("%s: %lu requests, %lu keep-alive hits, %lu TLS resumptions, %lu full handshakes, %lu retries, %lu released, "
+        "TTFB last %lu ms, max %lu ms, avg %lu ms",
+        conn.host, k.requests, k.keepAliveHits, k.resumptions, k.handshakes, k.retries, k.releases, conn.lastTtfbMs, conn.maxTtfbMs,
+        conn.totalTtfbMs / answered);
+}
@@ -0,0 +1,90 @@
+// HTTPS connections to the upstream APIs over HTTP/1.1.
+// A persistent host keeps its TCP/TLS connection open between requests that follow each other closely. When it has
+// to connect again, the TLS session of the last connection is offered to the server, so only the first connection
+// (or one after the server forgot the session) pays for a full handshake. The reuse logic is in keepalive.h.
+#pragma once
+
+#include <HTTPClient.h>
+#include <WiFiClientSecure.h>
+#include <mbedtls/ssl.h>
+
+#include "keepalive.h"
+
+// The socket as a BodyReader reads it, timedRead() waits as long as the socket timeout
+struct SocketSource {
+  Stream *stream = nullptr;
+  int available() { return stream->available(); }
+  int read() { return stream->read(); }
+  int peek() { return stream->peek(); }
+  int timedRead() {
+    unsigned long start = millis();
+    do {
+      int c = stream->read();
+      if (c >= 0) return c;
+      delay(1);
+    } while (millis() - start < stream->getTimeout());
+    return -1;
+  }
+};
+
+// Response body of a HostConnection request as a Stream, with the chunked transfer coding taken off
+class BodyStream : public Stream {
+ public:
+  void begin(Stream &source, int bodySize, bool chunked) {
+    socket.stream = &source;
+    reader.begin(socket, bodySize, chunked);
+  }
+  int available() override { return reader.available(); }
+  int read() override { return reader.read(); }
+  int peek() override { return reader.peek(); }
+  size_t write(uint8_t) override { return 0; }
+  using Stream::readBytes;
+  size_t readBytes(char *buffer, size_t length) override { return reader.readBytes(buffer, length); }
+  int remaining() const { return reader.remaining(); }
+  bool delimited() const { return reader.delimited(); }
+  bool ended() const { return reader.ended(); }
+
+ private:
+  SocketSource socket;
+  BodyReader<SocketSource> reader;
+};
+
+// WiFiClientSecure with access to its TLS context, to take the session after a handshake
+class TlsClient : public WiFiClientSecure {
+ public:
+  mbedtls_ssl_context *ssl() { return sslclient ? &sslclient->ssl_ctx : nullptr; }
+};
+
+struct HostConnection {
+  // A host that is not persistent closes its connection after every request, for APIs called only now and then
+  explicit HostConnection(const char *host, bool persistent = true) : host(host) {
+    keepAlive.persistent = persistent;
+    mbedtls_ssl_session_init(&session);
+  }
+  const char *host;
+  TlsClient client;
+  HTTPClient http;
+  BodyStream body;
+  KeepAlive keepAlive;
+  mbedtls_ssl_session session;  // Of the last connection, offered to the server on the next one
+  bool sessionSaved = false;
+  bool initialized = false;
+  unsigned long lastTtfbMs = 0;  // Time to first byte: request sent until response headers parsed
+  unsigned long maxTtfbMs = 0;
+  unsigned long totalTtfbMs = 0;
+};
+
+// Send a GET request, reusing the open connection if there is one.
+// Returns the HTTP status code (or a negative HTTPC_ERROR_*). The body is read from conn.body,
+// connectionEnd() must be called afterwards in every case.
+int connectionGet(HostConnection &conn, const char *url);
+
+// Finish the request: drain the unread body and keep the connection of a persistent host open if the server allows it
+void connectionEnd(HostConnection &conn);
+
+// The next request is nextUseMs away: close the open connection if the server would close it first anyway.
+// Frees the TLS context, the session is kept and resumed on the next connection.
+void connectionRelease(HostConnection &conn, unsigned long nextUseMs);
+
+// Log keep-alive hits, resumptions, full handshakes and time to first byte
+void logConnectionStats(const HostConnection &conn);
@@ -0,0 +1,77 @@
+// Solar event table, see ephemeris.h
+#include "ephemeris.h"
+
+#include "calc.h"
+
+// sunEventHours wraps each event into one day on its own, so a dusk past local midnight would come out before the dawn.
+// Dawn and rise events are unwrapped into the 12 hours before solar noon, dusk and set events into the 12 hours after it.
+static unsigned long unwrapEvent(long day, double hours, double noon, bool isRise) {
+  if (isRise) {
+    while (hours > noon) hours -= 24;
+    while (hours <= noon - 24) hours += 24;
+  } else {
+    while (hours < noon) hours += 24;
+    while (hours >= noon + 24) hours -= 24;
+  }
+  return (unsigned long)(day * 86400L + (long)(hours * 3600));
+}
+
+static void computeSolarDay(SolarDay &solarDay, long day, float lat, float lon) {
+  static const double zenith[] = {SUN_ZENITH_ASTRONOMICAL, SUN_ZENITH_NAUTICAL, SUN_ZENITH_CIVIL, SUN_ZENITH_OFFICIAL};
+  double noon = 12 - lon / 15.0;  // Mean solar noon in hours UTC, the equation of time is far below the 12 hour margin
+  solarDay.day = day;
+  int riseStatus = SUN_EVENT_OK;
+  for (int i = 0; i < 4; i++) {
+    double hours;
+    // Dawn and rise events count up from the start of the table, dusk and set events down from its end
+    int status = sunEventHours(day, lat, lon, true, zenith[i], hours);
+    solarDay.events[i] = status == SUN_EVENT_OK ? unwrapEvent(day, hours, noon, true) : 0;
+    if (i == 3) riseStatus = status;
+    status = sunEventHours(day, lat, lon, false, zenith[i], hours);
+    solarDay.events[SUN_EVENT_COUNT - 1 - i] = status == SUN_EVENT_OK ? unwrapEvent(day, hours, noon, false) : 0;
+  }
+  if (solarDay.events[SUN_RISE] && solarDay.events[SUN_SET]) {
+    long length = (long)(solarDay.events[SUN_SET] - solarDay.events[SUN_RISE]);
+    solarDay.dayLength = length < 0 ? 0 : length > 86400 ? 86400 : length;
+  } else
+    solarDay.dayLength = riseStatus == SUN_ALWAYS_ABOVE ? 86400 : 0;  // Polar day or polar night
+}
+
+bool updateEphemeris(Ephemeris &ephemeris, unsigned long nowUtc, float lat, float lon, long utcOffset) {
+  long today = (long)((nowUtc + utcOffset) / 86400);
+  if (ephemeris.lat != lat || ephemeris.lon != lon || ephemeris.utcOffset != utcOffset) {
+    ephemeris.lat = lat;
+    ephemeris.lon = lon;
+    ephemeris.utcOffset = utcOffset;
+    for (int i = 0; i < EPHEMERIS_DAYS; i++) ephemeris.days[i].day = -1;
+  }
+  if (ephemeris.days[0].day == today) return false;
+  // Roll the table forward and only compute the days that are new
+  int shift = ephemeris.days[0].day < 0 ? EPHEMERIS_DAYS : (int)(today - ephemeris.days[0].day);
+  for (int i = 0; i < EPHEMERIS_DAYS; i++) {
+    if (shift > 0 && i + shift < EPHEMERIS_DAYS && ephemeris.days[i + shift].day == today + i)
+      ephemeris.days[i] = ephemeris.days[i + shift];
+    else
+      computeSolarDay(ephemeris.days[i], today + i, lat, lon);
+  }
+  return true;
+}
+
+SunEventType nextSunEvent(const Ephemeris &ephemeris, unsigned long nowUtc, unsigned long &when) {
+  // The earliest future event of the table, independent of the order of its entries
+  SunEventType next = SUN_EVENT_COUNT;
+  for (int d = 0; d < EPHEMERIS_DAYS; d++)
+    for (int i = 0; i < SUN_EVENT_COUNT; i++) {
+      unsigned long event = ephemeris.days[d].events[i];
+      if (event > nowUtc && (next == SUN_EVENT_COUNT || event < when)) {
+        when = event;
+        next = (SunEventType)i;
+      }
+    }
+  return next;
+}
+
+const char *sunEventName(SunEventType type) {
+  static const char *names[] = {"Astro dawn", "Nautical dawn", "Civil dawn", "Sunrise", "Sunset", "Civil dusk", "Nautical dusk", "Astro dusk"};
+  return type < SUN_EVENT_COUNT ? names[type] : "--";
+}
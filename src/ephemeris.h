@@ -0,0 +1,42 @@
+// Rolling table of solar events for one station position.
+// Computed once per local day (or when the position changes), the screen only looks events up.
+#pragma once
+
+enum SunEventType {
+  SUN_ASTRONOMICAL_DAWN,
+  SUN_NAUTICAL_DAWN,
+  SUN_CIVIL_DAWN,
+  SUN_RISE,
+  SUN_SET,
+  SUN_CIVIL_DUSK,
+  SUN_NAUTICAL_DUSK,
+  SUN_ASTRONOMICAL_DUSK,
+  SUN_EVENT_COUNT
+};
+
+#define EPHEMERIS_DAYS 2  // Today and tomorrow, local date of the station
+
+struct SolarDay {
+  long day = -1;                                // Local date, days since 1970-01-01
+  unsigned long events[SUN_EVENT_COUNT] = {0};  // UTC epoch seconds, 0 if the sun does not cross that altitude
+  long dayLength = 0;                           // Seconds between sunrise and sunset
+};
+
+struct Ephemeris {
+  float lat = 0;
+  float lon = 0;
+  long utcOffset = 0;
+  SolarDay days[EPHEMERIS_DAYS];
+};
+
+// Bring the table up to date for the local day at nowUtc. Returns true if anything was recomputed.
+bool updateEphemeris(Ephemeris &ephemeris, unsigned long nowUtc, float lat, float lon, long utcOffset);
+
+// Today's entry of an up to date table
+inline const SolarDay &ephemerisToday(const Ephemeris &ephemeris) { return ephemeris.days[0]; }
+
+// Next event after nowUtc, SUN_EVENT_COUNT if there is none in the table
+SunEventType nextSunEvent(const Ephemeris &ephemeris, unsigned long nowUtc, unsigned long &when);
+
+// Short display name of an event, e.g. "Civil dusk"
+const char *sunEventName(SunEventType type);
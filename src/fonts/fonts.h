@@ -0,0 +1,9 @@
+// Glyph subset fonts, generated into this directory by tools/gen_fonts.py (pio run -t fonts).
+// Only used with -D UI_SUBSET_FONTS.
+#pragma once
+
+#include <lvgl.h>
+
+LV_FONT_DECLARE(font_clock_48);    // Digits, ':', '.' and '-' of the big clock
+LV_FONT_DECLARE(font_clock_24);    // Same glyphs, big clock of the small layouts
+LV_FONT_DECLARE(font_airport_14);  // Printable ASCII and the home icon, compressed
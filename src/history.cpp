@@ -0,0 +1,130 @@
+// Observation history ring, see history.h
+#include "history.h"
+
+static_assert(HISTORY_CAPACITY < 256, "HistoryExtreme keeps slots and its size in a byte");
+
+static uint32_t revisions = 0;
+
+// A missing value (HISTORY_NONE) is left out of the sums
+static void trendAdd(TrendSums &sums, int64_t t, int32_t v) {
+  if (v == HISTORY_NONE) return;
+  sums.n++;
+  sums.t += t;
+  sums.tt += t * t;
+  sums.v += v;
+  sums.tv += t * v;
+}
+
+static void trendRemove(TrendSums &sums, int64_t t, int32_t v) {
+  if (v == HISTORY_NONE) return;
+  sums.n--;
+  sums.t -= t;
+  sums.tt -= t * t;
+  sums.v -= v;
+  sums.tv -= t * v;
+}
+
+static int64_t trendMinutes(const History &history, int slot) { return ((int64_t)history.obsTime[slot] - history.baseTime) / 60; }
+
+// Drop the oldest report of the trend window from the sums
+static void trendRemoveOldest(History &history) {
+  int slot = history.trendStart;
+  int64_t t = trendMinutes(history, slot);
+  trendRemove(history.temperatureTrend, t, history.temperature[slot]);
+  trendRemove(history.pressureTrend, t, history.pressure[slot]);
+  history.trendStart = (slot + 1) % HISTORY_CAPACITY;
+}
+
+// Add slot at the back, slots whose value can no longer be the extreme go first. A missing value is never one.
+static void extremePush(HistoryExtreme &extreme, const int32_t *values, int slot, bool isMax) {
+  int32_t value = values[slot];
+  if (value == HISTORY_NONE) return;
+  while (extreme.size) {
+    int32_t back = values[extreme.slots[(extreme.front + extreme.size - 1) % HISTORY_CAPACITY]];
+    if (isMax ? back > value : back < value) break;
+    extreme.size--;
+  }
+  extreme.slots[(extreme.front + extreme.size) % HISTORY_CAPACITY] = slot;
+  extreme.size++;
+}
+
+// The oldest slot of the ring is about to be overwritten
+static void extremeEvict(HistoryExtreme &extreme, int slot) {
+  if (!extreme.size || extreme.slots[extreme.front] != slot) return;
+  extreme.front = (extreme.front + 1) % HISTORY_CAPACITY;
+  extreme.size--;
+}
+
+void historyReset(History &history) {
+  for (int i = 0; i < HISTORY_CAPACITY; i++) {
+    history.temperature[i] = HISTORY_NONE;
+    history.dewPoint[i] = HISTORY_NONE;
+    history.windSpeed[i] = HISTORY_NONE;
+    history.pressure[i] = HISTORY_NONE;
+    history.obsTime[i] = 0;
+  }
+  history.head = 0;
+  history.count = 0;
+  history.trendStart = 0;
+  history.baseTime = 0;
+  history.temperatureTrend = TrendSums();
+  history.pressureTrend = TrendSums();
+  history.temperatureMax.front = history.temperatureMax.size = 0;
+  history.dewPointMin.front = history.dewPointMin.size = 0;
+  history.pressureMin.front = history.pressureMin.size = 0;
+  history.pressureMax.front = history.pressureMax.size = 0;
+  history.revision = ++revisions;
+}
+
+bool historyAppend(History &history, uint32_t obsTime, int temperature, int dewPoint, int windSpeed, int pressure) {
+  int newest = (history.head + HISTORY_CAPACITY - 1) % HISTORY_CAPACITY;
+  if (history.count && obsTime <= history.obsTime[newest]) return false;
+  if (!history.count) {
+    history.baseTime = obsTime;
+    history.trendStart = history.head;
+  }
+  // The slot about to be overwritten leaves the trend window first
+  if (history.count == HISTORY_CAPACITY && history.head == history.trendStart) trendRemoveOldest(history);
+  int slot = history.head;
+  if (history.count == HISTORY_CAPACITY) {
+    extremeEvict(history.temperatureMax, slot);
+    extremeEvict(history.dewPointMin, slot);
+    extremeEvict(history.pressureMin, slot);
+    extremeEvict(history.pressureMax, slot);
+  }
+  history.temperature[slot] = temperature;
+  history.dewPoint[slot] = dewPoint;
+  history.windSpeed[slot] = windSpeed;
+  history.pressure[slot] = pressure;
+  history.obsTime[slot] = obsTime;
+  int64_t t = trendMinutes(history, slot);
+  trendAdd(history.temperatureTrend, t, temperature);
+  trendAdd(history.pressureTrend, t, pressure);
+  extremePush(history.temperatureMax, history.temperature, slot, true);
+  extremePush(history.dewPointMin, history.dewPoint, slot, false);
+  extremePush(history.pressureMin, history.pressure, slot, false);
+  extremePush(history.pressureMax, history.pressure, slot, true);
+  history.revision = ++revisions;
+  history.head = (slot + 1) % HISTORY_CAPACITY;
+  if (history.count < HISTORY_CAPACITY) history.count++;
+  // Amortized O(1), every report leaves the window once, the new one stays
+  while (history.trendStart != slot && history.obsTime[history.trendStart] + HISTORY_TREND_SECONDS < obsTime) trendRemoveOldest(history);
+  return true;
+}
+
+int32_t historyExtreme(const HistoryExtreme &extreme, const int32_t *values) {
+  return extreme.size ? values[extreme.slots[extreme.front]] : HISTORY_NONE;
+}
+
+TrendDirection historyTrend(const History &history, const TrendSums &sums, float threshold) {
+  if (sums.n < 2) return TREND_UNKNOWN;
+  int newest = (history.head + HISTORY_CAPACITY - 1) % HISTORY_CAPACITY;
+  if (history.obsTime[newest] - history.obsTime[history.trendStart] < 3600) return TREND_UNKNOWN;
+  int64_t denominator = sums.n * sums.tt - sums.t * sums.t;
+  if (denominator <= 0) return TREND_UNKNOWN;
+  // Slope per minute, scaled to the change over the whole window
+  float change = (float)(sums.n * sums.tv - sums.t * sums.v) / denominator * (HISTORY_TREND_SECONDS / 60);
+  if (change >= threshold) return TREND_RISING;
+  if (change <= -threshold) return TREND_FALLING;
+  return TREND_STEADY;
+}
@@ -0,0 +1,62 @@
+// Observation history of one station: a fixed ring of the last METAR reports, stored as one array per value.
+// The value arrays are laid out like an lv_chart series (oldest point at head), so a chart can show them in place,
+// the pressure and temperature trends are kept as running sums and the chart ranges as sliding window extremes,
+// so a new report costs amortized O(1) whatever the size.
+#pragma once
+
+#include <stdint.h>
+
+// 48 h of half-hourly reports, boards without PSRAM keep 12 h of one station in internal RAM
+#ifdef BOARD_HAS_PSRAM
+#define HISTORY_CAPACITY 96
+#else
+#define HISTORY_CAPACITY 24
+#endif
+
+#define HISTORY_TREND_SECONDS (3 * 3600L)  // Trend over the last 3 hours, like the synoptic pressure tendency
+#define HISTORY_NONE INT32_MAX            // Empty slot, the same value as LV_CHART_POINT_NONE
+
+// Least squares sums of the reports in the trend window, time in minutes since History::baseTime.
+// All integer, so removing a report takes back exactly what adding it put in.
+struct TrendSums {
+  int64_t n, t, tt, v, tv;
+};
+
+// Slots of the ring whose value is an extreme of the reports after it, oldest first, so the front is the extreme
+// of the whole ring. Every slot enters and leaves once.
+struct HistoryExtreme {
+  uint8_t slots[HISTORY_CAPACITY];
+  uint8_t front, size;
+};
+
+enum TrendDirection { TREND_UNKNOWN, TREND_FALLING, TREND_STEADY, TREND_RISING };
+
+// Plain data, lives in PSRAM (ps_malloc) and is set up with historyReset()
+struct History {
+  int32_t temperature[HISTORY_CAPACITY];  // °C
+  int32_t dewPoint[HISTORY_CAPACITY];     // °C
+  int32_t windSpeed[HISTORY_CAPACITY];    // kt
+  int32_t pressure[HISTORY_CAPACITY];     // hPa
+  uint32_t obsTime[HISTORY_CAPACITY];     // UTC epoch seconds
+  int head;                               // Next slot to write, the oldest report once the ring is full
+  int count;
+  int trendStart;  // Oldest slot in the trend window
+  uint32_t baseTime;
+  TrendSums temperatureTrend, pressureTrend;
+  // Chart ranges, the dew point is never above the temperature
+  HistoryExtreme temperatureMax, dewPointMin, pressureMin, pressureMax;
+  uint32_t revision;  // New on every reset and added report, unique over all histories
+};
+
+void historyReset(History &history);
+
+// Add a report, returns false if it is not newer than the last one (the same METAR fetched again).
+// A value missing from the report is passed as HISTORY_NONE: not drawn, not in the trend and not an extreme.
+bool historyAppend(History &history, uint32_t obsTime, int temperature, int dewPoint, int windSpeed, int pressure);
+
+// Value of the extreme over the whole ring, HISTORY_NONE while it is empty
+int32_t historyExtreme(const HistoryExtreme &extreme, const int32_t *values);
+
+// Direction of the least squares slope over the trend window, steady below threshold per window.
+// Unknown until the window spans at least an hour.
+TrendDirection historyTrend(const History &history, const TrendSums &sums, float threshold);
@@ -0,0 +1,16 @@
+// Connection reuse, see keepalive.h
+#include "keepalive.h"
+
+bool keepAliveRetry(bool warm, int httpCode, int attempt) { return httpCode < 0 && warm && attempt == 0; }
+
+void keepAliveAnswered(KeepAlive &keepAlive, bool warm, bool resumed) {
+  keepAlive.requests++;
+  if (warm)
+    keepAlive.keepAliveHits++;
+  else if (resumed)
+    keepAlive.resumptions++;
+  else
+    keepAlive.handshakes++;
+}
+
+bool keepAliveOutlived(unsigned long nextUseMs) { return nextUseMs > KEEP_ALIVE_IDLE_TIMEOUT_MS; }
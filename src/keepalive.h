@@ -0,0 +1,151 @@
+// Reuse of the HTTPS connection of a HostConnection, apart from the WiFi, TLS and HTTP classes so it runs on the host
+// against a stand-in server. A request goes over the connection still open from the request before (keep-alive hit),
+// over a new connection that resumes the TLS session of the last one (abbreviated handshake: no certificate and no key
+// exchange), or over a new connection with a full handshake. The body is read through a BodyReader, which knows where
+// it ends, so an unread rest can be drained and the connection carries the next request.
+//
+// The transport of keepAliveGet() and keepAliveEnd() has:
+//   bool connected()           the connection is open, as far as the client knows
+//   int request(const char *)  send a GET, connecting first if needed, and read the response head. HTTP status or < 0.
+//   bool resumed()             the connection of the last request() was opened with a resumed TLS session
+//   void stop()                close the connection, the TLS session stays for resumption
+//   void end()                 done with the response
+// The source of a BodyReader has available(), peek() and read() that do not wait, and timedRead() that waits for a
+// byte as long as the socket timeout and returns -1 after it.
+#pragma once
+
+#include <stddef.h>
+
+#include "chunked.h"
+
+// Servers drop idle connections after about a minute (nginx keepalive_timeout is 75 s). A connection that would next
+// be used later than that is released right away, which frees the TLS context (~40 KB of heap) of the client.
+#define KEEP_ALIVE_IDLE_TIMEOUT_MS 60000
+
+struct KeepAlive {
+  bool persistent = true;           // Keep the connection open after a response, if its body has a known end
+  unsigned long requests = 0;       // Answered with an HTTP status
+  unsigned long keepAliveHits = 0;  // Sent over the connection still open from the request before
+  unsigned long resumptions = 0;    // New connection, TLS session resumed
+  unsigned long handshakes = 0;     // New connection, full TLS handshake
+  unsigned long retries = 0;        // The open connection had been closed by the server, sent again over a new one
+  unsigned long releases = 0;       // Closed by keepAliveRelease() before the server would have
+};
+
+// Retry once over a new connection when a request over the open connection failed: the server closed it while idle
+bool keepAliveRetry(bool warm, int httpCode, int attempt);
+
+// Count an answered request by the way it went out
+void keepAliveAnswered(KeepAlive &keepAlive, bool warm, bool resumed);
+
+// The open connection is of no use if its next request is nextUseMs away, the server will have closed it by then
+bool keepAliveOutlived(unsigned long nextUseMs);
+
+// Response body with a Content-Length, in the chunked transfer coding, or up to the close of the connection
+template <typename Source>
+class BodyReader {
+ public:
+  void begin(Source &bodySource, int bodySize, bool chunkedBody) {
+    source = &bodySource;
+    chunked = chunkedBody;
+    size = chunked ? -1 : bodySize;
+    consumed = 0;
+    decoder = ChunkedDecoder();
+  }
+  int available() {
+    if (!source || !toData(false)) return 0;
+    int n = source->available();
+    if (chunked && (unsigned long)n > decoder.chunkLeft) n = decoder.chunkLeft;
+    if (size >= 0 && n > size - consumed) n = size - consumed;
+    return n;
+  }
+  int read() { return source && toData(false) ? take(source->read()) : -1; }
+  int peek() { return source && toData(false) ? source->peek() : -1; }
+  // Waits for the bytes like Stream::readBytes(), but stops at the end of the body instead of running into the timeout
+  size_t readBytes(char *buffer, size_t length) {
+    size_t count = 0;
+    while (count < length && source && toData(true)) {
+      int c = take(source->timedRead());
+      if (c < 0) break;
+      buffer[count++] = (char)c;
+    }
+    return count;
+  }
+  // Bytes of the body not read yet, -1 if unknown: no Content-Length, or chunked before the last chunk was read
+  int remaining() const {
+    if (chunked) return decoder.state == CHUNKED_DONE ? 0 : -1;
+    return size < 0 ? -1 : size - consumed;
+  }
+  // The body has a known end, it can be read up to there and the connection reused
+  bool delimited() const { return chunked ? decoder.state != CHUNKED_ERROR : size >= 0; }
+  bool ended() const {
+    if (chunked) return decoder.state == CHUNKED_DONE || decoder.state == CHUNKED_ERROR;
+    return size >= 0 && consumed >= size;
+  }
+
+ private:
+  // Read the chunk framing up to the next data byte, false at the end of the body or while the framing is incomplete
+  bool toData(bool wait) {
+    if (!chunked) return !ended();
+    while (decoder.state != CHUNKED_DATA) {
+      if (decoder.state == CHUNKED_DONE || decoder.state == CHUNKED_ERROR) return false;
+      int c = wait ? source->timedRead() : source->read();
+      if (c < 0) return false;
+      chunkedFrame(decoder, c);
+    }
+    return true;
+  }
+  int take(int c) {
+    if (c < 0) return -1;
+    consumed++;
+    if (chunked) chunkedData(decoder);
+    return c;
+  }
+
+  Source *source = nullptr;
+  bool chunked = false;
+  int size = -1;
+  int consumed = 0;
+  ChunkedDecoder decoder;
+};
+
+// Send a GET over the transport, the open connection if there is one. Returns the HTTP status code or the negative
+// error of the transport, the body is then read from the BodyReader and keepAliveEnd() called in every case.
+template <typename Transport>
+int keepAliveGet(KeepAlive &keepAlive, Transport &transport, const char *url) {
+  int httpCode = -1;
+  for (int attempt = 0; attempt < 2; attempt++) {
+    bool warm = transport.connected();
+    httpCode = transport.request(url);
+    if (keepAliveRetry(warm, httpCode, attempt)) {
+      keepAlive.retries++;
+      transport.end();
+      transport.stop();
+      continue;
+    }
+    if (httpCode > 0) keepAliveAnswered(keepAlive, warm, transport.resumed());
+    break;
+  }
+  return httpCode;
+}
+
+// Finish the request: drain the unread body and keep the connection open if the host is persistent and the body
+// was read up to its end. Anything else left on the connection would end up in front of the next response.
+template <typename Transport, typename Body>
+void keepAliveEnd(KeepAlive &keepAlive, Transport &transport, Body &body) {
+  char drainBuf[64];
+  while (keepAlive.persistent && body.delimited() && !body.ended())
+    if (!body.readBytes(drainBuf, sizeof(drainBuf))) break;
+  // Unknown body length, drain timed out or broken chunks
+  if (!keepAlive.persistent || body.remaining() != 0) transport.stop();
+  transport.end();
+}
+
+// Close the open connection if its next request is nextUseMs away, returns true if it was released
+template <typename Transport>
+bool keepAliveRelease(KeepAlive &keepAlive, Transport &transport, unsigned long nextUseMs) {
+  if (!transport.connected() || !keepAliveOutlived(nextUseMs)) return false;
+  transport.stop();
+  keepAlive.releases++;
+  return true;
+}
@@ -0,0 +1,102 @@
+// Screen layout and render profile, chosen at compile time from the board defines.
+// DISPLAY_WIDTH/DISPLAY_HEIGHT pick the layout and fonts, boards without BOARD_HAS_PSRAM (small internal
+// draw buffer) also skip shadows and gradients, the most expensive parts of a card to render.
+#pragma once
+
+#include <lvgl.h>
+#include <stdint.h>
+
+struct LayoutRect {
+  int16_t x, y, w, h;
+};
+
+struct LayoutPoint {
+  int16_t x, y;
+};
+
+// Cards are in screen coordinates, everything inside a card relative to the card content.
+// A card with h 0 and a position with x < 0 are not shown.
+struct LayoutProfile {
+  const char *name;
+  // Render path
+  bool shadows;
+  bool gradients;
+  int16_t cardRadius;
+  int16_t cardPad;  // < 0 keeps the padding of the default theme
+  const lv_font_t *font;
+  const lv_font_t *bigFont;
+  bool iconOnlyButtons;
+  // Label rows inside a card
+  int16_t firstRowY;
+  int16_t rowHeight;
+  // Main screen
+  LayoutRect headerCard, airportCard, weatherCard, sunCard, clockCard, statusCard;
+  LayoutRect settingsButton;  // Header card
+  LayoutPoint dataAge;        // Airport card
+  LayoutPoint flightCategory; // Airport card
+  LayoutPoint bigTime, bigDate;
+  LayoutPoint telemetry;  // Status card, replaces the title if it is on the title position
+  int16_t versionX;       // Status card
+  LayoutRect trendChart;  // Clock card, temperature, dew point and pressure history, h 0 for none
+  LayoutPoint forecast;   // Sun card, next change of the TAF, x < 0 for none
+  // Settings screen
+  LayoutRect settingsHeaderCard, formCard, helpCard;
+  LayoutPoint settingsTitle;
+  LayoutRect saveButton;  // Settings header card
+  LayoutPoint formPitch;  // Distance of the four fields, x 0 puts them in one column
+  LayoutPoint fieldSize;  // Text area
+  int16_t captionHeight;  // Caption above each text area
+  int16_t helpTextX;      // Help card, < 0 puts a short hint in the second row
+  LayoutPoint keyboardSize;
+};
+
+// Big clock fonts, the generated digit subsets with -D UI_SUBSET_FONTS (tools/gen_fonts.py)
+#ifdef UI_SUBSET_FONTS
+#include "fonts/fonts.h"
+#define LAYOUT_CLOCK_FONT_48 font_clock_48
+#define LAYOUT_CLOCK_FONT_24 font_clock_24
+#else
+#define LAYOUT_CLOCK_FONT_48 lv_font_montserrat_48
+#define LAYOUT_CLOCK_FONT_24 lv_font_montserrat_24
+#endif
+
+#ifdef BOARD_HAS_PSRAM
+#define LAYOUT_HAS_PSRAM true
+#else
+#define LAYOUT_HAS_PSRAM false
+#endif
+
+// 800x480, the original layout
+constexpr LayoutProfile LAYOUT_LARGE = {
+    "large", true, true, 10, -1, &lv_font_montserrat_14, &LAYOUT_CLOCK_FONT_48, false,
+    -5, 30,
+    {5, 5, 790, 80}, {5, 90, 790, 45}, {5, 140, 390, 185}, {405, 140, 390, 185}, {5, 330, 790, 95}, {5, 430, 790, 45},
+    {650, 0, 110, 40}, {400, -5}, {620, -5}, {0, 0}, {250, 0}, {290, -5}, 600, {560, -5, 190, 55}, {0, 115},
+    {5, 5, 790, 70}, {5, 80, 790, 345}, {5, 430, 790, 45}, {0, 5}, {650, -5, 110, 40},
+    {360, 80}, {300, 35}, 25, 50, {770, 150}};
+
+// 240x320 portrait: weather and sun side by side, the big clock in two rows
+constexpr LayoutProfile LAYOUT_COMPACT = {
+    "compact", LAYOUT_HAS_PSRAM, LAYOUT_HAS_PSRAM, 6, 6, &lv_font_montserrat_14, &LAYOUT_CLOCK_FONT_24, true,
+    -2, 19,
+    {3, 3, 234, 54}, {3, 60, 234, 44}, {3, 107, 116, 102}, {121, 107, 116, 102}, {3, 212, 234, 72}, {3, 287, 234, 30},
+    {170, -4, 48, 26}, {0, 17}, {170, 17}, {0, -2}, {0, 28}, {0, -2}, -1, {120, 0, 102, 58}, {0, 74},
+    {3, 3, 234, 44}, {3, 50, 234, 219}, {3, 272, 234, 46}, {0, -2}, {170, -4, 48, 26},
+    {0, 52}, {210, 30}, 20, -1, {240, 140}};
+
+// 170x320 portrait: all cards stacked, no status card, the date only in the header
+constexpr LayoutProfile LAYOUT_NARROW = {
+    "narrow", false, LAYOUT_HAS_PSRAM, 4, 4, &lv_font_montserrat_14, &LAYOUT_CLOCK_FONT_24, true,
+    -1, 17,
+    {3, 3, 164, 46}, {3, 51, 164, 42}, {3, 95, 164, 93}, {3, 190, 164, 76}, {3, 268, 164, 36}, {0, 0, 0, 0},
+    {120, -2, 36, 24}, {0, 16}, {118, 16}, {0, 0}, {-1, 0}, {0, -1}, -1, {0, 0, 0, 0}, {-1, 0},
+    {3, 3, 164, 36}, {3, 41, 164, 232}, {3, 275, 164, 42}, {0, 0}, {120, -2, 36, 24},
+    {0, 56}, {150, 30}, 20, -1, {170, 140}};
+
+#if DISPLAY_WIDTH >= 480
+constexpr const LayoutProfile &layout = LAYOUT_LARGE;
+#elif DISPLAY_WIDTH >= 240
+constexpr const LayoutProfile &layout = LAYOUT_COMPACT;
+#else
+constexpr const LayoutProfile &layout = LAYOUT_NARROW;
+#endif
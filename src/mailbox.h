@@ -0,0 +1,46 @@
+// Lock-free single-producer/single-consumer mailbox.
+// The producer fills a slot in place and publishes it, the consumer reads it in place and releases it,
+// so large snapshots are never copied and no task ever blocks on the other.
+// The slots are handed over once with begin(), so they can live in PSRAM. With a single slot the producer
+// finds it taken until the consumer released the last one.
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <stddef.h>
+
+template <typename T>
+class SpscMailbox {
+ public:
+  // Construct count slots in memory of count * sizeof(T) bytes, before either side uses the mailbox
+  void begin(void *memory, size_t count) {
+    T *storage = (T *)memory;
+    for (size_t i = 0; i < count; i++) new (&storage[i]) T();
+    slots = storage;
+    slotCount = count;
+  }
+
+  // Producer: free slot to fill, nullptr if all slots are still waiting for the consumer or there are none
+  T *claim() {
+    size_t head = produced.load(std::memory_order_relaxed);
+    if (!slots || head - consumed.load(std::memory_order_acquire) == slotCount) return nullptr;
+    return &slots[head % slotCount];
+  }
+  // Producer: hand the claimed slot to the consumer
+  void publish() { produced.store(produced.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  // Consumer: oldest published slot, nullptr if there is none
+  T *peek() {
+    size_t tail = consumed.load(std::memory_order_relaxed);
+    if (tail == produced.load(std::memory_order_acquire)) return nullptr;
+    return &slots[tail % slotCount];
+  }
+  // Consumer: give the slot back to the producer
+  void release() { consumed.store(consumed.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+ private:
+  T *slots = nullptr;
+  size_t slotCount = 0;
+  std::atomic<size_t> produced{0};  // Slots published so far, written by the producer only
+  std::atomic<size_t> consumed{0};  // Slots released so far, written by the consumer only
+};
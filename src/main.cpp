@@ -25,41 +25,42 @@ Internationalization: Support non-English airports by handling UTF-8 in labels (
 #include <Preferences.h>
 #include <WiFi.h>
 #include <esp32_smartdisplay.h>
+#include <esp_netif.h>
+#include <esp_netif_net_stack.h>
+#include <lwip/dhcp.h>
+#include <lwip/priv/tcpip_priv.h>
 #include <lvgl.h>
 #include <math.h>
+#include <stddef.h>
 #include <strings.h>
 #include <cmath>
 #include <ctype.h>
+#include <atomic>
+#include "calc.h"
+#include "card_layers.h"
+#include "config_record.h"
+#include "connection.h"
+#include "ephemeris.h"
+#include "history.h"
+#include "layout.h"
+#include "mailbox.h"
+#include "metar.h"
+#include "metar_json.h"
+#include "poll.h"
+#include "power.h"
+#include "taf.h"
+#include "telemetry.h"
+#include "tz.h"
+#include "ui.h"
 
-// UI elements structure
-struct UiElements {
-  lv_obj_t *mainScreen;
-  lv_obj_t *mainPanel;
-  lv_obj_t *temperatureLabel;
-  lv_obj_t *humidityLabel;
-  lv_obj_t *windSpeedLabel;
-  lv_obj_t *pressureLabel;
-  lv_obj_t *timeDateLabel;
-  lv_obj_t *wifiStatusLabel;
-  lv_obj_t *airportNameLabel;
-  lv_obj_t *dataAgeLabel;
-  lv_obj_t *sunriseLabel;
-  lv_obj_t *sunsetLabel;
-  lv_obj_t *bigTimeLabel;
-  lv_obj_t *bigDateLabel;
-  lv_obj_t *settingScreen;
-  lv_obj_t *ssidTextArea;
-  lv_obj_t *passwordTextArea;
-  lv_obj_t *metarIdTextArea;
-  lv_obj_t *timeOffsetTextArea;
-  lv_obj_t *keyboard;
-} uiElements;
+#define MAX_STATIONS 20
+#define WIFI_DHCP_EVERY_FAST_CONNECTS 8  // Ask the DHCP server again after this many connections with the saved address
 
 // Configuration structure
 struct Config {
   char ssid[64] = {0};
   char password[64] = {0};
-  char metarId[10] = {0};
+  char metarId[100] = {0};  // Comma separated ICAO IDs, up to MAX_STATIONS
   long timeOffset = 0;
 } config;
 
@@ -71,109 +72,296 @@ enum WifiState { DISCONNECTED, CONNECTING, CONNECTED, RECONNECTING };
 
 struct WifiManagement {
   WifiState state = DISCONNECTED;
-  unsigned long lastConnectAttempt = 0;
+  unsigned long lastConnectAttempt = 0;  // 0 connects right away
   unsigned long connectStartTime = 0;
+  bool fastConnect = false;        // The current attempt uses the saved hints
+  bool fastConnectFailed = false;  // Full scan and DHCP until the next successful connection
+  unsigned long leaseStart = 0;    // millis() when the current connection got its address from DHCP, 0 for a fast connect
 } wifiManagement;
 
-struct Weather {
-  char sunrise[9] = {0};
-  char sunset[9] = {0};
+// Hints of the last successful connection, stored in NVS. A connection to the same SSID skips the channel scan
+// and DHCP. If the access point changed, the fast attempt fails and a normal connection follows. The saved address
+// is only used while its lease runs, and only for a few connections in a row, so the DHCP server keeps seeing it in use.
+struct WifiFastConnect {
+  char ssid[sizeof(Config::ssid)];
+  uint8_t bssid[6];
+  int32_t channel;  // 0 if there are no hints
+  uint32_t ip, gateway, subnet, dns;
+  uint32_t leaseSeconds;  // As granted by the DHCP server, 0 if unknown
+  uint32_t leaseExpiry;   // UTC epoch seconds, 0 until the clock was set while the lease was known
+  uint32_t fastConnects;  // Connections with the saved address since the lease was obtained
+} wifiFastConnect;
+
+// First connection, fetch and weather frames after boot, millis() or 0 until reached. The WiFi event task sets the
+// first two. A frame counts once the lv_timer_handler() pass that drew it returned.
+struct BootTiming {
+  volatile unsigned long associated = 0;
+  volatile unsigned long gotIp = 0;
+  unsigned long firstFetch = 0;
+  unsigned long savedFrame = 0;    // Main screen with the data of the saved snapshot, the time to data with it
+  unsigned long fetchedFrame = 0;  // Main screen with fetched data, the time to data of a boot without the snapshot
+  bool savedDrawn = false;         // Set by firstWeatherFrameEvent inside lv_timer_handler()
+  bool fetchedDrawn = false;
+  bool fastConnect = false;
+} bootTiming;
+
+// Latest observation of one METAR station
+struct Station {
+  char icaoId[5] = {0};
   char airportName[100] = {0};
   float lat = 0;
   float lon = 0;
   unsigned long obsTime = 0;
-  unsigned long epochTime = 0;
-  unsigned long timeOfLastUpdate = 0;
   long localTimeOffset = 0;
-  int dataAgeMin = 0;
   int temperature = 0;
   int dewPoint = 0;
   int windSpeedKnots = 0;
   int pressure = 0;
   int relativeHumidity = 0;
   int windSpeedKmh = 0;
+  bool hasDewPoint = false;  // Not every report has them, the values are 0 without
+  bool hasPressure = false;
   bool weatherIsValid = false;
   bool utcOffsetIsValid = false;
+  MetarObservation metar;  // Decoded from the raw report
+  Forecast forecast;       // Latest TAF, issued 0 without one
+  Ephemeris ephemeris;  // Sun events of today and tomorrow, valid with the UTC offset
+};
+
+// All configured stations, fetched in one request and shown one after the other
+struct Weather {
+  Station stations[MAX_STATIONS];
+  int stationCount = 0;
+  int current = 0;  // Station shown on the main screen
+  unsigned long epochTime = 0;
+  unsigned long timeOfLastUpdate = 0;
+  int dataAgeMin = 0;
+  bool weatherIsValid = false;  // At least one station has valid data
+  bool restored = false;        // The data comes from the saved snapshot, no fetch succeeded since boot
+  bool fetchPending = false;    // A request is with the network task, no result yet
+  unsigned long fetchRequestedAt = 0;
+  unsigned long fetchesDroppedSeen = 0;  // fetchesDropped when fetchPending was last cleared for it
 } weather;
 
-// Trim whitespace from string in-place
-void trim(char *str) {
-  char *start = str;
-  while (isspace((unsigned char)*start)) start++;
-  size_t len = strlen(start);
-  while (len > 0 && isspace((unsigned char)start[len - 1])) len--;
-  start[len] = '\0';
-  memmove(str, start, len + 1);
-}
-
-// Normalize string by replacing accented characters in-place
-char *normalizeString(char *str) {
-  static const char *rep[][2] = {
-    {"á","a"},{"à","a"},{"â","a"},{"ã","a"},{"ä","a"},{"æ","a"},{"Á","A"},{"À","A"},
-    {"Â","A"},{"Ã","A"},{"Ä","A"},{"Æ","A"},
-    {"é","e"},{"è","e"},{"ê","e"},{"ë","e"},{"É","E"},{"È","E"},{"Ê","E"},{"Ë","E"},
-    {"í","i"},{"ì","i"},{"î","i"},{"ï","i"},{"Í","I"},{"Ì","I"},{"Î","I"},{"Ï","I"},
-    {"ó","o"},{"ò","o"},{"ô","o"},{"õ","o"},{"ö","o"},{"œ","o"},{"Ó","O"},{"Ò","O"},
-    {"Ô","O"},{"Õ","O"},{"Ö","O"},{"Œ","O"},
-    {"ú","u"},{"ù","u"},{"û","u"},{"ü","u"},{"Ú","U"},{"Ù","U"},{"Û","U"},{"Ü","U"},
-    {"ñ","n"},{"Ñ","N"},{"ç","c"},{"Ç","C"},{"ÿ","y"},{"Ÿ","Y"},{"ß","s"},{"ẞ","S"}
-  };   
-  for (char* p = str; *p;) {
-    int replaced = 0;
-    for (size_t i = 0; i < sizeof(rep) / sizeof(rep[0]); i++) {
-      size_t l = strlen(rep[i][0]);
-      if (!strncmp(p, rep[i][0], l)) {
-        *p = *rep[i][1];
-        memmove(p + 1, p + l, strlen(p + l) + 1);
-        replaced = 1;
-        break;
-      }
-    }
-    if (!replaced)
-      p++;
-  }
-  return str;
+// NTP time has arrived, before that epochTime is 0 or counts from 1970
+bool clockIsSet() { return weather.epochTime > 946684800UL; }  // 2000-01-01
+
+// Observation history of each station, parallel to weather.stations. HISTORY_STATIONS rings allocated once in setup(),
+// so the memory is fixed however long the station runs. Boards with PSRAM keep one per station there, the others only
+// one in internal RAM for the first station of the list. Stays nullptr without the memory, the station then runs
+// without trend arrows and chart.
+#ifdef BOARD_HAS_PSRAM
+#define HISTORY_STATIONS MAX_STATIONS
+#else
+#define HISTORY_STATIONS 1
+#endif
+History *stationHistory = nullptr;
+
+// History of station i, nullptr if it has none
+History *historyOf(int i) { return stationHistory && i < HISTORY_STATIONS ? &stationHistory[i] : nullptr; }
+
+// Add the report of station i to its history, values missing from the report stay out of the trends and the chart
+void appendHistory(int i, const Station &station) {
+  History *history = historyOf(i);
+  if (!history) return;
+  historyAppend(*history, station.obsTime, station.temperature, station.hasDewPoint ? station.dewPoint : HISTORY_NONE, station.windSpeedKnots,
+                station.hasPressure ? station.pressure : HISTORY_NONE);
 }
 
-// Update label text with formatted string
-void updateLabel(lv_obj_t *label, const char *format, ...) {
-  char buffer[128];
-  va_list args;
-  va_start(args, format);
-  vsnprintf(buffer, sizeof(buffer), format, args);
-  va_end(args);
-  lv_label_set_text(label, buffer);
+// Upstream HTTPS connections, aviationweather.gov stays open between refreshes. Only used by the network task.
+HostConnection metarConnection("aviationweather.gov");
+HostConnection timeApiConnection("timeapi.io", false);  // Only on a cache miss or a DST transition, not worth a TLS session in RAM
+
+// Fetch request from the UI to the network task, carries copies so the task never reads UI state
+struct FetchRequest {
+  char metarId[sizeof(Config::metarId)] = {0};
+  unsigned long nowUtc = 0;
+  bool fetch = true;             // false: no fetch, only release the idle connection if the next fetch is too far away
+  unsigned long nextFetchMs = 0;
+};
+
+// Result of one fetch, filled by the network task in a mailbox slot and applied by the UI
+struct WeatherSnapshot {
+  char metarId[sizeof(Config::metarId)] = {0};  // Station list the snapshot was fetched for
+  Station stations[MAX_STATIONS];
+  int stationCount = 0;
+  unsigned long fetchedAt = 0;  // UTC epoch seconds of the request
+  unsigned long durationMs = 0;
+  bool weatherIsValid = false;
+  bool forecastsFetched = false;  // The TAFs were fetched with it, otherwise the stations keep theirs
+};
+
+// Snapshots in flight. Each holds all stations, so without PSRAM there is only one, allocated in setup() instead of
+// taking .bss: the network task then waits for the UI to apply the last result before it starts the next fetch.
+#ifdef BOARD_HAS_PSRAM
+#define WEATHER_MAILBOX_SLOTS 2
+#else
+#define WEATHER_MAILBOX_SLOTS 1
+#endif
+
+// UI (core ARDUINO_RUNNING_CORE) and network task (other core) only share these
+QueueHandle_t fetchRequestQueue;
+SpscMailbox<WeatherSnapshot> weatherMailbox;
+std::atomic<bool> networkBusy(false);
+std::atomic<bool> networkHold(false);              // The UI takes the WiFi down, no new fetch may start
+std::atomic<unsigned long> fetchesDropped(0);      // Requests the network task took but did not fetch, no result follows
+
+lv_timer_t *updateWeatherTimer;
+
+// Polling schedule of each station, parallel to weather.stations, and how well it does
+struct Polling {
+  StationPoll stations[MAX_STATIONS];
+  unsigned long lastPollUtc = 0;  // Request time of the last successful fetch
+  unsigned long nextPollUtc = 0;  // 0 fetches on the next tick
+  PollStats stats;                // Latency from the estimated release of a new report
+} polling;
+
+// Worst gap between two passes of loop(), compared against the LVGL refresh period
+struct LoopStats {
+  unsigned long maxStallMs = 0;             // Since boot
+  unsigned long maxStallDuringFetchMs = 0;  // While the network task was busy with the current request
+  unsigned long worstFetchStallMs = 0;      // Largest maxStallDuringFetchMs of all fetches
+  unsigned long fetches = 0;
+  unsigned long fetchesOverFramePeriod = 0;
+} loopStats;
+
+// Sample invalidated pixels per second, log a summary every minute
+void redrawStatsCallback(lv_timer_t *timer) {
+  unsigned long pixels = redrawStats.invalidatedPixels;
+  redrawStats.invalidatedPixels = 0;
+  redrawStats.pixelsPerSecondSum += pixels;
+  if (pixels > redrawStats.pixelsPerSecondMax) redrawStats.pixelsPerSecondMax = pixels;
+  if (++redrawStats.samples < 60) return;
+  log_i("Redraw: avg %lu px/s, max %lu px/s, %lu label updates, %lu unchanged skipped", redrawStats.pixelsPerSecondSum / redrawStats.samples,
+        redrawStats.pixelsPerSecondMax, redrawStats.labelUpdates, redrawStats.labelUpdatesSkipped);
+  redrawStats = RedrawStats();
 }
 
-// Save configuration settings
+// Settings record as it is in flash, and how it got there
+struct ConfigStore {
+  ConfigRecord record;
+  bool stored = false;             // record is what flash holds
+  unsigned long loadUs = 0;        // Boot: opening NVS and reading the record
+  unsigned long writes = 0;        // Since boot, the lifetime count is in the record
+  unsigned long writesSkipped = 0; // Save without a change
+} configStore;
+
+static_assert(sizeof(Config::ssid) == sizeof(ConfigRecord::ssid) && sizeof(Config::password) == sizeof(ConfigRecord::password) &&
+                  sizeof(Config::metarId) == sizeof(ConfigRecord::metarId),
+              "Config and ConfigRecord strings differ in size");
+
+// Write the settings record, only if a setting differs from the one in flash
 void saveConfigurations() {
+  ConfigRecord record = configStore.record;
+  strlcpy(record.ssid, config.ssid, sizeof(record.ssid));
+  strlcpy(record.password, config.password, sizeof(record.password));
+  strlcpy(record.metarId, config.metarId, sizeof(record.metarId));
+  record.timeOffset = config.timeOffset;
+  if (configStore.stored && configRecordSameSettings(record, configStore.record)) {
+    configStore.writesSkipped++;
+    log_i("Configuration unchanged, not written (%lu skipped, %lu writes in total)", configStore.writesSkipped,
+          (unsigned long)configStore.record.writeCount);
+    return;
+  }
+  record.writeCount++;
+  configRecordSeal(record);
+  unsigned long start = millis();
+  Preferences preferences;
+  preferences.begin("config", false);
+  size_t written = preferences.putBytes(CONFIG_RECORD_KEY, &record, sizeof(record));
+  preferences.end();
+  if (written != sizeof(record)) {
+    log_i("Saving configuration failed");
+    return;
+  }
+  configStore.record = record;
+  configStore.stored = true;
+  configStore.writes++;
+  log_i("Saved configuration in %lu ms: SSID: \"%s\", password %s, METAR ID: \"%s\", Time Offset: %ld, write %lu (%lu since boot)",
+        millis() - start, config.ssid, config.password[0] ? "set" : "empty", config.metarId, config.timeOffset,
+        (unsigned long)record.writeCount, configStore.writes);
+}
+
+// Take over the settings of a record
+void applyConfigRecord(const ConfigRecord &record) {
+  strlcpy(config.ssid, record.ssid, sizeof(config.ssid));
+  strlcpy(config.password, record.password, sizeof(config.password));
+  strlcpy(config.metarId, record.metarId, sizeof(config.metarId));
+  config.timeOffset = record.timeOffset;
+}
+
+// Settings of firmware before the record, one key each. Read once, written as a record and removed.
+bool migrateConfigKeys() {
+  ConfigKeys keys;
   Preferences preferences;
   preferences.begin("config", false);
-  preferences.putString("ssid", config.ssid);
-  preferences.putString("password", config.password);
-  preferences.putString("metar_id", config.metarId);
-  preferences.putInt("time_offset", config.timeOffset);
+  keys.present = preferences.isKey("ssid") || preferences.isKey("metar_id");
+  if (keys.present) {
+    preferences.getString("ssid", keys.ssid, sizeof(keys.ssid));
+    preferences.getString("password", keys.password, sizeof(keys.password));
+    preferences.getString("metar_id", keys.metarId, sizeof(keys.metarId));
+    keys.timeOffset = preferences.getInt("time_offset");
+  }
+  preferences.end();
+  ConfigRecord record = configStore.record;
+  if (!configRecordMigrate(record, keys)) return false;
+  applyConfigRecord(record);
+  saveConfigurations();
+  if (!configStore.stored) return true;  // Not written, the keys are tried again next boot
+  preferences.begin("config", false);
+  preferences.remove("ssid");
+  preferences.remove("password");
+  preferences.remove("metar_id");
+  preferences.remove("time_offset");
   preferences.end();
-  log_i("Saved configurations: SSID: \"%s\", Password: \"%s\", METAR ID: \"%s\", Time Offset: \"%i\"", config.ssid, config.password, config.metarId,
-        config.timeOffset);
+  log_i("Migrated configuration keys to the settings record");
+  return true;
 }
 
-// Load configuration settings
+// Load the settings record with one read, the defaults stay if there is none
 void loadConfigurations() {
+  unsigned long start = micros();
   Preferences preferences;
   preferences.begin("config", true);
-  preferences.getString("ssid", config.ssid, sizeof(config.ssid));
-  preferences.getString("password", config.password, sizeof(config.password));
-  preferences.getString("metar_id", config.metarId, sizeof(config.metarId));
-  config.timeOffset = preferences.getInt("time_offset");
+  ConfigRecord record;
+  size_t len = preferences.getBytes(CONFIG_RECORD_KEY, &record, sizeof(record));
   preferences.end();
-  log_i("Loaded configurations: SSID: \"%s\", Password: \"%s\", METAR ID: \"%s\", Time Offset: \"%i\"", config.ssid, config.password, config.metarId,
-        config.timeOffset);
+  configStore.loadUs = micros() - start;
+  ConfigRecordStatus status = configRecordCheck(record, len);
+  bool migrated = false;
+  if (status == CONFIG_RECORD_OK) {
+    configStore.record = record;
+    configStore.stored = true;
+    applyConfigRecord(record);
+  } else if (status == CONFIG_RECORD_MISSING) {
+    migrated = migrateConfigKeys();
+  }
+  log_i("Settings record %s%s: read in %lu us, boot load %lu us in total, %lu writes over the lifetime", configRecordStatusName(status),
+        migrated ? ", migrated from the old keys" : "", configStore.loadUs, micros() - start, (unsigned long)configStore.record.writeCount);
+  log_i("Loaded configuration: SSID: \"%s\", password %s, METAR ID: \"%s\", Time Offset: %ld", config.ssid,
+        config.password[0] ? "set" : "empty", config.metarId, config.timeOffset);
 }
 
-// Event handler for settings button
-void settingsButtonEvent(lv_event_t *e) {
-  if (lv_event_get_code(e) == LV_EVENT_CLICKED) lv_disp_load_scr(uiElements.settingScreen);
+// Set up the station table from the configured ID list, fetched data is kept for stations still in the list
+void loadStationList() {
+  Station *stations = weather.stations;
+  int count = 0;
+  char list[sizeof(config.metarId)];
+  strlcpy(list, config.metarId, sizeof(list));
+  char *save = nullptr;
+  for (char *id = strtok_r(list, ",", &save); id && count < MAX_STATIONS; id = strtok_r(nullptr, ",", &save)) {
+    if (strcmp(stations[count].icaoId, id) != 0) {
+      stations[count] = Station();
+      strlcpy(stations[count].icaoId, id, sizeof(stations[count].icaoId));
+      if (History *history = historyOf(count)) historyReset(*history);
+      polling.stations[count] = StationPoll();
+    }
+    count++;
+  }
+  weather.stationCount = count;
+  if (weather.current >= count) weather.current = 0;
+  weather.weatherIsValid = false;  // Fetch again for the new list
+  polling.nextPollUtc = 0;
 }
 
 void backButtonEvent(lv_event_t *e) {
@@ -187,43 +375,183 @@ void backButtonEvent(lv_event_t *e) {
     trim(tempBuf);
     strlcpy(config.password, tempBuf, sizeof(config.password));
 
-    char metarBuf[10];
+    char metarBuf[sizeof(config.metarId)];
     strlcpy(metarBuf, lv_textarea_get_text(uiElements.metarIdTextArea), sizeof(metarBuf));
-    trim(metarBuf);
-    for (char *p = metarBuf; *p; p++) *p = toupper((unsigned char)*p);
-    strlcpy(config.metarId, metarBuf, 5);  // First 4 characters
+    normalizeStationList(metarBuf, MAX_STATIONS);
+    strlcpy(config.metarId, metarBuf, sizeof(config.metarId));
+    lv_textarea_set_text(uiElements.metarIdTextArea, config.metarId);
 
     const char *offsetText = lv_textarea_get_text(uiElements.timeOffsetTextArea);
     config.timeOffset = strtol(offsetText, nullptr, 10);
 
     saveConfigurations();
+    loadStationList();
     timeClient.setTimeOffset(config.timeOffset);
     lv_disp_load_scr(uiElements.mainScreen);
   }
 }
 
+void loadWifiFastConnect() {
+  Preferences preferences;
+  preferences.begin("config", true);
+  if (preferences.getBytes("wifi_fast", &wifiFastConnect, sizeof(wifiFastConnect)) != sizeof(wifiFastConnect))
+    wifiFastConnect = WifiFastConnect();
+  preferences.end();
+}
+
+void writeWifiFastConnect() {
+  Preferences preferences;
+  preferences.begin("config", false);
+  preferences.putBytes("wifi_fast", &wifiFastConnect, sizeof(wifiFastConnect));
+  preferences.end();
+}
+
+// The DHCP state belongs to the lwIP thread, it is read there
+struct DhcpLeaseCall {
+  struct tcpip_api_call_data call;  // First, tcpip_api_call() hands it back to the function
+  struct netif *netif;
+  uint32_t seconds;
+};
+
+static err_t readDhcpLease(struct tcpip_api_call_data *call) {
+  DhcpLeaseCall *lease = (DhcpLeaseCall *)call;
+  struct dhcp *dhcp = netif_dhcp_data(lease->netif);
+  lease->seconds = dhcp && dhcp->state == DHCP_STATE_BOUND ? dhcp->offered_t0_lease : 0;
+  return ERR_OK;
+}
+
+// Lease time of the address DHCP gave the station interface, 0 if it has none
+uint32_t dhcpLeaseSeconds() {
+  esp_netif_t *netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+  struct netif *lwipNetif = netif ? (struct netif *)esp_netif_get_netif_impl(netif) : nullptr;
+  if (!lwipNetif) return 0;
+  DhcpLeaseCall lease = {};
+  lease.netif = lwipNetif;
+  return tcpip_api_call(readDhcpLease, &lease.call) == ERR_OK ? lease.seconds : 0;
+}
+
+// UTC end of a lease obtained at millis() start, 0 without a clock or for an infinite lease
+uint32_t wifiLeaseExpiry(uint32_t leaseSeconds, unsigned long start) {
+  if (!clockIsSet() || !leaseSeconds || leaseSeconds == UINT32_MAX) return 0;
+  return weather.epochTime - config.timeOffset - (millis() - start) / 1000 + leaseSeconds;
+}
+
+// The lease of the saved address ran out, known only with a clock
+bool wifiLeaseExpired() {
+  return wifiFastConnect.leaseExpiry && clockIsSet() && weather.epochTime - config.timeOffset >= wifiFastConnect.leaseExpiry;
+}
+
+// At boot the clock is set after the connection, the lease obtained then gets its expiry now
+void saveWifiLeaseExpiry() {
+  if (!wifiManagement.leaseStart || wifiFastConnect.leaseExpiry) return;
+  wifiFastConnect.leaseExpiry = wifiLeaseExpiry(wifiFastConnect.leaseSeconds, wifiManagement.leaseStart);
+  if (!wifiFastConnect.leaseExpiry) return;
+  writeWifiFastConnect();
+  log_i("WiFi DHCP lease of %lu s expires at %lu", (unsigned long)wifiFastConnect.leaseSeconds, (unsigned long)wifiFastConnect.leaseExpiry);
+}
+
+// Remember BSSID, channel, IP configuration and lease of the connection, written only if they changed
+void saveWifiFastConnect() {
+  WifiFastConnect hints = WifiFastConnect();
+  strlcpy(hints.ssid, config.ssid, sizeof(hints.ssid));
+  memcpy(hints.bssid, WiFi.BSSID(), sizeof(hints.bssid));
+  hints.channel = WiFi.channel();
+  hints.ip = WiFi.localIP();
+  hints.gateway = WiFi.gatewayIP();
+  hints.subnet = WiFi.subnetMask();
+  hints.dns = WiFi.dnsIP(0);
+  if (wifiManagement.fastConnect) {
+    wifiManagement.leaseStart = 0;
+    hints.leaseSeconds = wifiFastConnect.leaseSeconds;
+    hints.leaseExpiry = wifiFastConnect.leaseExpiry;
+    hints.fastConnects = wifiFastConnect.fastConnects + 1;
+  } else {
+    wifiManagement.leaseStart = millis();
+    hints.leaseSeconds = dhcpLeaseSeconds();
+    hints.leaseExpiry = wifiLeaseExpiry(hints.leaseSeconds, wifiManagement.leaseStart);
+    hints.fastConnects = 0;
+  }
+  if (strcmp(hints.ssid, wifiFastConnect.ssid) == 0 && memcmp(hints.bssid, wifiFastConnect.bssid, sizeof(hints.bssid)) == 0 &&
+      hints.channel == wifiFastConnect.channel && hints.ip == wifiFastConnect.ip && hints.gateway == wifiFastConnect.gateway &&
+      hints.subnet == wifiFastConnect.subnet && hints.dns == wifiFastConnect.dns && hints.leaseSeconds == wifiFastConnect.leaseSeconds &&
+      hints.leaseExpiry == wifiFastConnect.leaseExpiry && hints.fastConnects == wifiFastConnect.fastConnects)
+    return;
+  wifiFastConnect = hints;
+  writeWifiFastConnect();
+  log_i("Saved WiFi fast connect hints: channel %d, %s, lease %lu s, %lu fast connects", wifiFastConnect.channel,
+        WiFi.localIP().toString().c_str(), (unsigned long)wifiFastConnect.leaseSeconds, (unsigned long)wifiFastConnect.fastConnects);
+}
+
+// Take the WiFi down from the UI, but not under a running fetch: returns false while the network task is busy, the
+// caller tries again on its next tick. No new fetch starts in the meantime.
+bool disconnectWifi() {
+  networkHold = true;
+  if (networkBusy) return false;
+  WiFi.disconnect();
+  return true;
+}
+
+// Join the configured network, with the saved hints if they belong to it
+void startWifiConnection() {
+  networkHold = false;
+  wifiManagement.fastConnect = !wifiManagement.fastConnectFailed && wifiFastConnect.channel && strcmp(wifiFastConnect.ssid, config.ssid) == 0;
+  // DHCP again once the lease ran out or the saved address was used for enough connections
+  if (wifiManagement.fastConnect && (wifiLeaseExpired() || wifiFastConnect.fastConnects >= WIFI_DHCP_EVERY_FAST_CONNECTS)) {
+    log_i("WiFi lease of the saved address is due, connecting with DHCP");
+    wifiManagement.fastConnect = false;
+  }
+  if (wifiManagement.fastConnect) {
+    log_i("Starting WiFi fast connect to %s on channel %d", config.ssid, wifiFastConnect.channel);
+    WiFi.config(IPAddress(wifiFastConnect.ip), IPAddress(wifiFastConnect.gateway), IPAddress(wifiFastConnect.subnet),
+                IPAddress(wifiFastConnect.dns));
+    WiFi.begin(config.ssid, config.password, wifiFastConnect.channel, wifiFastConnect.bssid);
+  } else {
+    log_i("Starting WiFi connection to %s", config.ssid);
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);  // Back to DHCP
+    WiFi.begin(config.ssid, config.password);
+  }
+  if (!bootTiming.associated) bootTiming.fastConnect = wifiManagement.fastConnect;
+  wifiManagement.connectStartTime = millis();
+  wifiManagement.lastConnectAttempt = millis();
+  wifiManagement.state = CONNECTING;
+}
+
+// WiFi event task: timestamps of the first connection after boot
+void wifiBootTimingEvent(WiFiEvent_t event) {
+  if (event == ARDUINO_EVENT_WIFI_STA_CONNECTED && !bootTiming.associated) bootTiming.associated = millis();
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP && !bootTiming.gotIp) bootTiming.gotIp = millis();
+}
+
 void wifiManagementCallback(lv_timer_t *timer) {
   lv_obj_t *currentScreen = lv_disp_get_scr_act(NULL);
   if (currentScreen == uiElements.mainScreen) {
     switch (wifiManagement.state) {
       case DISCONNECTED:
-        if (millis() - wifiManagement.lastConnectAttempt >= 10000) {
-          log_i("Starting WiFi connection to %s", config.ssid);
-          WiFi.begin(config.ssid, config.password);
-          wifiManagement.connectStartTime = millis();
-          wifiManagement.lastConnectAttempt = millis();
-          wifiManagement.state = CONNECTING;
+        if (!wifiManagement.lastConnectAttempt || millis() - wifiManagement.lastConnectAttempt >= 10000) {
+          startWifiConnection();
           updateLabel(uiElements.wifiStatusLabel, LV_SYMBOL_WIFI " Connecting...");
         } else
           updateLabel(uiElements.wifiStatusLabel, LV_SYMBOL_CLOSE " Disconnected");
         break;
-      case CONNECTING:
-        if (WiFi.status() == WL_CONNECTED) {
+      case CONNECTING: {
+        // The fast path either joins within a few seconds or the hints are stale
+        unsigned long timeout = wifiManagement.fastConnect ? 5000 : 10000;
+        wl_status_t status = WiFi.status();
+        if (status == WL_CONNECTED) {
           wifiManagement.state = CONNECTED;
+          wifiManagement.fastConnectFailed = false;
           char ssidBuf[64];
           strlcpy(ssidBuf, WiFi.SSID().c_str(), sizeof(ssidBuf));
-          log_i("WiFi: Connected to %s with %d dBm", ssidBuf, WiFi.RSSI());
-        } else if (millis() - wifiManagement.connectStartTime >= 10000) {
+          log_i("WiFi: Connected to %s with %d dBm after %lu ms%s", ssidBuf, WiFi.RSSI(), millis() - wifiManagement.connectStartTime,
+                wifiManagement.fastConnect ? " (fast connect)" : "");
+          saveWifiFastConnect();
+        } else if (wifiManagement.fastConnect && (status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL ||
+                                                  millis() - wifiManagement.connectStartTime >= timeout)) {
+          log_i("WiFi fast connect failed, falling back to a full scan");
+          WiFi.disconnect();
+          wifiManagement.fastConnectFailed = true;
+          startWifiConnection();
+        } else if (millis() - wifiManagement.connectStartTime >= timeout) {
           log_i("WiFi connection timeout");
           WiFi.disconnect();
           wifiManagement.state = DISCONNECTED;
@@ -231,11 +559,24 @@ void wifiManagementCallback(lv_timer_t *timer) {
         } else
           updateLabel(uiElements.wifiStatusLabel, LV_SYMBOL_WIFI " Connecting...");
         break;
+      }
       case CONNECTED:
         if (WiFi.status() != WL_CONNECTED) {
           wifiManagement.state = RECONNECTING;
           log_i("WiFi connection lost");
+          // Whoever reconnects, the driver or RECONNECTING, asks the DHCP server: the link may come back elsewhere.
+          // Only a connection begun with the hints counts as a fast connect.
+          if (wifiManagement.fastConnect) {
+            WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+            wifiManagement.fastConnect = false;
+          }
           updateLabel(uiElements.wifiStatusLabel, LV_SYMBOL_CLOSE " Connection Lost");
+        } else if (wifiManagement.fastConnect && wifiLeaseExpired()) {
+          // The saved address is no longer ours, the next connection asks the DHCP server
+          if (!disconnectWifi()) break;
+          log_i("WiFi lease of the saved address expired, reconnecting");
+          wifiManagement.state = DISCONNECTED;
+          wifiManagement.lastConnectAttempt = 0;
         } else {
           char ssidBuf[64];
           strlcpy(ssidBuf, WiFi.SSID().c_str(), sizeof(ssidBuf));
@@ -243,8 +584,12 @@ void wifiManagementCallback(lv_timer_t *timer) {
         }
         break;
       case RECONNECTING:
-        if (millis() - wifiManagement.lastConnectAttempt >= 10000) {
+        if (WiFi.status() == WL_CONNECTED) {
+          // The driver reconnected by itself, with DHCP since the link loss
+          wifiManagement.state = CONNECTING;
+        } else if (millis() - wifiManagement.lastConnectAttempt >= 10000) {
           log_i("Attempting to reconnect WiFi");
+          networkHold = false;
           WiFi.reconnect();
           wifiManagement.connectStartTime = millis();
           wifiManagement.lastConnectAttempt = millis();
@@ -256,322 +601,88 @@ void wifiManagementCallback(lv_timer_t *timer) {
     }
   } else if (currentScreen == uiElements.settingScreen) {
     if (WiFi.status() == WL_CONNECTED) {
+      if (!disconnectWifi()) return;  // After the fetch
       log_i("Disconnecting WiFi (settings screen active)");
-      WiFi.disconnect();
     }
     wifiManagement.state = DISCONNECTED;
     updateLabel(uiElements.wifiStatusLabel, LV_SYMBOL_CLOSE " Disconnected");
   }
 }
 
-// Show keyboard for text area input
-void showKeyboard(lv_event_t *e, lv_obj_t *textArea) {
-  if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
-    lv_keyboard_set_textarea(uiElements.keyboard, textArea);
-    lv_obj_clear_flag(uiElements.keyboard, LV_OBJ_FLAG_HIDDEN);
-  }
-}
-
-// Event handlers for text areas
-void ssidTextAreaEvent(lv_event_t *e) { showKeyboard(e, uiElements.ssidTextArea); }
-void passwordTextAreaEvent(lv_event_t *e) { showKeyboard(e, uiElements.passwordTextArea); }
-void metarIdTextAreaEvent(lv_event_t *e) { showKeyboard(e, uiElements.metarIdTextArea); }
-void timeOffsetTextAreaEvent(lv_event_t *e) { showKeyboard(e, uiElements.timeOffsetTextArea); }
-
-// Handle keyboard events
-void keyboardEvent(lv_event_t *e) {
-  if (lv_event_get_code(e) == LV_EVENT_READY || lv_event_get_code(e) == LV_EVENT_CANCEL) lv_obj_add_flag(uiElements.keyboard, LV_OBJ_FLAG_HIDDEN);
-}
-
-// Create a styled card panel
-lv_obj_t *createCard(lv_obj_t *parent, int x, int y, int w, int h) {
-  lv_obj_t *card = lv_obj_create(parent);
-  lv_obj_set_size(card, w, h);
-  lv_obj_set_pos(card, x, y);
-  lv_obj_remove_flag(card, LV_OBJ_FLAG_SCROLLABLE);
-
-  // Card styling
-  lv_obj_set_style_bg_color(card, lv_color_hex(0x1a1a1a), LV_PART_MAIN);
-  lv_obj_set_style_bg_grad_color(card, lv_color_hex(0x2a2a2a), LV_PART_MAIN);
-  lv_obj_set_style_bg_grad_dir(card, LV_GRAD_DIR_VER, LV_PART_MAIN);
-  lv_obj_set_style_radius(card, 10, LV_PART_MAIN);
-  lv_obj_set_style_border_width(card, 1, LV_PART_MAIN);
-  lv_obj_set_style_border_color(card, lv_color_hex(0x444444), LV_PART_MAIN);
-  lv_obj_set_style_shadow_width(card, 8, LV_PART_MAIN);
-  lv_obj_set_style_shadow_color(card, lv_color_black(), LV_PART_MAIN);
-  lv_obj_set_style_shadow_opa(card, LV_OPA_50, LV_PART_MAIN);
-  lv_obj_set_style_shadow_offset_x(card, 2, LV_PART_MAIN);
-  lv_obj_set_style_shadow_offset_y(card, 2, LV_PART_MAIN);
-
-  return card;
-}
-
-// Create a styled label with icon
-lv_obj_t *createStyledLabel(lv_obj_t *parent, int x, int y, const char *text, const char *icon = nullptr) {
-  lv_obj_t *label = lv_label_create(parent);
-  lv_obj_set_pos(label, x, y);
-  char fullText[200];
-  if (icon)
-    snprintf(fullText, sizeof(fullText), "%s %s", icon, text);
-  else
-    strlcpy(fullText, text, sizeof(fullText));
-  lv_label_set_text(label, fullText);
-  lv_obj_set_style_text_color(label, lv_color_white(), LV_PART_MAIN);
-  lv_obj_set_style_text_font(label, LV_FONT_DEFAULT, LV_PART_MAIN);
-  return label;
-}
-
-// Create a gradient button with icon
-lv_obj_t *createGradientButton(lv_obj_t *parent, int x, int y, int w, int h, const char *text, const char *icon, lv_event_cb_t eventCb) {
-  lv_obj_t *btn = lv_button_create(parent);
-  lv_obj_set_size(btn, w, h);
-  lv_obj_set_pos(btn, x, y);
-  // Button styling
-  lv_obj_set_style_bg_color(btn, lv_color_hex(0x3366ff), LV_PART_MAIN);
-  lv_obj_set_style_bg_grad_color(btn, lv_color_hex(0x1a4dff), LV_PART_MAIN);
-  lv_obj_set_style_bg_grad_dir(btn, LV_GRAD_DIR_VER, LV_PART_MAIN);
-  lv_obj_set_style_radius(btn, 8, LV_PART_MAIN);
-  lv_obj_set_style_border_width(btn, 1, LV_PART_MAIN);
-  lv_obj_set_style_border_color(btn, lv_color_hex(0x4d79ff), LV_PART_MAIN);
-  lv_obj_set_style_shadow_width(btn, 4, LV_PART_MAIN);
-  lv_obj_set_style_shadow_color(btn, lv_color_black(), LV_PART_MAIN);
-  lv_obj_set_style_shadow_opa(btn, LV_OPA_30, LV_PART_MAIN);
-  // Pressed state
-  lv_obj_set_style_bg_color(btn, lv_color_hex(0x1a4dff), LV_PART_MAIN | LV_STATE_PRESSED);
-  lv_obj_set_style_bg_grad_color(btn, lv_color_hex(0x0d33cc), LV_PART_MAIN | LV_STATE_PRESSED);
-
-  // Label with icon
-  lv_obj_t *lbl = lv_label_create(btn);
-  lv_obj_center(lbl);
-  char fullText[64];
-  if (icon)
-    snprintf(fullText, sizeof(fullText), "%s %s", icon, text);
-  else
-    strlcpy(fullText, text, sizeof(fullText));
-  lv_label_set_text(lbl, fullText);
-  lv_obj_set_style_text_color(lbl, lv_color_white(), LV_PART_MAIN);
-  lv_obj_set_style_text_font(lbl, LV_FONT_DEFAULT, LV_PART_MAIN);
-  if (eventCb) lv_obj_add_event_cb(btn, eventCb, LV_EVENT_ALL, NULL);
-  return btn;
-}
-
-// Create a text area with modern styling
-lv_obj_t *createModernTextArea(lv_obj_t *parent, int x, int y, int w, int h, bool oneLine, bool passwordMode, lv_event_cb_t eventCb,
-                                 const char *initialText, const char *placeholder) {
-  lv_obj_t *ta = lv_textarea_create(parent);
-  lv_obj_set_size(ta, w, h);
-  lv_obj_set_pos(ta, x, y);
-  lv_textarea_set_one_line(ta, oneLine);
-  lv_textarea_set_password_mode(ta, passwordMode);
-  if (placeholder) lv_textarea_set_placeholder_text(ta, placeholder);
-
-  // Modern styling
-  lv_obj_set_style_bg_color(ta, lv_color_hex(0x2a2a2a), LV_PART_MAIN);
-  lv_obj_set_style_bg_grad_color(ta, lv_color_hex(0x1a1a1a), LV_PART_MAIN);
-  lv_obj_set_style_bg_grad_dir(ta, LV_GRAD_DIR_VER, LV_PART_MAIN);
-  lv_obj_set_style_text_color(ta, lv_color_white(), LV_PART_MAIN);
-  lv_obj_set_style_radius(ta, 6, LV_PART_MAIN);
-  lv_obj_set_style_border_width(ta, 1, LV_PART_MAIN);
-  lv_obj_set_style_border_color(ta, lv_color_hex(0x444444), LV_PART_MAIN);
-  lv_obj_set_style_pad_all(ta, 8, LV_PART_MAIN);
-  // Focus styling
-  lv_obj_set_style_border_color(ta, lv_color_hex(0x3366ff), LV_PART_MAIN | LV_STATE_FOCUSED);
-  lv_obj_set_style_border_width(ta, 2, LV_PART_MAIN | LV_STATE_FOCUSED);
-  // Cursor styling
-  lv_obj_set_style_bg_color(ta, lv_color_white(), LV_PART_CURSOR);
-  if (eventCb) lv_obj_add_event_cb(ta, eventCb, LV_EVENT_ALL, NULL);
-  lv_textarea_set_text(ta, initialText);
-  return ta;
-}
-
-// Initialize main screen with improved layout and better spacing
-void mainScreenInit(void) {
-  uiElements.mainScreen = lv_obj_create(NULL);
-  lv_obj_remove_flag(uiElements.mainScreen, LV_OBJ_FLAG_SCROLLABLE);
-  lv_obj_set_style_bg_color(uiElements.mainScreen, lv_color_hex(0x0d1117), LV_PART_MAIN);
-  lv_obj_set_style_bg_grad_color(uiElements.mainScreen, lv_color_hex(0x161b22), LV_PART_MAIN);
-  lv_obj_set_style_bg_grad_dir(uiElements.mainScreen, LV_GRAD_DIR_VER, LV_PART_MAIN);
-  // Header card
-  lv_obj_t *headerCard = createCard(uiElements.mainScreen, 5, 5, 790, 80);
-  uiElements.wifiStatusLabel = createStyledLabel(headerCard, 0, -5, "Disconnected", LV_SYMBOL_CLOSE);
-  uiElements.timeDateLabel = createStyledLabel(headerCard, 0, 25, "Time: --", LV_SYMBOL_LIST);
-  createGradientButton(headerCard, 650, 0, 110, 40, "Settings", LV_SYMBOL_SETTINGS, settingsButtonEvent);
-  // Airport info card
-  lv_obj_t *airportCard = createCard(uiElements.mainScreen, 5, 90, 790, 45);
-  uiElements.airportNameLabel = createStyledLabel(airportCard, 0, -5, "Airport: --", LV_SYMBOL_HOME);
-  uiElements.dataAgeLabel = createStyledLabel(airportCard, 400, -5, "Data Age: -- min", LV_SYMBOL_REFRESH);
-  // Weather data card - left side
-  lv_obj_t *weatherCard = createCard(uiElements.mainScreen, 5, 140, 390, 185);
-  lv_obj_t *weatherTitle = createStyledLabel(weatherCard, 0, -5, "Weather Data", LV_SYMBOL_EYE_OPEN);
-  lv_obj_set_style_text_color(weatherTitle, lv_color_hex(0x3366ff), LV_PART_MAIN);
-  uiElements.temperatureLabel = createStyledLabel(weatherCard, 0, 25, "Temperature: -- °C", LV_SYMBOL_BATTERY_3);
-  uiElements.humidityLabel = createStyledLabel(weatherCard, 0, 55, "Humidity: -- %", LV_SYMBOL_TINT);
-  uiElements.windSpeedLabel = createStyledLabel(weatherCard, 0, 85, "Wind Speed: -- km/h", LV_SYMBOL_GPS);
-  uiElements.pressureLabel = createStyledLabel(weatherCard, 0, 115, "Pressure: -- hPa", LV_SYMBOL_POWER);
-  // Sun times card - right side
-  lv_obj_t *sunCard = createCard(uiElements.mainScreen, 405, 140, 390, 185);
-  lv_obj_t *sunTitle = createStyledLabel(sunCard, 0, -5, "Sun Times", LV_SYMBOL_WIFI);
-  lv_obj_set_style_text_color(sunTitle, lv_color_hex(0xffa500), LV_PART_MAIN);
-  uiElements.sunriseLabel = createStyledLabel(sunCard, 0, 25, "Sunrise: --", LV_SYMBOL_UP);
-  uiElements.sunsetLabel = createStyledLabel(sunCard, 0, 55, "Sunset: --", LV_SYMBOL_DOWN);
-  lv_obj_t *infoLabel1 = createStyledLabel(sunCard, 0, 85, "Daylight Info", nullptr);
-  lv_obj_set_style_text_color(infoLabel1, lv_color_hex(0x888888), LV_PART_MAIN);
-  // Big time date card
-  lv_obj_t *bigTimeDateCard = createCard(uiElements.mainScreen, 5, 330, 790, 95);
-  uiElements.bigTimeLabel = lv_label_create(bigTimeDateCard);
-  lv_obj_align(uiElements.bigTimeLabel, LV_ALIGN_TOP_LEFT, 0, 0);
-  lv_obj_set_style_text_color(uiElements.bigTimeLabel, lv_color_white(), LV_PART_MAIN);
-  lv_obj_set_style_text_font(uiElements.bigTimeLabel, &lv_font_montserrat_48, LV_PART_MAIN);
-  lv_label_set_text(uiElements.bigTimeLabel, "--:--:--");
-  uiElements.bigDateLabel = lv_label_create(bigTimeDateCard);
-  lv_obj_align(uiElements.bigDateLabel, LV_ALIGN_TOP_LEFT, 250, 0);
-  lv_obj_set_style_text_color(uiElements.bigDateLabel, lv_color_white(), LV_PART_MAIN);
-  lv_obj_set_style_text_font(uiElements.bigDateLabel, &lv_font_montserrat_48, LV_PART_MAIN);
-  lv_label_set_text(uiElements.bigDateLabel, "--.--.----");
-  // Status card
-  lv_obj_t *statusCard = createCard(uiElements.mainScreen, 5, 430, 790, 45);
-  lv_obj_t *statusLabel = createStyledLabel(statusCard, 0, -5, "ESP32 METAR Weather Station", LV_SYMBOL_EYE_OPEN);
-  lv_obj_set_style_text_color(statusLabel, lv_color_hex(0x3366ff), LV_PART_MAIN);
-  lv_obj_t *versionLabel = createStyledLabel(statusCard, 600, -5, "v1.0", nullptr);
-  lv_obj_set_style_text_color(versionLabel, lv_color_hex(0x888888), LV_PART_MAIN);
-}
-
-// Initialize settings screen with modern design and better spacing
-void settingScreenInit(void) {
-  uiElements.settingScreen = lv_obj_create(NULL);
-  lv_obj_remove_flag(uiElements.settingScreen, LV_OBJ_FLAG_SCROLLABLE);
-  lv_obj_set_style_bg_color(uiElements.settingScreen, lv_color_hex(0x0d1117), LV_PART_MAIN);
-  lv_obj_set_style_bg_grad_color(uiElements.settingScreen, lv_color_hex(0x161b22), LV_PART_MAIN);
-  lv_obj_set_style_bg_grad_dir(uiElements.settingScreen, LV_GRAD_DIR_VER, LV_PART_MAIN);
-  // Setting Header card
-  lv_obj_t *headerCard = createCard(uiElements.settingScreen, 5, 5, 790, 70);
-  lv_obj_t *title = createStyledLabel(headerCard, 0, 5, "Weather Station Settings", LV_SYMBOL_SETTINGS);
-  lv_obj_set_style_text_color(title, lv_color_hex(0x3366ff), LV_PART_MAIN);
-  createGradientButton(headerCard, 650, -5, 110, 40, "Save", LV_SYMBOL_SAVE, backButtonEvent);
-  // Settings card
-  lv_obj_t *formCard = createCard(uiElements.settingScreen, 5, 80, 790, 345);
-  lv_obj_t *ssidLabel = createStyledLabel(formCard, 0, -5, "WiFi Network (SSID):");
-  lv_obj_set_style_text_color(ssidLabel, lv_color_hex(0xcccccc), LV_PART_MAIN);
-  uiElements.ssidTextArea = createModernTextArea(formCard, 0, 20, 300, 35, true, false, ssidTextAreaEvent, config.ssid, "Enter WiFi SSID");
-  lv_obj_t *pwdLabel = createStyledLabel(formCard, 360, -5, "WiFi Password:");
-  lv_obj_set_style_text_color(pwdLabel, lv_color_hex(0xcccccc), LV_PART_MAIN);
-  uiElements.passwordTextArea = createModernTextArea(formCard, 360, 20, 300, 35, true, true, passwordTextAreaEvent, config.password, "Enter password");
-  lv_obj_t *metarLabel = createStyledLabel(formCard, 0, 75, "METAR ID (4 letters):");
-  lv_obj_set_style_text_color(metarLabel, lv_color_hex(0xcccccc), LV_PART_MAIN);
-  uiElements.metarIdTextArea = createModernTextArea(formCard, 0, 100, 300, 35, true, false, metarIdTextAreaEvent, config.metarId, "e.g. KJFK");
-  lv_obj_t *offsetLabel = createStyledLabel(formCard, 360, 75, "Time Offset (seconds):");
-  lv_obj_set_style_text_color(offsetLabel, lv_color_hex(0xcccccc), LV_PART_MAIN);
-  char offsetBuf[12];
-  snprintf(offsetBuf, sizeof(offsetBuf), "%ld", config.timeOffset);
-  uiElements.timeOffsetTextArea = createModernTextArea(formCard, 360, 100, 300, 35, true, false, timeOffsetTextAreaEvent, offsetBuf, "UTC offset");
-  // Help card
-  lv_obj_t *helpCard = createCard(uiElements.settingScreen, 5, 430, 790, 45);
-  lv_obj_t *helpTitle = createStyledLabel(helpCard, 0, -5, "Help:", nullptr);
-  lv_obj_set_style_text_color(helpTitle, lv_color_hex(0x3366ff), LV_PART_MAIN);
-  lv_obj_t *helpText = createStyledLabel(helpCard, 50, -5, "METAR ID: Find airport codes at wikipedia.org/wiki/ICAO_airport_code", nullptr);
-  lv_obj_set_style_text_color(helpText, lv_color_hex(0x888888), LV_PART_MAIN);
-  // Keyboard - positioned better
-  uiElements.keyboard = lv_keyboard_create(uiElements.settingScreen);
-  lv_keyboard_set_textarea(uiElements.keyboard, uiElements.ssidTextArea);
-  lv_obj_add_flag(uiElements.keyboard, LV_OBJ_FLAG_HIDDEN);
-  lv_obj_set_style_text_color(uiElements.keyboard, lv_color_white(), LV_PART_MAIN);
-  lv_obj_set_style_bg_color(uiElements.keyboard, lv_color_hex(0x1a1a1a), LV_PART_MAIN);
-  lv_obj_add_event_cb(uiElements.keyboard, keyboardEvent, LV_EVENT_ALL, NULL);
-  // Position keyboard at bottom when visible
-  lv_obj_set_size(uiElements.keyboard, 770, 150);
-  lv_obj_align(uiElements.keyboard, LV_ALIGN_BOTTOM_MID, 0, -10);
-}
-
-// Initialize UI with modern theme
-void uiInit(void) {
-  lv_disp_t *display = lv_display_get_default();
-  lv_theme_t *theme = lv_theme_default_init(display, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED), true, LV_FONT_DEFAULT);
-  lv_disp_set_theme(display, theme);
-
-  mainScreenInit();
-  settingScreenInit();
-  lv_disp_load_scr(uiElements.mainScreen);
-}
-
-bool fetchWeatherData() {
-  HTTPClient http;
-  http.setTimeout(10000);
-  WiFiClientSecure client;
-  client.setInsecure();
-  char urlBuffer[100];
+// Fill one station table entry from a METAR JSON object, returns false if the object is unusable
+bool parseStation(JsonObject obj, Station &station) {
+  if (obj["icaoId"].isNull() || obj["temp"].isNull()) {
+    log_i("Invalid METAR JSON structure: missing icaoId or temp");
+    return false;
+  }
+  float lat = obj["lat"].as<float>();
+  float lon = obj["lon"].as<float>();
+  if (lat == 0 && lon == 0) {
+    log_i("Invalid lat and lon position for %s", station.icaoId);
+    return false;
+  }
+  station.temperature = obj["temp"] | 0;
+  station.dewPoint = obj["dewp"] | 0;
+  station.windSpeedKnots = obj["wspd"] | 0;
+  station.pressure = obj["altim"] | 0;
+  station.hasDewPoint = !obj["dewp"].isNull();
+  station.hasPressure = !obj["altim"].isNull();
+  station.obsTime = obj["obsTime"] | 0;
+  station.lat = lat;
+  station.lon = lon;
+  station.windSpeedKmh = station.windSpeedKnots * 1.852;
+  station.relativeHumidity = relativeHumidity(station.temperature, station.dewPoint);
+  decodeMetar(obj["rawOb"] | "", station.metar);
+  const char *name = obj["name"] | "Unknown";
+  strncpy(station.airportName, name, sizeof(station.airportName) - 1);
+  station.airportName[sizeof(station.airportName) - 1] = '\0';
+  normalizeString(station.airportName);
+  log_i("METAR %s updated: T=%d°C, WS=%dkmh, P=%dhPa, RH=%d%% Lat=%.3f,Lon=%.3f, %s", station.icaoId, station.temperature, station.windSpeedKmh,
+        station.pressure, station.relativeHumidity, station.lat, station.lon, flightCategoryName(station.metar.category));
+  return true;
+}
+
+// Fetch all stations of the snapshot with one request, returns true if at least one station was updated.
+// Runs in the network task.
+bool fetchWeatherData(WeatherSnapshot &snapshot) {
+  char urlBuffer[200];
   if (WiFi.status() != WL_CONNECTED) return false;
   if (WiFi.localIP() == IPAddress(0, 0, 0, 0)) return false;
-  snprintf(urlBuffer, sizeof(urlBuffer), "https://aviationweather.gov/api/data/metar?ids=%s&format=json", config.metarId);
+  if (snapshot.stationCount == 0) return false;
+  snprintf(urlBuffer, sizeof(urlBuffer), "https://aviationweather.gov/api/data/metar?ids=%s&format=json", snapshot.metarId);
   log_i("Fetching METAR from: %s", urlBuffer);
-  if (!http.begin(client, urlBuffer)) {
-    log_i("Failed to initialize HTTPS connection");
-    http.end();
-    return false;
-  }
-  http.setReuse(false);
-  int httpCode = http.GET();
+  int httpCode = connectionGet(metarConnection, urlBuffer);
   if (httpCode != 200) {
     char errorBuf[201] = {0};
-    int len = http.getStream().readBytes((uint8_t*)errorBuf, 200);
+    int len = metarConnection.body.readBytes((uint8_t*)errorBuf, 200);
     errorBuf[len] = '\0';
     log_i("HTTP request failed with code: %d, Response: %s", httpCode, errorBuf);
-    http.end();
+    connectionEnd(metarConnection);
     return false;
   }
-  String response = http.getString();
-  //log_i("Raw API response: %s", response.c_str());
-  http.end();
+  JsonDocument filter;
+  metarJsonFilter(filter);
+  int updated = 0;
   JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, response);
-  http.end();
-  if (error) {
-    log_i("JSON parsing failed: %s", error.c_str());
-    return false;
-  }
-  if (!doc.is<JsonArray>() || doc.as<JsonArray>().size() == 0) {
-    log_i("Invalid METAR JSON structure: not an array or empty");
-    return false;
-  }
-  JsonObject obj = doc[0].as<JsonObject>();
-  if (obj["icaoId"].isNull() || obj["temp"].isNull()) {
-    log_i("Invalid METAR JSON structure: missing icaoId or temp");
-    return false;
-  }
-  const char *newId = obj["icaoId"];
-if (strcmp(newId, config.metarId) != 0) {
-    log_i("METAR ID mismatch: expected '%s', got '%s'", config.metarId, newId);
-    return false;
-  }
-  weather.temperature = obj["temp"] | 0;
-  weather.dewPoint = obj["dewp"] | 0;
-  weather.windSpeedKnots = obj["wspd"] | 0;
-  weather.pressure = obj["altim"] | 0;
-  weather.obsTime = obj["obsTime"] | 0;
-  weather.lat = obj["lat"].as<float>();
-  weather.lon = obj["lon"].as<float>();
-  if (weather.lat == 0 && weather.lon == 0) {
-    log_i("Invalid lat and lon position");
-    return false;
-  }
-  weather.windSpeedKmh = weather.windSpeedKnots * 1.852;
-  float t = weather.temperature, d = weather.dewPoint;
-  weather.relativeHumidity = 100 * exp((17.625 * d) / (243.04 + d)) / exp((17.625 * t) / (243.04 + t));
-  const char *name = obj["name"] | "Unknown";
-  strncpy(weather.airportName, name, sizeof(weather.airportName) - 1);
-  weather.airportName[sizeof(weather.airportName) - 1] = '\0';
-  normalizeString(weather.airportName);  
-  log_i("METAR updated: T=%d°C, WS=%dkmh, P=%dhPa, RH=%d%% Lat=%.3f,Lon=%.3f", weather.temperature, weather.windSpeedKmh, weather.pressure,
-        weather.relativeHumidity, weather.lat, weather.lon);
-  log_i("Last update was =%lus, Data age =%dmin", weather.epochTime - weather.timeOfLastUpdate, weather.dataAgeMin);
-  weather.timeOfLastUpdate = weather.epochTime;
-  return true;
+  DeserializationError error = metarJsonForEach(metarConnection.body, doc, filter, [&](JsonDocument &station) {
+    const char *newId = station["icaoId"] | "";
+    int i = 0;
+    while (i < snapshot.stationCount && strcmp(newId, snapshot.stations[i].icaoId) != 0) i++;
+    if (i == snapshot.stationCount) {
+      log_i("METAR ID '%s' not in station list '%s'", newId, snapshot.metarId);
+      return;
+    }
+    snapshot.stations[i].weatherIsValid = parseStation(station.as<JsonObject>(), snapshot.stations[i]);
+    if (snapshot.stations[i].weatherIsValid) updated++;
+  });
+  if (error) log_i("METAR JSON parsing failed: %s", error.c_str());
+  connectionEnd(metarConnection);
+  log_i("%d of %d stations updated", updated, snapshot.stationCount);
+  return updated > 0;
 }
 
-// Returns true if successful, sets offset_seconds
-bool getUtcOffset(float lat, float lon, long &offsetSeconds) {
-  HTTPClient http;
-  WiFiClientSecure client;
-  client.setInsecure();
+// Returns true if successful, sets offset_seconds and validUntil (UTC epoch of the next DST transition)
+bool getUtcOffset(float lat, float lon, unsigned long nowUtc, long &offsetSeconds, unsigned long &validUntil) {
   char url[128];
   if (WiFi.status() != WL_CONNECTED) return false;
   if (WiFi.localIP() == IPAddress(0, 0, 0, 0)) return false;
@@ -581,23 +692,15 @@ bool getUtcOffset(float lat, float lon, long &offsetSeconds) {
   }
   snprintf(url, sizeof(url), "https://timeapi.io/api/TimeZone/coordinate?latitude=%.3f&longitude=%.3f", lat, lon);
   log_i("Fetching time offset from: %s", url);
-  if (!http.begin(client, url)) {
-    log_i("Failed to connect to timeapi.io");
-    http.end();
-    return false;
-  }
-  int httpCode = http.GET();
+  int httpCode = connectionGet(timeApiConnection, url);
   if (httpCode != 200) {
     log_i("timeapi.io returned HTTP %d", httpCode);
-    http.end();
+    connectionEnd(timeApiConnection);
     return false;
   }
-  String response = http.getString();
-  //log_i("Raw API response: %s", response.c_str());
-  http.end();
   JsonDocument doc;
-  DeserializationError err = deserializeJson(doc, response);
-  http.end();
+  DeserializationError err = deserializeJson(doc, timeApiConnection.body);
+  connectionEnd(timeApiConnection);
   if (err) {
     log_i("Failed to parse JSON: %s", err.c_str());
     return false;
@@ -611,124 +714,681 @@ bool getUtcOffset(float lat, float lon, long &offsetSeconds) {
     return false;
   }
   offsetSeconds = doc["currentUtcOffset"]["seconds"];
-  log_i("UTC Offset for (%.5f, %.5f) is %ld seconds", lat, lon, offsetSeconds);
+  // The offset holds until the next DST transition, zones without DST are revalidated monthly
+  validUntil = nowUtc + 30 * 86400UL;
+  unsigned long dstStart, dstEnd;
+  if ((doc["hasDayLightSaving"] | false) && parseIsoUtc(doc["dstInterval"]["dstStart"], dstStart) &&
+      parseIsoUtc(doc["dstInterval"]["dstEnd"], dstEnd)) {
+    if (nowUtc < dstStart)
+      validUntil = dstStart;
+    else if (nowUtc < dstEnd)
+      validUntil = dstEnd;
+    else
+      validUntil = nowUtc + 86400UL;  // Interval already over, ask again tomorrow
+  }
+  log_i("UTC Offset for (%.5f, %.5f) is %ld seconds, valid for %lu h", lat, lon, offsetSeconds, (validUntil - nowUtc) / 3600);
   return true;
 }
 
-#define LEAP_YEAR(Y) ((Y > 0) && !(Y % 4) && ((Y % 100) || !(Y % 400)))
-void getFormattedDate(unsigned long epoch, char *buffer, size_t size) {
-  unsigned long days = epoch / 86400L, totalDays = 0;
-  int year = 1970, month = 0;
-  static const uint8_t monthDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-  while ((totalDays += LEAP_YEAR(year) ? 366 : 365) <= days) year++;
-  days -= totalDays - (LEAP_YEAR(year) ? 366 : 365);
-  for (; month < 12 && days >= (month == 1 && LEAP_YEAR(year) ? 29 : monthDays[month]); month++) days -= month == 1 && LEAP_YEAR(year) ? 29 : monthDays[month];
-  snprintf(buffer, size, "%02lu.%02d.%04d", days + 1, month + 1, year);
-}
-
-void getFormattedTime(unsigned long epoch, char *buffer, size_t size) {
-  unsigned long timeSeconds = epoch % 86400;
-  snprintf(buffer, size, "%02u:%02u:%02u", (uint)(timeSeconds / 3600), (uint)((timeSeconds % 3600) / 60), (uint)(timeSeconds % 60));
-}
-
-void sunEvent(unsigned long timeStamp, float lat, float lon, bool isRise, long timeOffset, char *result, size_t resultSize) {
-  log_i("Sun_event input: t=%lu, lat=%.3f, lon=%.3f, rise=%d, time_offset=%ld", timeStamp, lat, lon, isRise, timeOffset);
-  constexpr double ZENITH = 90.833;
-  time_t rawTime = (time_t)timeStamp;
-  struct tm *ptm = gmtime(&rawTime);
-  int year = ptm->tm_year + 1900;
-  int month = ptm->tm_mon + 1;
-  int day = ptm->tm_mday;
-  int n1 = floor(275 * month / 9);
-  int n2 = floor((month + 9) / 12);
-  int n3 = (1 + floor((year - 4 * floor(year / 4) + 2) / 3));
-  int n = n1 - (n2 * n3) + day - 30;
-  double lngHour = lon / 15.0;
-  double approxTime = isRise ? n + ((6 - lngHour) / 24.0) : n + ((18 - lngHour) / 24.0);
-  double meanAnomaly = (0.9856 * approxTime) - 3.289;
-  double trueLong = meanAnomaly + (1.916 * sin(DEG_TO_RAD * meanAnomaly)) + (0.020 * sin(2 * DEG_TO_RAD * meanAnomaly)) + 282.634;
-  if (trueLong >= 360.0) trueLong -= 360.0;
-  if (trueLong < 0.0) trueLong += 360.0;
-  double rightAsc = RAD_TO_DEG * atan(0.91764 * tan(DEG_TO_RAD * trueLong));
-  if (rightAsc < 0.0) rightAsc += 360.0;
-  if (rightAsc >= 360.0) rightAsc -= 360.0;
-  double lQuadrant = floor(trueLong / 90.0) * 90.0;
-  double raQuadrant = floor(rightAsc / 90.0) * 90.0;
-  rightAsc = rightAsc + (lQuadrant - raQuadrant);
-  rightAsc /= 15.0;
-  double sinDec = 0.39782 * sin(DEG_TO_RAD * trueLong);
-  double cosDec = cos(asin(sinDec));
-  double cosH = (cos(DEG_TO_RAD * ZENITH) - (sinDec * sin(DEG_TO_RAD * lat))) / (cosDec * cos(DEG_TO_RAD * lat));
-  if (cosH > 1) {
-    strlcpy(result, "No sunrise", resultSize);
-    return;
+// UTC offset cache, one NVS entry per ICAO ID in the config namespace
+struct UtcOffsetCacheEntry {
+  long offsetSeconds;
+  unsigned long validUntil;
+};
+
+struct UtcOffsetCache {
+  char icao[10] = {0};
+  UtcOffsetCacheEntry entry = {0, 0};
+  unsigned long hits = 0;
+  unsigned long misses = 0;
+  unsigned long expired = 0;
+} utcOffsetCache;
+
+// Returns true and sets offsetSeconds if a cached offset for icao is still valid at nowUtc
+bool lookupUtcOffsetCache(const char *icao, unsigned long nowUtc, long &offsetSeconds) {
+  if (strcmp(utcOffsetCache.icao, icao) != 0) {
+    char key[16];
+    snprintf(key, sizeof(key), "tz_%s", icao);
+    Preferences preferences;
+    preferences.begin("config", true);
+    size_t len = preferences.getBytes(key, &utcOffsetCache.entry, sizeof(utcOffsetCache.entry));
+    preferences.end();
+    if (len != sizeof(utcOffsetCache.entry)) {
+      utcOffsetCache.icao[0] = '\0';
+      utcOffsetCache.misses++;
+      return false;
+    }
+    strlcpy(utcOffsetCache.icao, icao, sizeof(utcOffsetCache.icao));
+  }
+  if (nowUtc >= utcOffsetCache.entry.validUntil) {
+    utcOffsetCache.expired++;
+    return false;
+  }
+  utcOffsetCache.hits++;
+  offsetSeconds = utcOffsetCache.entry.offsetSeconds;
+  return true;
+}
+
+void storeUtcOffsetCache(const char *icao, long offsetSeconds, unsigned long validUntil) {
+  char key[16];
+  snprintf(key, sizeof(key), "tz_%s", icao);
+  strlcpy(utcOffsetCache.icao, icao, sizeof(utcOffsetCache.icao));
+  utcOffsetCache.entry.offsetSeconds = offsetSeconds;
+  utcOffsetCache.entry.validUntil = validUntil;
+  Preferences preferences;
+  preferences.begin("config", false);
+  preferences.putBytes(key, &utcOffsetCache.entry, sizeof(utcOffsetCache.entry));
+  preferences.end();
+}
+
+// Last known weather, kept in NVS so the first frame after boot shows real data instead of "--".
+// Written by the network task when a fetch brought a new report, restored in setup() before the UI is built.
+// Sun times are not stored, they are computed again from position, offset and the day of the report.
+#define SAVED_WEATHER_VERSION 2
+
+struct SavedStation {
+  char icaoId[5];
+  char airportName[48];  // Cut to 47 characters
+  float lat, lon;
+  uint32_t obsTime;  // 0 if the station never had a valid report
+  int32_t localTimeOffset;
+  int16_t temperature, dewPoint, windSpeedKnots, pressure;
+  bool hasDewPoint, hasPressure;
+  bool utcOffsetIsValid;
+};
+
+// Only the first stationCount entries are written. Owned by the network task once it runs.
+struct SavedWeather {
+  uint8_t version;
+  uint8_t stationCount;
+  char metarId[sizeof(Config::metarId)];  // Station list the snapshot belongs to
+  SavedStation stations[MAX_STATIONS];
+} savedWeather;
+
+size_t savedWeatherSize(int stationCount) { return offsetof(SavedWeather, stations) + stationCount * sizeof(SavedStation); }
+
+// Network task: merge the new reports of a successful fetch, write to NVS only if a report changed
+void saveWeatherSnapshot(const WeatherSnapshot &snapshot) {
+  bool changed = false;
+  if (savedWeather.version != SAVED_WEATHER_VERSION || strcmp(savedWeather.metarId, snapshot.metarId) != 0) {
+    savedWeather = SavedWeather();
+    savedWeather.version = SAVED_WEATHER_VERSION;
+    strlcpy(savedWeather.metarId, snapshot.metarId, sizeof(savedWeather.metarId));
+    savedWeather.stationCount = snapshot.stationCount;
+    changed = true;
   }
-  if (cosH < -1) {
-    strlcpy(result, "No sunset", resultSize);
+  for (int i = 0; i < snapshot.stationCount; i++) {
+    const Station &station = snapshot.stations[i];
+    SavedStation &saved = savedWeather.stations[i];
+    if (!station.weatherIsValid || station.obsTime == saved.obsTime) continue;  // No new report, the saved one stays
+    strlcpy(saved.icaoId, station.icaoId, sizeof(saved.icaoId));
+    strlcpy(saved.airportName, station.airportName, sizeof(saved.airportName));
+    saved.lat = station.lat;
+    saved.lon = station.lon;
+    saved.obsTime = station.obsTime;
+    saved.localTimeOffset = station.localTimeOffset;
+    saved.temperature = station.temperature;
+    saved.dewPoint = station.dewPoint;
+    saved.windSpeedKnots = station.windSpeedKnots;
+    saved.pressure = station.pressure;
+    saved.hasDewPoint = station.hasDewPoint;
+    saved.hasPressure = station.hasPressure;
+    saved.utcOffsetIsValid = station.utcOffsetIsValid;
+    changed = true;
+  }
+  if (!changed) return;
+  unsigned long start = millis();
+  Preferences preferences;
+  preferences.begin("config", false);
+  preferences.putBytes("weather", &savedWeather, savedWeatherSize(savedWeather.stationCount));
+  preferences.end();
+  log_i("Saved weather snapshot of %d stations, %lu bytes in %lu ms", savedWeather.stationCount,
+        (unsigned long)savedWeatherSize(savedWeather.stationCount), millis() - start);
+}
+
+// Fill the station table from the saved snapshot if it belongs to the configured station list
+void restoreWeatherSnapshot() {
+  Preferences preferences;
+  preferences.begin("config", true);
+  size_t len = preferences.getBytes("weather", &savedWeather, sizeof(savedWeather));
+  preferences.end();
+  if (len < savedWeatherSize(0) || savedWeather.version != SAVED_WEATHER_VERSION || len != savedWeatherSize(savedWeather.stationCount) ||
+      strcmp(savedWeather.metarId, config.metarId) != 0) {
+    log_i("No saved weather snapshot for '%s'", config.metarId);
+    savedWeather = SavedWeather();
     return;
   }
-  double hourAngle = isRise ? 360.0 - RAD_TO_DEG * acos(cosH) : RAD_TO_DEG * acos(cosH);
-  hourAngle /= 15.0;
-  double localMeanTime = hourAngle + rightAsc - (0.06571 * approxTime) - 6.622;
-  double utcTime = localMeanTime - lngHour;
-  while (utcTime < 0) utcTime += 24.0;
-  while (utcTime >= 24) utcTime -= 24.0;
-  unsigned long eventSec = (unsigned long)(utcTime * 3600);
-  if (timeOffset != 0) {
-    long eventLocal = (long)eventSec + (timeOffset % 86400);
-    if (eventLocal < 0) eventLocal += 86400;
-    if (eventLocal >= 86400) eventLocal -= 86400;
-    eventSec = (unsigned long)eventLocal;
+  int restored = 0;
+  for (int i = 0; i < savedWeather.stationCount && i < weather.stationCount; i++) {
+    const SavedStation &saved = savedWeather.stations[i];
+    Station &station = weather.stations[i];
+    if (!saved.obsTime || strcmp(saved.icaoId, station.icaoId) != 0) continue;
+    strlcpy(station.airportName, saved.airportName, sizeof(station.airportName));
+    station.lat = saved.lat;
+    station.lon = saved.lon;
+    station.obsTime = saved.obsTime;
+    station.localTimeOffset = saved.localTimeOffset;
+    station.temperature = saved.temperature;
+    station.dewPoint = saved.dewPoint;
+    station.windSpeedKnots = saved.windSpeedKnots;
+    station.pressure = saved.pressure;
+    station.hasDewPoint = saved.hasDewPoint;
+    station.hasPressure = saved.hasPressure;
+    station.windSpeedKmh = station.windSpeedKnots * 1.852;
+    station.relativeHumidity = relativeHumidity(station.temperature, station.dewPoint);
+    station.utcOffsetIsValid = saved.utcOffsetIsValid;
+    station.weatherIsValid = true;
+    // The clock is not set yet, the sun times are those of the day of the report
+    if (station.utcOffsetIsValid) updateEphemeris(station.ephemeris, station.obsTime, station.lat, station.lon, station.localTimeOffset);
+    appendHistory(i, station);
+    pollObserve(polling.stations[i], station.obsTime, 0, 0);  // A fetch that returns the same report is not new
+    restored++;
+  }
+  weather.weatherIsValid = weather.restored = restored > 0;
+  log_i("Restored %d of %d stations from the saved weather snapshot", restored, weather.stationCount);
+}
+
+// UTC offset of the station, from the cache until the next DST transition, otherwise from timeapi.io.
+// If timeapi.io can not be reached the offline tables answer, that result is not cached.
+bool resolveUtcOffset(const char *icao, float lat, float lon, unsigned long nowUtc, long &offsetSeconds) {
+  bool valid = lookupUtcOffsetCache(icao, nowUtc, offsetSeconds);
+  if (!valid) {
+    unsigned long validUntil;
+    valid = getUtcOffset(lat, lon, nowUtc, offsetSeconds, validUntil);
+    if (valid)
+      storeUtcOffsetCache(icao, offsetSeconds, validUntil);
+    else if ((valid = offlineUtcOffset(lat, lon, nowUtc, offsetSeconds)))
+      log_i("UTC Offset for (%.5f, %.5f) from offline tables is %ld seconds", lat, lon, offsetSeconds);
+  }
+  log_i("UTC offset cache: %lu hits, %lu misses, %lu expired", utcOffsetCache.hits, utcOffsetCache.misses, utcOffsetCache.expired);
+  return valid;
+}
+
+// TAFs are issued every 6 hours (some every 3) and amended in between, no need to fetch them with every METAR.
+// Network task only.
+#define FORECAST_INTERVAL 1800  // s
+struct ForecastFetch {
+  char metarId[sizeof(Config::metarId)] = {0};  // Station list of the last successful fetch
+  unsigned long fetchedAt = 0;
+} forecastFetch;
+
+static Forecast *lookupForecast(const char *icaoId, void *context) {
+  WeatherSnapshot &snapshot = *(WeatherSnapshot *)context;
+  for (int i = 0; i < snapshot.stationCount; i++)
+    if (strcmp(icaoId, snapshot.stations[i].icaoId) == 0) return &snapshot.stations[i].forecast;
+  return nullptr;
+}
+
+// Fetch the TAFs of all stations of the snapshot in raw text and decode them while the body comes in.
+// Only a small chunk buffer and the decoder are on the stack however long the response is, JSON would need the
+// whole forecast of a station in memory. Runs in the network task.
+bool fetchForecasts(WeatherSnapshot &snapshot) {
+  char urlBuffer[200];
+  snprintf(urlBuffer, sizeof(urlBuffer), "https://aviationweather.gov/api/data/taf?ids=%s&format=raw", snapshot.metarId);
+  log_i("Fetching TAF from: %s", urlBuffer);
+  int httpCode = connectionGet(metarConnection, urlBuffer);
+  if (httpCode != 200) {
+    log_i("TAF request failed with code: %d", httpCode);
+    connectionEnd(metarConnection);
+    return false;
+  }
+  unsigned long start = millis();
+  TafDecoder decoder;
+  tafDecoderBegin(decoder, lookupForecast, &snapshot, snapshot.fetchedAt);
+  char chunk[64];
+  size_t total = 0;
+  for (;;) {
+    int remaining = metarConnection.body.remaining();
+    if (remaining == 0) break;
+    size_t want = remaining > 0 && remaining < (int)sizeof(chunk) ? remaining : sizeof(chunk);
+    size_t len = metarConnection.body.readBytes(chunk, want);
+    if (!len) break;  // Timeout or end of a body without Content-Length
+    tafDecoderFeed(decoder, chunk, len);
+    total += len;
+  }
+  tafDecoderEnd(decoder);
+  connectionEnd(metarConnection);
+  log_i("TAF: %lu reports of %d stations, %lu bytes in %lu ms, %lu groups dropped, decoder %lu bytes", decoder.reports,
+        snapshot.stationCount, (unsigned long)total, millis() - start, decoder.droppedGroups, (unsigned long)sizeof(decoder));
+  for (int i = 0; i < snapshot.stationCount; i++)
+    if (snapshot.stations[i].forecast.droppedPeriods)
+      log_i("TAF %s: %d change groups beyond %d dropped", snapshot.stations[i].icaoId, snapshot.stations[i].forecast.droppedPeriods,
+            TAF_MAX_PERIODS);
+  return true;
+}
+
+// Network task: fetch the METAR of the requested stations and resolve their UTC offsets into a snapshot
+void fetchWeatherSnapshot(const FetchRequest &request, WeatherSnapshot &snapshot) {
+  unsigned long start = millis();
+  strlcpy(snapshot.metarId, request.metarId, sizeof(snapshot.metarId));
+  snapshot.stationCount = 0;
+  char list[sizeof(request.metarId)];
+  strlcpy(list, request.metarId, sizeof(list));
+  char *save = nullptr;
+  for (char *id = strtok_r(list, ",", &save); id && snapshot.stationCount < MAX_STATIONS; id = strtok_r(nullptr, ",", &save)) {
+    Station &station = snapshot.stations[snapshot.stationCount++];
+    station = Station();
+    strlcpy(station.icaoId, id, sizeof(station.icaoId));
+  }
+  snapshot.fetchedAt = request.nowUtc;
+  snapshot.weatherIsValid = fetchWeatherData(snapshot);
+  snapshot.forecastsFetched = false;
+  // TAF times only carry the day of month, they are placed with the date of the request
+  if (snapshot.weatherIsValid && snapshot.fetchedAt > 946684800UL &&
+      (strcmp(forecastFetch.metarId, snapshot.metarId) != 0 || snapshot.fetchedAt - forecastFetch.fetchedAt >= FORECAST_INTERVAL) &&
+      fetchForecasts(snapshot)) {
+    snapshot.forecastsFetched = true;
+    strlcpy(forecastFetch.metarId, snapshot.metarId, sizeof(forecastFetch.metarId));
+    forecastFetch.fetchedAt = snapshot.fetchedAt;
+  }
+  for (int i = 0; i < snapshot.stationCount; i++) {
+    Station &station = snapshot.stations[i];
+    station.utcOffsetIsValid =
+        station.weatherIsValid && resolveUtcOffset(station.icaoId, station.lat, station.lon, request.nowUtc, station.localTimeOffset);
+    if (!station.utcOffsetIsValid) station.localTimeOffset = 0;
+  }
+  logConnectionStats(metarConnection);
+  logConnectionStats(timeApiConnection);
+  if (snapshot.weatherIsValid) saveWeatherSnapshot(snapshot);
+  snapshot.durationMs = millis() - start;
+}
+
+// Network task, pinned to the core LVGL does not run on. Blocking HTTP requests only stall this task.
+void networkTask(void *parameter) {
+  FetchRequest request;
+  for (;;) {
+    if (xQueueReceive(fetchRequestQueue, &request, portMAX_DELAY) != pdTRUE) continue;
+    if (!request.fetch) {
+      connectionRelease(metarConnection, request.nextFetchMs);
+      continue;
+    }
+    WeatherSnapshot *snapshot = weatherMailbox.claim();
+    if (!snapshot) {
+      log_i("Weather mailbox full, fetch request dropped");
+      fetchesDropped++;
+      continue;
+    }
+    // Busy before the hold is checked, the UI sets the hold before it checks busy: one of them sees the other
+    networkBusy = true;
+    if (networkHold) {
+      networkBusy = false;
+      log_i("WiFi is going down, fetch request dropped");
+      fetchesDropped++;
+      continue;
+    }
+    fetchWeatherSnapshot(request, *snapshot);
+    networkBusy = false;
+    weatherMailbox.publish();
   }
-  snprintf(result, resultSize, "%02u:%02u:%02u", (unsigned)(eventSec / 3600), (unsigned)((eventSec % 3600) / 60), (unsigned)(eventSec % 60));
 }
 
-// Update time and date display
+ClockText clockText;
+
+// Age of the shown observation in minutes, restored data is marked as saved
+void updateDataAge() {
+  const Station &station = weather.stations[weather.current];
+  const char *saved = weather.restored ? " (saved)" : "";
+  if (weather.weatherIsValid && station.weatherIsValid && !clockIsSet()) {
+    // No age without a clock, show when the saved report was observed
+    char obsTime[12];
+    getFormattedTime(station.obsTime + station.localTimeOffset, obsTime, sizeof(obsTime));
+    obsTime[5] = '\0';  // HH:MM
+    updateLabel(uiElements.dataAgeLabel, LV_SYMBOL_REFRESH " %s%s", obsTime, saved);
+  } else if (weather.weatherIsValid && station.weatherIsValid) {
+    weather.dataAgeMin = (weather.epochTime - config.timeOffset - station.obsTime) / 60;
+    updateLabel(uiElements.dataAgeLabel, LV_SYMBOL_REFRESH " %lu min ago%s", weather.dataAgeMin, saved);
+  } else
+    updateLabel(uiElements.dataAgeLabel, LV_SYMBOL_REFRESH " -- min ago");
+}
+
+// Update time and date display, only the fields that rolled over are formatted again
 void updateTimeCallback(lv_timer_t *timer) {
   if (WiFi.status() != WL_CONNECTED) return;  // Exit if not connected to WiFi
   timeClient.update();
+  bool clockWasSet = clockIsSet();
   weather.epochTime = timeClient.getEpochTime();
-  char timeBuf[9];
-  char dateBuf[11];
-  getFormattedTime(weather.epochTime, timeBuf, sizeof(timeBuf));
-  getFormattedDate(weather.epochTime, dateBuf, sizeof(dateBuf));
-  updateLabel(uiElements.timeDateLabel, LV_SYMBOL_LIST " %s %s", timeBuf, dateBuf);
-  lv_label_set_text_fmt(uiElements.bigTimeLabel, "%s", timeBuf);
-  lv_label_set_text_fmt(uiElements.bigDateLabel, "%s", dateBuf);
-  if (weather.weatherIsValid) {
-    weather.dataAgeMin = (weather.epochTime - config.timeOffset - weather.obsTime) / 60;
-    updateLabel(uiElements.dataAgeLabel, LV_SYMBOL_REFRESH " %lu min ago", weather.dataAgeMin);
+  if (!clockWasSet && clockIsSet()) {
+    lv_timer_ready(updateWeatherTimer);  // First fetch as soon as there is a clock
+    saveWifiLeaseExpiry();
   }
+  int changed = updateClockText(clockText, weather.epochTime);
+  if (!changed) return;
+  updateLabel(uiElements.timeDateLabel, LV_SYMBOL_LIST " %s %s", clockText.time, clockText.date);
+  lv_label_set_text(uiElements.bigTimeLabel, clockText.time);
+  if (changed & CLOCK_DATE_CHANGED) lv_label_set_text(uiElements.bigDateLabel, clockText.date);
+  if (changed & CLOCK_MINUTE_CHANGED) updateDataAge();
 }
 
-// Update weather data display with enhanced visuals
-void updateWeatherCallback(lv_timer_t *timer) {
-  if (!weather.weatherIsValid || weather.dataAgeMin > 60 || weather.epochTime - weather.timeOfLastUpdate > 600) {
-    weather.weatherIsValid = fetchWeatherData();
-    weather.utcOffsetIsValid = getUtcOffset(weather.lat, weather.lon, weather.localTimeOffset);
-    if (weather.utcOffsetIsValid) {
-      sunEvent(weather.epochTime, weather.lat, weather.lon, true, weather.localTimeOffset, weather.sunrise, sizeof(weather.sunrise));
-      sunEvent(weather.epochTime, weather.lat, weather.lon, false, weather.localTimeOffset, weather.sunset, sizeof(weather.sunset));
-      log_i("Next sunrise: %s, Next sunset: %s", weather.sunrise, weather.sunset);
+// Local time "HH:MM:SS" of one of today's sun events of the station, or why there is none
+void formatSunEvent(const Station &station, SunEventType type, char *buffer, size_t size) {
+  const SolarDay &today = ephemerisToday(station.ephemeris);
+  if (today.events[type])
+    getFormattedTime(today.events[type] + station.localTimeOffset, buffer, size);
+  else
+    strlcpy(buffer, today.dayLength ? "No sunset" : "No sunrise", size);
+}
+
+// Arrow after a value, nothing until the history spans enough time
+const char *trendSymbol(TrendDirection direction) {
+  switch (direction) {
+    case TREND_RISING:
+      return " " LV_SYMBOL_UP;
+    case TREND_FALLING:
+      return " " LV_SYMBOL_DOWN;
+    case TREND_STEADY:
+      return " " LV_SYMBOL_RIGHT;
+    default:
+      return "";
+  }
+}
+
+// Wind with direction and gusts from the raw report, the speed from the JSON feed
+void formatWind(const Station &station, char *buffer, size_t size) {
+  const MetarObservation &metar = station.metar;
+  if (!metar.valid || metar.windSpeedKt < 0) {
+    snprintf(buffer, size, "%d km/h", station.windSpeedKmh);
+    return;
+  }
+  if (metar.windSpeedKt == 0) {
+    snprintf(buffer, size, "Calm");
+    return;
+  }
+  char direction[8] = "VRB";
+  if (metar.windDir >= 0) snprintf(direction, sizeof(direction), "%03d°", metar.windDir);
+  if (metar.windGustKt)
+    snprintf(buffer, size, "%s %d G%d km/h", direction, station.windSpeedKmh, (int)(metar.windGustKt * 1.852));
+  else
+    snprintf(buffer, size, "%s %d km/h", direction, station.windSpeedKmh);
+}
+
+// Flight category in the usual chart colors, the color is only set when the category changes
+void showFlightCategory(FlightCategory category) {
+  static const uint32_t colors[] = {0x9e9e9e, 0x00c853, 0x2979ff, 0xff1744, 0xd500f9};
+  static int shownCategory = -1;
+  updateLabel(uiElements.flightCategoryLabel, "%s", flightCategoryName(category));
+  if (category == shownCategory) return;
+  shownCategory = category;
+  lv_obj_set_style_text_color(uiElements.flightCategoryLabel, lv_color_hex(colors[category]), LV_PART_MAIN);
+}
+
+// Show the current station of the table on the main screen
+void showStation() {
+  const Station &station = weather.stations[weather.current];
+  History *history = historyOf(weather.current);
+  // 1 hPa in 3 hours is a noticeable pressure tendency, temperature has to move more to beat the daily cycle
+  TrendDirection temperatureTrend = history ? historyTrend(*history, history->temperatureTrend, 2.0f) : TREND_UNKNOWN;
+  TrendDirection pressureTrend = history ? historyTrend(*history, history->pressureTrend, 1.0f) : TREND_UNKNOWN;
+  updateLabel(uiElements.temperatureLabel, LV_SYMBOL_BATTERY_3 " %d°C%s", station.temperature, trendSymbol(temperatureTrend));
+  if (station.hasDewPoint)
+    updateLabel(uiElements.humidityLabel, LV_SYMBOL_TINT " %d%%", station.relativeHumidity);
+  else
+    updateLabel(uiElements.humidityLabel, LV_SYMBOL_TINT " --%%");
+  char text[48];
+  formatWind(station, text, sizeof(text));
+  updateLabel(uiElements.windSpeedLabel, LV_SYMBOL_GPS " %s", text);
+  formatMetarConditions(station.metar, text, sizeof(text));
+  updateLabel(uiElements.conditionsLabel, LV_SYMBOL_EYE_OPEN " %s", text[0] ? text : "Weather Data");
+  showFlightCategory(station.metar.category);
+  if (station.hasPressure)
+    updateLabel(uiElements.pressureLabel, LV_SYMBOL_POWER " %d hPa%s", station.pressure, trendSymbol(pressureTrend));
+  else
+    updateLabel(uiElements.pressureLabel, LV_SYMBOL_POWER " -- hPa");
+  // The chart is only redrawn for another station or a new report, not on every refresh of the labels
+  static int chartStation = -1;
+  static uint32_t chartRevision = 0;
+  if (history && (weather.current != chartStation || history->revision != chartRevision)) {
+    chartStation = weather.current;
+    chartRevision = history->revision;
+    uiShowHistory(*history);
+  }
+  if (weather.stationCount > 1)
+    updateLabel(uiElements.airportNameLabel, LV_SYMBOL_HOME " %s (%d/%d)", station.airportName, weather.current + 1, weather.stationCount);
+  else
+    updateLabel(uiElements.airportNameLabel, LV_SYMBOL_HOME " %s", station.airportName);
+  updateDataAge();
+  if (weather.weatherIsValid && station.weatherIsValid && station.utcOffsetIsValid) {
+    // Sunrise/sunset and the next twilight event, looked up from the ephemeris table
+    char sunrise[12], sunset[12], next[12];
+    formatSunEvent(station, SUN_RISE, sunrise, sizeof(sunrise));
+    formatSunEvent(station, SUN_SET, sunset, sizeof(sunset));
+    updateLabel(uiElements.sunriseLabel, LV_SYMBOL_UP " %s", sunrise);
+    updateLabel(uiElements.sunsetLabel, LV_SYMBOL_DOWN " %s", sunset);
+    long dayLength = ephemerisToday(station.ephemeris).dayLength;
+    unsigned long when;
+    SunEventType nextEvent = nextSunEvent(station.ephemeris, weather.epochTime - config.timeOffset, when);
+    if (nextEvent != SUN_EVENT_COUNT) {
+      getFormattedTime(when + station.localTimeOffset, next, sizeof(next));
+      next[5] = '\0';  // HH:MM
     } else
-      weather.localTimeOffset = 0;
-  }
-  // Update weather data with icons
-  updateLabel(uiElements.temperatureLabel, LV_SYMBOL_BATTERY_3 " %d°C", weather.temperature);
-  updateLabel(uiElements.humidityLabel, LV_SYMBOL_TINT " %d%%", weather.relativeHumidity);
-  updateLabel(uiElements.windSpeedLabel, LV_SYMBOL_GPS " %d km/h", weather.windSpeedKmh);
-  updateLabel(uiElements.pressureLabel, LV_SYMBOL_POWER " %d hPa", weather.pressure);
-  updateLabel(uiElements.airportNameLabel, LV_SYMBOL_HOME " %s", weather.airportName);
-  if (weather.weatherIsValid && weather.utcOffsetIsValid) {
-    // Calculate and display sunrise/sunset
-    updateLabel(uiElements.sunriseLabel, LV_SYMBOL_UP " %s", weather.sunrise);
-    updateLabel(uiElements.sunsetLabel, LV_SYMBOL_DOWN " %s", weather.sunset);
+      strlcpy(next, "--:--", sizeof(next));
+    updateLabel(uiElements.daylightLabel, "Day %ld:%02ld h, %s %s", dayLength / 3600, dayLength % 3600 / 60, sunEventName(nextEvent), next);
   } else {
     updateLabel(uiElements.sunriseLabel, LV_SYMBOL_UP " --:--");
     updateLabel(uiElements.sunsetLabel, LV_SYMBOL_DOWN " --:--");
-    updateLabel(uiElements.dataAgeLabel, LV_SYMBOL_REFRESH " -- min ago");
-    updateLabel(uiElements.sunriseLabel, LV_SYMBOL_UP " --:--");
-    updateLabel(uiElements.sunsetLabel, LV_SYMBOL_DOWN " --:--");
+    updateLabel(uiElements.daylightLabel, "Daylight Info");
+  }
+  if (uiElements.forecastLabel) {
+    formatForecastChange(station.forecast, weather.epochTime - config.timeOffset, text, sizeof(text));
+    updateLabel(uiElements.forecastLabel, LV_SYMBOL_BELL " %s", text[0] ? text : station.forecast.validTo ? "No change forecast" : "No forecast");
+  }
+}
+
+// Cycle the main screen through the stations with valid data
+void rotateStationCallback(lv_timer_t *timer) {
+  if (weather.stationCount < 2) return;
+  for (int i = 1; i <= weather.stationCount; i++) {
+    int next = (weather.current + i) % weather.stationCount;
+    if (weather.stations[next].weatherIsValid || i == weather.stationCount) {
+      weather.current = next;
+      break;
+    }
+  }
+  showStation();
+}
+
+// The ephemeris tables are only recomputed on a new local day or a new position
+void updateEphemerides() {
+  if (!clockIsSet()) return;  // Keep the tables of the saved snapshot
+  for (int i = 0; i < weather.stationCount; i++) {
+    Station &station = weather.stations[i];
+    if (station.utcOffsetIsValid &&
+        updateEphemeris(station.ephemeris, weather.epochTime - config.timeOffset, station.lat, station.lon, station.localTimeOffset)) {
+      char sunrise[12], sunset[12];
+      formatSunEvent(station, SUN_RISE, sunrise, sizeof(sunrise));
+      formatSunEvent(station, SUN_SET, sunset, sizeof(sunset));
+      log_i("%s sunrise: %s, sunset: %s", station.icaoId, sunrise, sunset);
+    }
+  }
+}
+
+// Take over a snapshot of the network task, the ephemeris tables of the UI are kept.
+// Returns false if the snapshot belongs to an old station list.
+bool applyWeatherSnapshot(const WeatherSnapshot &snapshot) {
+  if (strcmp(snapshot.metarId, config.metarId) != 0) {
+    log_i("Dropped weather snapshot of the old station list '%s'", snapshot.metarId);
+    return false;
+  }
+  for (int i = 0; i < snapshot.stationCount && i < weather.stationCount; i++) {
+    Station &station = weather.stations[i];
+    // Until a fetch succeeds, stations keep the data restored at boot
+    if (!snapshot.stations[i].weatherIsValid && weather.restored && station.weatherIsValid) continue;
+    Ephemeris ephemeris = station.ephemeris;
+    Forecast forecast = station.forecast;
+    station = snapshot.stations[i];
+    station.ephemeris = ephemeris;
+    if (!snapshot.forecastsFetched) station.forecast = forecast;
+    if (station.weatherIsValid) appendHistory(i, station);
+  }
+  if (snapshot.weatherIsValid) weather.restored = false;
+  weather.weatherIsValid = snapshot.weatherIsValid || weather.restored;
+  log_i("Last update was =%lus, Data age =%dmin", weather.epochTime - weather.timeOfLastUpdate, weather.dataAgeMin);
+  if (snapshot.weatherIsValid) weather.timeOfLastUpdate = weather.epochTime;
+  return true;
+}
+
+// Learn from the result of a fetch and plan the next one
+void updatePollSchedule(const WeatherSnapshot &snapshot) {
+  unsigned long nowUtc = weather.epochTime - config.timeOffset;
+  if (!snapshot.weatherIsValid) {
+    pollCountFetch(polling.stats, false, 0);
+    polling.nextPollUtc = nowUtc + POLL_RETRY_INTERVAL;
+    return;
+  }
+  int newReports = 0;
+  unsigned long next = 0;
+  for (int i = 0; i < snapshot.stationCount && i < weather.stationCount; i++) {
+    const Station &station = snapshot.stations[i];
+    if (!station.weatherIsValid) continue;
+    StationPoll &poll = polling.stations[i];
+    if (pollObserve(poll, station.obsTime, snapshot.fetchedAt, polling.lastPollUtc)) {
+      newReports++;
+      // Shown right after this, the first fetch after boot finds old reports and is not counted
+      if (polling.lastPollUtc) pollCountLatency(polling.stats, (long)(nowUtc - station.obsTime) - poll.publishDelay);
+    }
+    unsigned long due = pollNextDue(poll, snapshot.fetchedAt);
+    if (!next || due < next) next = due;
+  }
+  pollCountFetch(polling.stats, true, newReports);
+  polling.lastPollUtc = snapshot.fetchedAt;
+  polling.nextPollUtc = next ? next : nowUtc + POLL_DEFAULT_INTERVAL;
+  const PollStats &stats = polling.stats;
+  log_i("Polling: %lu requests, %lu failed, %lu wasted, %lu new reports, release to display avg %lu s max %lu s, next in %ld s",
+        stats.requests, stats.failed, stats.wasted, stats.newReports, pollAverageLatency(stats), stats.latencyMax,
+        (long)(polling.nextPollUtc - nowUtc));
+}
+
+// Poll the mailbox of the network task, cheap enough to run a few times per second
+void weatherResultCallback(lv_timer_t *timer) {
+  // A dropped request gets no result, the next one can go out at once instead of after the pending timeout
+  unsigned long dropped = fetchesDropped;
+  if (dropped != weather.fetchesDroppedSeen) {
+    weather.fetchesDroppedSeen = dropped;
+    weather.fetchPending = false;
+  }
+  WeatherSnapshot *snapshot = weatherMailbox.peek();
+  if (!snapshot) return;
+  if (applyWeatherSnapshot(*snapshot)) updatePollSchedule(*snapshot);
+  unsigned long durationMs = snapshot->durationMs;
+  if (snapshot->weatherIsValid && !bootTiming.firstFetch) {
+    bootTiming.firstFetch = millis();
+    log_i("Boot timing: associated %lu ms, IP %lu ms, first fetch %lu ms (%s)", bootTiming.associated, bootTiming.gotIp, bootTiming.firstFetch,
+          bootTiming.fastConnect ? "fast connect" : "full scan");
+  }
+  weatherMailbox.release();
+  weather.fetchPending = false;
+  // The network task releases the connection if the server would drop it before the next fetch
+  unsigned long nowUtc = weather.epochTime - config.timeOffset;
+  if (clockIsSet() && polling.nextPollUtc > nowUtc) {
+    FetchRequest release;
+    release.fetch = false;
+    release.nextFetchMs = (polling.nextPollUtc - nowUtc) * 1000UL;
+    xQueueSend(fetchRequestQueue, &release, 0);  // Not if a fetch is queued, that one uses the connection
+  }
+  // A fetch must not cost the UI a frame
+  loopStats.fetches++;
+  if (loopStats.maxStallDuringFetchMs > LV_DEF_REFR_PERIOD) loopStats.fetchesOverFramePeriod++;
+  if (loopStats.maxStallDuringFetchMs > loopStats.worstFetchStallMs) loopStats.worstFetchStallMs = loopStats.maxStallDuringFetchMs;
+  log_i("Fetch took %lu ms, UI stall during fetch %lu ms (worst %lu ms, frame period %d ms, %lu of %lu fetches over), max stall %lu ms",
+        durationMs, loopStats.maxStallDuringFetchMs, loopStats.worstFetchStallMs, LV_DEF_REFR_PERIOD, loopStats.fetchesOverFramePeriod,
+        loopStats.fetches, loopStats.maxStallMs);
+  updateEphemerides();
+  showStation();
+}
+
+// Ask the network task for new data when the poll schedule says so, the result arrives in weatherResultCallback.
+// Without a clock there is no schedule, then only missing data is fetched.
+void updateWeatherCallback(lv_timer_t *timer) {
+  bool due = clockIsSet() ? weather.epochTime - config.timeOffset >= polling.nextPollUtc : !weather.weatherIsValid;
+  // A request without result for two minutes is given up, the network task may have dropped it
+  bool pending = weather.fetchPending && millis() - weather.fetchRequestedAt < 120000;
+  if (due && !pending && weather.stationCount > 0) {
+    FetchRequest request;
+    strlcpy(request.metarId, config.metarId, sizeof(request.metarId));
+    request.nowUtc = weather.epochTime - config.timeOffset;
+    loopStats.maxStallDuringFetchMs = 0;
+    // Replaces a request the network task has not taken yet, the pending flag then stands for this one
+    if (uxQueueMessagesWaiting(fetchRequestQueue)) log_i("Fetch request replaced before the network task took it");
+    xQueueOverwrite(fetchRequestQueue, &request);
+    weather.fetchPending = true;
+    weather.fetchRequestedAt = millis();
+  }
+  updateEphemerides();
+  showStation();
+}
+
+// Power policy, applied every POWER_TICK_MS. A large redraw raises the CPU clock before the next pass of LVGL.
+#define POWER_TICK_MS 250
+#define POWER_REDRAW_PIXELS (DISPLAY_WIDTH * DISPLAY_HEIGHT / 10)  // More than the clock, less than a screen change
+#define POWER_LOG_INTERVAL_MS 600000
+PowerPolicy powerPolicy;
+unsigned long powerInvalidatedPixels = 0;  // Since the last update
+bool powerRedrawPending = false;           // Set by the invalidate event, applied in loop()
+unsigned long powerLastLogMs = 0;
+
+void updatePower() {
+  PowerInputs inputs;
+  inputs.nowMs = millis();
+  inputs.inactiveMs = lv_display_get_inactive_time(NULL);
+  inputs.redraw = powerInvalidatedPixels >= POWER_REDRAW_PIXELS;
+  powerInvalidatedPixels = 0;
+  // The modem wakes a few seconds before a fetch is due and stays awake while there is no connection
+  unsigned long nowUtc = weather.epochTime - config.timeOffset;
+  inputs.networkActive = wifiManagement.state != CONNECTED || networkBusy || weather.fetchPending ||
+                         (clockIsSet() ? nowUtc + 5 >= polling.nextPollUtc : !weather.weatherIsValid);
+  // Dimmed by the sun times of the station on the screen
+  const Station &station = weather.stations[weather.current];
+  if (clockIsSet() && station.utcOffsetIsValid) {
+    const SolarDay &today = ephemerisToday(station.ephemeris);
+    inputs.nowUtc = nowUtc;
+    inputs.sunrise = today.events[SUN_RISE];
+    inputs.sunset = today.events[SUN_SET];
+  }
+  int changed = powerUpdate(powerPolicy, inputs);
+  if (changed & POWER_CPU_CHANGED) setCpuFrequencyMhz(powerPolicy.cpuMhz);
+  if (changed & POWER_BACKLIGHT_CHANGED) smartdisplay_lcd_set_backlight(powerPolicy.backlight);
+  if (changed & POWER_MODEM_CHANGED) WiFi.setSleep(powerPolicy.modemSleep ? WIFI_PS_MAX_MODEM : WIFI_PS_NONE);
+  if (inputs.nowMs - powerLastLogMs < POWER_LOG_INTERVAL_MS) return;
+  powerLastLogMs = inputs.nowMs;
+  unsigned long total = max(1UL, inputs.nowMs / 1000);
+  log_i("Power: %s, active %lu s, idle %lu s, night %lu s, modem sleep %lu%%, %lu CPU, %lu backlight and %lu modem changes",
+        powerStateName(powerPolicy.state), powerPolicy.residencyMs[POWER_ACTIVE] / 1000, powerPolicy.residencyMs[POWER_IDLE] / 1000,
+        powerPolicy.residencyMs[POWER_NIGHT] / 1000, powerPolicy.modemSleepMs / 10 / total, powerPolicy.cpuChanges,
+        powerPolicy.backlightChanges, powerPolicy.modemChanges);
+}
+
+void powerCallback(lv_timer_t *timer) { updatePower(); }
+
+// Display event: counts the invalidated area and flags a redraw that will take a while at the idle clock.
+// Runs inside LVGL, so it changes nothing itself.
+void powerInvalidateEvent(lv_event_t *e) {
+  const lv_area_t *area = (const lv_area_t *)lv_event_get_param(e);
+  if (area) powerInvalidatedPixels += lv_area_get_size(area);
+  if (powerInvalidatedPixels >= POWER_REDRAW_PIXELS && powerPolicy.cpuMhz != POWER_CPU_ACTIVE_MHZ) powerRedrawPending = true;
+}
+
+// Display event: note the first frames of the main screen with saved and with fetched weather data, loop() logs them.
+// Unhooks itself after the fetched one.
+void firstWeatherFrameEvent(lv_event_t *e) {
+  if (!weather.weatherIsValid || lv_screen_active() != uiElements.mainScreen) return;
+  if (weather.restored) {
+    bootTiming.savedDrawn = true;
+    return;
+  }
+  bootTiming.fetchedDrawn = true;
+  lv_display_remove_event_cb_with_user_data(lv_display_get_default(), firstWeatherFrameEvent, NULL);
+}
+
+// After lv_timer_handler(): log the boot to data time of a frame drawn in that pass
+void logBootFrames() {
+  if (bootTiming.savedDrawn && !bootTiming.savedFrame) {
+    bootTiming.savedFrame = millis();
+    log_i("Boot to first frame with weather data: %lu ms (saved snapshot)", bootTiming.savedFrame);
+  }
+  if (bootTiming.fetchedDrawn && !bootTiming.fetchedFrame) {
+    bootTiming.fetchedFrame = millis();
+    log_i("Boot to first frame with weather data: %lu ms (fetched, first fetch at %lu ms)", bootTiming.fetchedFrame, bootTiming.firstFetch);
+    if (bootTiming.savedFrame)
+      log_i("Saved snapshot showed weather %lu ms earlier", bootTiming.fetchedFrame - bootTiming.savedFrame);
   }
 }
 
@@ -753,21 +1413,93 @@ void setup() {
   log_i("PSRAM free:  %u", ESP.getFreePsram());
   log_i("Heap free:   %d bytes", ESP.getFreeHeap());
   smartdisplay_init();
-  smartdisplay_lcd_set_backlight(1.0);
+  smartdisplay_lcd_set_backlight(powerPolicy.backlight);
   loadConfigurations();
+#ifdef BOARD_HAS_PSRAM
+  stationHistory = (History *)ps_malloc(HISTORY_STATIONS * sizeof(History));
+#else
+  stationHistory = (History *)malloc(HISTORY_STATIONS * sizeof(History));
+#endif
+  if (stationHistory) {
+    for (int i = 0; i < HISTORY_STATIONS; i++) historyReset(stationHistory[i]);
+    log_i("Observation history: %d reports for %d stations, %lu bytes", HISTORY_CAPACITY, HISTORY_STATIONS,
+          (unsigned long)(HISTORY_STATIONS * sizeof(History)));
+  } else
+    log_i("No memory for the observation history (%lu bytes), running without trends", (unsigned long)(HISTORY_STATIONS * sizeof(History)));
+  loadStationList();
+  restoreWeatherSnapshot();
+  loadWifiFastConnect();
+  WiFi.onEvent(wifiBootTimingEvent);
   WiFi.mode(WIFI_STA);
-  uiInit();
+  WiFi.setSleep(WIFI_PS_NONE);  // Awake until the power policy lets the modem sleep between fetches
+  UiSettings settings = {config.ssid, config.password, config.metarId, config.timeOffset};
+  log_i("Layout profile: %s, %dx%d", layout.name, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+  uiInit(settings, backButtonEvent);
+  log_i("LVGL heap: main screen %lu bytes, settings screen %lu bytes", (unsigned long)uiBuildStats.mainScreenBytes,
+        (unsigned long)uiBuildStats.settingScreenBytes);
+  unsigned long styleStart = micros();
+  uint32_t mainLookups = uiResolveStyles(uiElements.mainScreen);
+  unsigned long mainStyleUs = micros() - styleStart;
+  styleStart = micros();
+  uint32_t settingLookups = uiResolveStyles(uiElements.settingScreen);
+  log_i("Style resolution: main screen %lu lookups in %lu us, settings screen %lu lookups in %lu us", (unsigned long)mainLookups,
+        mainStyleUs, (unsigned long)settingLookups, micros() - styleStart);
+#ifdef UI_STATIC_CARD_LAYERS
+  log_i("Card layers: %lu cards, %lu bytes of PSRAM, %lu bytes PSRAM left", (unsigned long)cardLayerStats.layers,
+        (unsigned long)cardLayerStats.bytes, (unsigned long)ESP.getFreePsram());
+#endif
+  if (weather.restored) showStation();
+  lv_display_add_event_cb(lv_display_get_default(), firstWeatherFrameEvent, LV_EVENT_REFR_READY, NULL);
+  lv_display_add_event_cb(lv_display_get_default(), powerInvalidateEvent, LV_EVENT_INVALIDATE_AREA, NULL);
+#ifdef PERF_TELEMETRY
+  telemetryMeasureScreen(uiElements.settingScreen, "settings");
+  telemetryMeasureScreen(uiElements.mainScreen, "main");
+  telemetryInit(lv_display_get_default(), uiElements.telemetryLabel);
+#endif
+#ifdef BOARD_HAS_PSRAM
+  void *mailboxMemory = ps_malloc(WEATHER_MAILBOX_SLOTS * sizeof(WeatherSnapshot));
+#else
+  void *mailboxMemory = malloc(WEATHER_MAILBOX_SLOTS * sizeof(WeatherSnapshot));
+#endif
+  if (mailboxMemory)
+    weatherMailbox.begin(mailboxMemory, WEATHER_MAILBOX_SLOTS);
+  else
+    log_i("No memory for the weather mailbox (%lu bytes), nothing will be fetched",
+          (unsigned long)(WEATHER_MAILBOX_SLOTS * sizeof(WeatherSnapshot)));
+  fetchRequestQueue = xQueueCreate(1, sizeof(FetchRequest));
+  xTaskCreatePinnedToCore(networkTask, "network", 12288, NULL, 1, NULL, ARDUINO_RUNNING_CORE == 0 ? 1 : 0);
   lv_timer_create(updateTimeCallback, 1000, NULL);
-  lv_timer_create(updateWeatherCallback, 60000, NULL);
-  lv_timer_create(wifiManagementCallback, 1000, NULL);
+  updateWeatherTimer = lv_timer_create(updateWeatherCallback, 15000, NULL);
+  lv_timer_create(weatherResultCallback, 200, NULL);
+  lv_timer_ready(lv_timer_create(wifiManagementCallback, 1000, NULL));  // First connection attempt right away
+  lv_timer_create(rotateStationCallback, 10000, NULL);
+  lv_timer_create(redrawStatsCallback, 1000, NULL);
+  lv_timer_create(powerCallback, POWER_TICK_MS, NULL);
   timeClient.setTimeOffset(config.timeOffset);
   timeClient.begin();
+  log_i("Heap after setup: %u bytes free, largest block %u bytes, weather mailbox %d x %lu bytes, PSRAM free %u", ESP.getFreeHeap(),
+        ESP.getMaxAllocHeap(), WEATHER_MAILBOX_SLOTS, (unsigned long)sizeof(WeatherSnapshot), ESP.getFreePsram());
 }
 
 auto lastLvTick = millis();
 void loop() {
   auto now = millis();
-  lv_tick_inc(now - lastLvTick);
+  unsigned long stall = now - lastLvTick;  // Time the previous pass of the loop kept LVGL from running
+  if (stall > loopStats.maxStallMs) loopStats.maxStallMs = stall;
+  if (networkBusy && stall > loopStats.maxStallDuringFetchMs) loopStats.maxStallDuringFetchMs = stall;
+  lv_tick_inc(stall);
   lastLvTick = now;
+  // Only the CPU clock, the modem and the backlight follow the policy in powerCallback
+  if (powerRedrawPending) {
+    powerRedrawPending = false;
+    if (powerRedraw(powerPolicy, now)) setCpuFrequencyMhz(powerPolicy.cpuMhz);
+  }
+#ifdef PERF_TELEMETRY
+  unsigned long start = micros();
+  lv_timer_handler();
+  telemetryLoopPass(micros() - start);
+#else
   lv_timer_handler();
+#endif
+  if (!bootTiming.fetchedFrame) logBootFrames();
 }
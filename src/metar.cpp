@@ -0,0 +1,265 @@
+// Raw METAR decoder, see metar.h
+#include "metar.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define METERS_PER_MILE 1609
+
+// One group of the report, points into the raw text
+struct MetarToken {
+  const char *text;
+  int len;
+};
+
+static bool nextToken(const char *&cursor, MetarToken &token) {
+  while (*cursor == ' ' || *cursor == '\n' || *cursor == '\r' || *cursor == '\t') cursor++;
+  if (!*cursor || *cursor == '=') return false;
+  token.text = cursor;
+  while (*cursor && *cursor != ' ' && *cursor != '\n' && *cursor != '\r' && *cursor != '\t' && *cursor != '=') cursor++;
+  token.len = cursor - token.text;
+  return true;
+}
+
+static bool tokenIs(const MetarToken &token, const char *text) { return (int)strlen(text) == token.len && strncmp(token.text, text, token.len) == 0; }
+
+static bool isDigits(const char *text, int len) {
+  for (int i = 0; i < len; i++)
+    if (text[i] < '0' || text[i] > '9') return false;
+  return len > 0;
+}
+
+static int toInt(const char *text, int len) {
+  int value = 0;
+  for (int i = 0; i < len; i++) value = value * 10 + text[i] - '0';
+  return value;
+}
+
+static bool endsWith(const MetarToken &token, const char *suffix) {
+  int len = strlen(suffix);
+  return token.len >= len && strncmp(token.text + token.len - len, suffix, len) == 0;
+}
+
+// dddff(f)[Gff(f)]KT|MPS|KMH, VRB for the direction
+static bool decodeWind(const MetarToken &token, MetarObservation &obs) {
+  int unitLen = endsWith(token, "KT") ? 2 : endsWith(token, "MPS") || endsWith(token, "KMH") ? 3 : 0;
+  int len = token.len - unitLen;
+  if (!unitLen || len < 5) return false;
+  const char *p = token.text;
+  bool variable = strncmp(p, "VRB", 3) == 0;
+  if (!variable && !isDigits(p, 3)) return false;
+  const char *gust = (const char *)memchr(p + 3, 'G', len - 3);
+  int speedLen = (gust ? gust - p : len) - 3;
+  int gustLen = gust ? p + len - gust - 1 : 0;
+  if (speedLen < 2 || speedLen > 3 || !isDigits(p + 3, speedLen)) return false;
+  if (gust && (gustLen < 2 || gustLen > 3 || !isDigits(gust + 1, gustLen))) return false;
+  int speed = toInt(p + 3, speedLen);
+  int gustSpeed = gust ? toInt(gust + 1, gustLen) : 0;
+  // Knots for all units, 1 m/s = 1.944 kt, 1 km/h = 0.54 kt
+  if (endsWith(token, "MPS")) {
+    speed = (speed * 1944 + 500) / 1000;
+    gustSpeed = (gustSpeed * 1944 + 500) / 1000;
+  } else if (endsWith(token, "KMH")) {
+    speed = (speed * 540 + 500) / 1000;
+    gustSpeed = (gustSpeed * 540 + 500) / 1000;
+  }
+  obs.windDir = variable ? -1 : toInt(p, 3);
+  obs.windSpeedKt = speed;
+  obs.windGustKt = gustSpeed;
+  return true;
+}
+
+// Statute miles: [M|P](n|n/d|whole n/d)SM, whole miles of a split group come from the token before
+static bool decodeMilesVisibility(const MetarToken &token, int wholeMiles, MetarObservation &obs) {
+  if (!endsWith(token, "SM")) return false;
+  const char *p = token.text;
+  int len = token.len - 2;
+  bool more = false;
+  if (len && (*p == 'M' || *p == 'P')) {
+    more = *p == 'P';
+    p++;
+    len--;
+  }
+  const char *slash = (const char *)memchr(p, '/', len);
+  long meters;
+  if (slash) {
+    int numeratorLen = slash - p, denominatorLen = p + len - slash - 1;
+    if (!isDigits(p, numeratorLen) || !isDigits(slash + 1, denominatorLen)) return false;
+    int denominator = toInt(slash + 1, denominatorLen);
+    if (!denominator) return false;
+    meters = (long)wholeMiles * METERS_PER_MILE + (long)toInt(p, numeratorLen) * METERS_PER_MILE / denominator;
+  } else {
+    if (!isDigits(p, len) || len > 2) return false;
+    meters = (long)toInt(p, len) * METERS_PER_MILE;
+  }
+  obs.visibilityM = more || meters >= 10000 ? 9999 : meters;
+  return true;
+}
+
+// dddd[direction], only the first (prevailing) visibility group counts
+static bool decodeMetersVisibility(const MetarToken &token, MetarObservation &obs) {
+  if (token.len < 4 || token.len > 7 || !isDigits(token.text, 4)) return false;
+  for (int i = 4; i < token.len; i++)
+    if (token.text[i] < 'A' || token.text[i] > 'Z') return false;
+  if (obs.visibilityM < 0) obs.visibilityM = toInt(token.text, 4);
+  return true;
+}
+
+// FEW|SCT|BKN|OVC hhh [CB|TCU], VV hhh, hhh in hundreds of feet or ///
+static bool decodeCloud(const MetarToken &token, MetarObservation &obs) {
+  static const char *covers[] = {"FEW", "SCT", "BKN", "OVC", "VV"};
+  int cover = 0, coverLen = 0;
+  for (; cover < 5; cover++) {
+    coverLen = strlen(covers[cover]);
+    if (token.len >= coverLen + 3 && strncmp(token.text, covers[cover], coverLen) == 0) break;
+  }
+  if (cover == 5) return false;
+  const char *height = token.text + coverLen;
+  bool missing = strncmp(height, "///", 3) == 0;
+  if (!missing && !isDigits(height, 3)) return false;
+  const char *type = height + 3;
+  int typeLen = token.len - coverLen - 3;
+  int cloudType = typeLen == 2 && strncmp(type, "CB", 2) == 0 ? CLOUD_TYPE_CB : typeLen == 3 && strncmp(type, "TCU", 3) == 0 ? CLOUD_TYPE_TCU : CLOUD_TYPE_NONE;
+  if (typeLen && cloudType == CLOUD_TYPE_NONE && !(typeLen == 3 && strncmp(type, "///", 3) == 0)) return false;
+  if (obs.cloudCount == METAR_MAX_CLOUDS) return true;
+  MetarCloud &cloud = obs.clouds[obs.cloudCount++];
+  cloud.cover = cover;
+  cloud.type = cloudType;
+  cloud.baseFt = missing ? -1 : toInt(height, 3) * 100;
+  if (cover >= CLOUD_BKN && cloud.baseFt >= 0 && (obs.ceilingFt < 0 || cloud.baseFt < obs.ceilingFt)) obs.ceilingFt = cloud.baseFt;
+  return true;
+}
+
+// [+|-|VC][descriptor]phenomena..., like -RA, +TSRA, VCSH, FZFG, BR
+static bool decodeWeather(const MetarToken &token, MetarObservation &obs) {
+  static const char descriptors[] = "MIPRBCDRBLSHTSFZ";
+  static const char phenomena[] = "DZRASNSGICPLGRGSUPBRFGFUVADUSAHZPYPOSQFCSSDS";
+  if (token.len >= (int)sizeof(obs.weather[0])) return false;
+  const char *p = token.text;
+  int len = token.len;
+  if (len && (*p == '+' || *p == '-')) {
+    p++;
+    len--;
+  } else if (len >= 2 && strncmp(p, "VC", 2) == 0) {
+    p += 2;
+    len -= 2;
+  }
+  if (!len || len % 2) return false;
+  bool descriptor = false, phenomenon = false;
+  for (int i = 0; i < len; i += 2) {
+    bool found = false;
+    for (int j = 0; !found && j < (int)sizeof(phenomena) - 1; j += 2) found = p[i] == phenomena[j] && p[i + 1] == phenomena[j + 1];
+    if (found) {
+      phenomenon = true;
+      continue;
+    }
+    for (int j = 0; !found && j < (int)sizeof(descriptors) - 1; j += 2) found = p[i] == descriptors[j] && p[i + 1] == descriptors[j + 1];
+    if (!found || i) return false;  // A descriptor only comes first
+    descriptor = true;
+  }
+  // TS and SH are reported alone too (VCSH, TS)
+  if (!phenomenon && !(descriptor && len == 2 && (strncmp(p, "TS", 2) == 0 || strncmp(p, "SH", 2) == 0))) return false;
+  if (obs.weatherCount < METAR_MAX_WEATHER) {
+    memcpy(obs.weather[obs.weatherCount], token.text, token.len);
+    obs.weather[obs.weatherCount++][token.len] = '\0';
+  }
+  return true;
+}
+
+// FAA categories from the ceiling and the visibility, the worse of both counts
+static FlightCategory flightCategory(const MetarObservation &obs) {
+  if (obs.visibilityM < 0 && obs.ceilingFt < 0 && !obs.cloudCount) return FLIGHT_UNKNOWN;
+  FlightCategory category = FLIGHT_VFR;
+  if (obs.ceilingFt >= 0) {
+    if (obs.ceilingFt < 500)
+      category = FLIGHT_LIFR;
+    else if (obs.ceilingFt < 1000)
+      category = FLIGHT_IFR;
+    else if (obs.ceilingFt <= 3000)
+      category = FLIGHT_MVFR;
+  }
+  if (obs.visibilityM >= 0 && obs.visibilityM < 9999) {
+    FlightCategory byVisibility = FLIGHT_VFR;
+    if (obs.visibilityM < 1 * METERS_PER_MILE)
+      byVisibility = FLIGHT_LIFR;
+    else if (obs.visibilityM < 3 * METERS_PER_MILE)
+      byVisibility = FLIGHT_IFR;
+    else if (obs.visibilityM <= 5 * METERS_PER_MILE)
+      byVisibility = FLIGHT_MVFR;
+    if (byVisibility > category) category = byVisibility;
+  }
+  return category;
+}
+
+bool decodeMetarGroup(const char *text, int len, MetarObservation &obs, int &wholeMiles) {
+  MetarToken token = {text, len};
+  int pendingMiles = wholeMiles;
+  wholeMiles = 0;
+  if (tokenIs(token, "CAVOK")) {
+    obs.cavok = true;
+    obs.visibilityM = 9999;
+    return true;
+  }
+  if (obs.windSpeedKt < 0 && decodeWind(token, obs)) return true;
+  if (decodeMilesVisibility(token, pendingMiles, obs) || decodeMetersVisibility(token, obs) || decodeCloud(token, obs) ||
+      decodeWeather(token, obs))
+    return true;
+  // "1 1/2SM" is split in two groups
+  if (obs.windSpeedKt >= 0 && obs.visibilityM < 0 && len <= 2 && isDigits(text, len)) {
+    wholeMiles = toInt(text, len);
+    return true;
+  }
+  return false;
+}
+
+bool finishMetarObservation(MetarObservation &obs) {
+  obs.category = flightCategory(obs);
+  obs.valid = obs.windSpeedKt >= 0 || obs.visibilityM >= 0 || obs.cloudCount;
+  return obs.valid;
+}
+
+bool decodeMetar(const char *raw, MetarObservation &obs) {
+  obs = MetarObservation();
+  if (!raw) return false;
+  const char *cursor = raw;
+  MetarToken token;
+  int group = 0;
+  int wholeMiles = 0;
+  while (nextToken(cursor, token)) {
+    if (tokenIs(token, "METAR") || tokenIs(token, "SPECI")) continue;
+    group++;
+    if (group <= 2) continue;  // Station and time of the observation
+    if (tokenIs(token, "RMK") || tokenIs(token, "TEMPO") || tokenIs(token, "BECMG") || tokenIs(token, "NOSIG")) break;
+    decodeMetarGroup(token.text, token.len, obs, wholeMiles);
+  }
+  return finishMetarObservation(obs);
+}
+
+const char *flightCategoryName(FlightCategory category) {
+  static const char *names[] = {"--", "VFR", "MVFR", "IFR", "LIFR"};
+  return names[category];
+}
+
+void formatMetarConditions(const MetarObservation &obs, char *buffer, size_t size) {
+  static const char *covers[] = {"FEW", "SCT", "BKN", "OVC", "VV"};
+  static const char *types[] = {"", "CB", "TCU"};
+  buffer[0] = '\0';
+  if (obs.cavok) {
+    snprintf(buffer, size, "CAVOK");
+    return;
+  }
+  size_t len = 0;
+  for (int i = 0; i < obs.weatherCount && len < size; i++) len += snprintf(buffer + len, size - len, "%s ", obs.weather[i]);
+  if (obs.visibilityM >= 0 && obs.visibilityM < 9999 && len < size) len += snprintf(buffer + len, size - len, "%ldm ", (long)obs.visibilityM);
+  // The ceiling layer if there is one, otherwise the lowest layer
+  const MetarCloud *layer = obs.cloudCount ? &obs.clouds[0] : nullptr;
+  for (int i = 0; i < obs.cloudCount; i++)
+    if (obs.ceilingFt >= 0 && obs.clouds[i].baseFt == obs.ceilingFt && obs.clouds[i].cover >= CLOUD_BKN) layer = &obs.clouds[i];
+  if (layer && len < size) {
+    if (layer->baseFt >= 0)
+      len += snprintf(buffer + len, size - len, "%s%03d%s", covers[layer->cover], (int)(layer->baseFt / 100), types[layer->type]);
+    else
+      len += snprintf(buffer + len, size - len, "%s///", covers[layer->cover]);
+  }
+  if (len && len < size && buffer[len - 1] == ' ') buffer[len - 1] = '\0';
+}
@@ -0,0 +1,56 @@
+// Decoder for the raw METAR text (rawOb of the JSON feed): wind direction and gust, visibility, present weather,
+// cloud layers and the flight category derived from them. Works on the text in place, token by token, without
+// copying or allocating, the result is a fixed size struct.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define METAR_MAX_WEATHER 3  // Present weather groups kept, like "-SHRA"
+#define METAR_MAX_CLOUDS 4   // Cloud layers kept, lowest first as reported
+
+enum FlightCategory { FLIGHT_UNKNOWN, FLIGHT_VFR, FLIGHT_MVFR, FLIGHT_IFR, FLIGHT_LIFR };
+
+enum CloudCover { CLOUD_FEW, CLOUD_SCT, CLOUD_BKN, CLOUD_OVC, CLOUD_VV };
+
+enum CloudType { CLOUD_TYPE_NONE, CLOUD_TYPE_CB, CLOUD_TYPE_TCU };
+
+struct MetarCloud {
+  uint8_t cover = CLOUD_FEW;  // CloudCover
+  uint8_t type = CLOUD_TYPE_NONE;  // CloudType
+  int32_t baseFt = -1;        // -1 if not reported (///)
+};
+
+struct MetarObservation {
+  bool valid = false;       // At least the wind or the visibility was decoded
+  int16_t windDir = -1;     // Degrees true, -1 variable or not reported
+  int16_t windSpeedKt = -1;
+  int16_t windGustKt = 0;   // 0 without gusts
+  int32_t visibilityM = -1; // -1 not reported, 9999 for 10 km or more
+  bool cavok = false;
+  uint8_t weatherCount = 0;
+  char weather[METAR_MAX_WEATHER][10] = {};
+  uint8_t cloudCount = 0;
+  MetarCloud clouds[METAR_MAX_CLOUDS];
+  int32_t ceilingFt = -1;  // Lowest BKN, OVC or VV layer, -1 for none
+  FlightCategory category = FLIGHT_UNKNOWN;
+};
+
+// Decode the body of a METAR or SPECI up to the remarks, unknown groups are skipped.
+// Returns obs.valid.
+bool decodeMetar(const char *raw, MetarObservation &obs);
+
+// Decode one group of a report body into obs, for decoders of other reports with the same groups (TAF).
+// wholeMiles carries the first half of a split visibility group to the next call, start with 0.
+// Returns false for a group that is not wind, visibility, present weather or clouds.
+bool decodeMetarGroup(const char *text, int len, MetarObservation &obs, int &wholeMiles);
+
+// Derive the flight category after the last group, returns obs.valid
+bool finishMetarObservation(MetarObservation &obs);
+
+// "VFR", "MVFR", "IFR", "LIFR" or "--"
+const char *flightCategoryName(FlightCategory category);
+
+// Present weather, visibility below 10 km and the ceiling (or the lowest layer) in METAR notation,
+// like "-RA BR 2400m BKN006", "CAVOK" or "" if there is nothing to report
+void formatMetarConditions(const MetarObservation &obs, char *buffer, size_t size);
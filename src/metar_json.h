@@ -0,0 +1,43 @@
+// Streaming parse of the aviationweather.gov METAR response, an array of station objects.
+// The array is read one object at a time through a filter, so the JSON pool holds one station whatever the number of
+// stations in the response. Works on any ArduinoJson reader: the HTTP body on the device, a string on the host.
+#pragma once
+
+#include <ArduinoJson.h>
+
+// Only the fields shown on the display are kept, everything else is skipped while parsing
+inline void metarJsonFilter(JsonDocument &filter) {
+  filter["icaoId"] = true;
+  filter["temp"] = true;
+  filter["dewp"] = true;
+  filter["wspd"] = true;
+  filter["altim"] = true;
+  filter["obsTime"] = true;
+  filter["lat"] = true;
+  filter["lon"] = true;
+  filter["name"] = true;
+  filter["rawOb"] = true;
+}
+
+// Skip to the next a or b, returns the character found or -1 at the end of the stream.
+// readBytes instead of read, a Stream waits for its timeout there.
+template <typename TReader>
+int metarJsonSkipTo(TReader &reader, char a, char b) {
+  char c;
+  while (reader.readBytes(&c, 1) == 1)
+    if (c == a || c == b) return c;
+  return -1;
+}
+
+// Parse the station objects of the array in reader one by one into doc and call station(doc) for each.
+// Returns the first parse error, InvalidInput if the response is not an array.
+template <typename TReader, typename TStation>
+DeserializationError metarJsonForEach(TReader &reader, JsonDocument &doc, JsonDocument &filter, TStation station) {
+  if (metarJsonSkipTo(reader, '[', '[') < 0) return DeserializationError::InvalidInput;
+  do {
+    DeserializationError error = deserializeJson(doc, reader, DeserializationOption::Filter(filter));
+    if (error) return error;
+    station(doc);
+  } while (metarJsonSkipTo(reader, ',', ']') == ',');
+  return DeserializationError::Ok;
+}
@@ -0,0 +1,78 @@
+// Publication aware METAR polling, see poll.h
+#include "poll.h"
+
+bool pollObserve(StationPoll &poll, unsigned long obsTime, unsigned long nowUtc, unsigned long previousPollUtc) {
+  if (!obsTime || obsTime <= poll.lastObsTime) return false;
+  poll.lastObsTime = obsTime;
+  // Older votes fade out, so a changed routine is picked up within a day
+  if (++poll.reports % 24 == 0)
+    for (int i = 0; i < 60; i++) poll.minuteVotes[i] /= 2;
+  unsigned char &votes = poll.minuteVotes[obsTime % 3600 / 60];
+  if (votes < 255) votes++;
+  // The previous fetch came after the observation without it, so it was released in between
+  if (previousPollUtc >= obsTime && nowUtc > previousPollUtc) {
+    long sample = (long)((previousPollUtc + nowUtc) / 2 - obsTime);
+    poll.publishDelay += (sample - poll.publishDelay) / 4;
+    if (poll.publishDelay < 0) poll.publishDelay = 0;
+    if (poll.publishDelay > 3000) poll.publishDelay = 3000;
+  }
+  return true;
+}
+
+int pollIssuanceMinutes(const StationPoll &poll, int minutes[POLL_MAX_MINUTES]) {
+  int most = 0;
+  for (int i = 0; i < 60; i++)
+    if (poll.minuteVotes[i] > most) most = poll.minuteVotes[i];
+  if (most < 2) return 0;  // A single report may have been a SPECI
+  int count = 0;
+  for (int i = 0; i < 60 && count < POLL_MAX_MINUTES; i++)
+    if (poll.minuteVotes[i] >= 2 && poll.minuteVotes[i] * 2 >= most) minutes[count++] = i;
+  return count;
+}
+
+// First routine observation time after the given one
+static unsigned long nextRoutineObs(const int *minutes, int count, unsigned long after) {
+  unsigned long hour = after - after % 3600;
+  unsigned long obs = 0;
+  for (int i = 0; i < count; i++) {
+    unsigned long candidate = hour + minutes[i] * 60;
+    if (candidate <= after) candidate += 3600;
+    if (!obs || candidate < obs) obs = candidate;
+  }
+  return obs;
+}
+
+unsigned long pollNextDue(const StationPoll &poll, unsigned long lastPollUtc) {
+  int minutes[POLL_MAX_MINUTES];
+  int count = pollIssuanceMinutes(poll, minutes);
+  if (!count || !poll.lastObsTime) return lastPollUtc + POLL_DEFAULT_INTERVAL;
+  // Expected release of the next routine report, one that did not come within its window is given up
+  unsigned long obs = nextRoutineObs(minutes, count, poll.lastObsTime);
+  while (lastPollUtc >= obs + poll.publishDelay + POLL_WINDOW_AFTER) obs = nextRoutineObs(minutes, count, obs);
+  unsigned long release = obs + poll.publishDelay;
+  if (lastPollUtc + POLL_WINDOW_BEFORE >= release) return lastPollUtc + POLL_FAST_INTERVAL;
+  unsigned long windowStart = release - POLL_WINDOW_BEFORE;
+  unsigned long idle = lastPollUtc + POLL_IDLE_INTERVAL;
+  return idle < windowStart ? idle : windowStart;
+}
+
+void pollCountFetch(PollStats &stats, bool ok, int newReports) {
+  stats.requests++;
+  if (!ok) {
+    stats.failed++;
+    return;
+  }
+  stats.newReports += newReports;
+  if (!newReports) stats.wasted++;
+}
+
+void pollCountLatency(PollStats &stats, long latency) {
+  if (latency < 0) latency = 0;
+  stats.latencySum += latency;
+  if ((unsigned long)latency > stats.latencyMax) stats.latencyMax = latency;
+  stats.latencySamples++;
+}
+
+unsigned long pollAverageLatency(const PollStats &stats) {
+  return stats.latencySamples ? stats.latencySum / stats.latencySamples : 0;
+}
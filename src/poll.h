@@ -0,0 +1,50 @@
+// Publication aware METAR polling.
+// Routine reports of a station are observed at the same minute(s) every hour and show up upstream a few minutes
+// later. The schedule learns both from the reports it sees, polls closely around the expected release and only
+// rarely in between (SPECIs). Stations without a learned minute are polled at the old fixed interval.
+#pragma once
+
+#define POLL_DEFAULT_INTERVAL 600  // s, until the issuance minutes are known
+#define POLL_FAST_INTERVAL 120     // s, inside the release window
+#define POLL_IDLE_INTERVAL 1800    // s, between release windows
+#define POLL_WINDOW_BEFORE 60      // s, the window opens this long before the expected release
+#define POLL_WINDOW_AFTER 900      // s, and is given up this long after it
+#define POLL_RETRY_INTERVAL 60     // s, after a failed fetch
+#define POLL_MAX_MINUTES 4         // Issuance minutes per hour that are followed, half-hourly stations have two
+
+struct StationPoll {
+  unsigned char minuteVotes[60] = {0};  // Reports per minute of the hour, halved every 24 reports
+  unsigned long reports = 0;
+  unsigned long lastObsTime = 0;  // UTC epoch seconds of the newest report
+  long publishDelay = 300;        // s from observation to upstream release, learned
+};
+
+// How well the fetches of all stations did
+struct PollStats {
+  unsigned long requests = 0;
+  unsigned long failed = 0;
+  unsigned long wasted = 0;  // Successful fetches without a new report of any station
+  unsigned long newReports = 0;
+  unsigned long latencySum = 0;  // s from the release of a new report to its display
+  unsigned long latencyMax = 0;
+  unsigned long latencySamples = 0;
+};
+
+// A fetch at nowUtc returned obsTime for the station, previousPollUtc is the fetch before it (0 if none).
+// Returns true for a new report, its minute is learned and, if the previous fetch brackets the release, the delay.
+bool pollObserve(StationPoll &poll, unsigned long obsTime, unsigned long nowUtc, unsigned long previousPollUtc);
+
+// Minutes of the hour routine reports are observed at, returns how many (0 while not known)
+int pollIssuanceMinutes(const StationPoll &poll, int minutes[POLL_MAX_MINUTES]);
+
+// When the station should be polled again after a fetch at lastPollUtc
+unsigned long pollNextDue(const StationPoll &poll, unsigned long lastPollUtc);
+
+// Count a fetch, failed or with newReports new reports over all stations
+void pollCountFetch(PollStats &stats, bool ok, int newReports);
+
+// Count the s from the release of a new report to its display, negative (release estimated too late) counts as 0
+void pollCountLatency(PollStats &stats, long latency);
+
+// Average of the counted latencies in s, 0 without any
+unsigned long pollAverageLatency(const PollStats &stats);
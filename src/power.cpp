@@ -0,0 +1,58 @@
+// Power policy, see power.h
+#include "power.h"
+
+// Between sunset and sunrise of today, days without both times are never night
+static bool isNight(const PowerInputs &inputs) {
+  if (!inputs.nowUtc || !inputs.sunrise || !inputs.sunset) return false;
+  return inputs.nowUtc < inputs.sunrise || inputs.nowUtc >= inputs.sunset;
+}
+
+int powerUpdate(PowerPolicy &policy, const PowerInputs &inputs) {
+  // The time since the last update was spent in the state decided then
+  unsigned long elapsed = inputs.nowMs - policy.lastUpdateMs;
+  policy.residencyMs[policy.state] += elapsed;
+  if (policy.modemSleep) policy.modemSleepMs += elapsed;
+  policy.lastUpdateMs = inputs.nowMs;
+
+  if (inputs.redraw) policy.redrawUntilMs = inputs.nowMs + POWER_REDRAW_HOLD_MS;
+  bool redrawing = (long)(policy.redrawUntilMs - inputs.nowMs) > 0;
+  if (inputs.inactiveMs < POWER_IDLE_AFTER_MS)
+    policy.state = POWER_ACTIVE;
+  else
+    policy.state = isNight(inputs) ? POWER_NIGHT : POWER_IDLE;
+
+  int changed = 0;
+  int cpuMhz = !policy.scaleCpu || policy.state == POWER_ACTIVE || redrawing ? POWER_CPU_ACTIVE_MHZ : POWER_CPU_IDLE_MHZ;
+  if (cpuMhz != policy.cpuMhz) {
+    policy.cpuMhz = cpuMhz;
+    policy.cpuChanges++;
+    changed |= POWER_CPU_CHANGED;
+  }
+  float backlight = policy.state == POWER_NIGHT ? POWER_BACKLIGHT_NIGHT : POWER_BACKLIGHT_DAY;
+  if (backlight < policy.backlight - POWER_BACKLIGHT_STEP) backlight = policy.backlight - POWER_BACKLIGHT_STEP;
+  if (backlight != policy.backlight) {
+    policy.backlight = backlight;
+    policy.backlightChanges++;
+    changed |= POWER_BACKLIGHT_CHANGED;
+  }
+  bool modemSleep = !inputs.networkActive;
+  if (modemSleep != policy.modemSleep) {
+    policy.modemSleep = modemSleep;
+    policy.modemChanges++;
+    changed |= POWER_MODEM_CHANGED;
+  }
+  return changed;
+}
+
+int powerRedraw(PowerPolicy &policy, unsigned long nowMs) {
+  policy.redrawUntilMs = nowMs + POWER_REDRAW_HOLD_MS;
+  if (policy.cpuMhz == POWER_CPU_ACTIVE_MHZ) return 0;
+  policy.cpuMhz = POWER_CPU_ACTIVE_MHZ;
+  policy.cpuChanges++;
+  return POWER_CPU_CHANGED;
+}
+
+const char *powerStateName(PowerState state) {
+  static const char *names[] = {"active", "idle", "night"};
+  return names[state];
+}
@@ -0,0 +1,58 @@
+// Power policy: CPU clock, backlight and WiFi modem sleep from what the station is doing.
+// Pure decision logic, fed with the time, input activity and sun times on every update and telling which outputs to
+// change, so it runs the same against millis() on the device and a simulated clock on the host.
+#pragma once
+
+#define POWER_IDLE_AFTER_MS 30000     // No touch for this long is idle
+#define POWER_REDRAW_HOLD_MS 2000     // The CPU stays fast this long after a large redraw
+#define POWER_CPU_ACTIVE_MHZ 240
+#define POWER_CPU_IDLE_MHZ 80         // Lowest clock WiFi works with
+// Boards with -D POWER_FIXED_CPU keep POWER_CPU_ACTIVE_MHZ: on the RGB panel of the 8048S043C the display is scanned
+// out of PSRAM continuously and a clock change while it runs is not verified on hardware yet
+#ifdef POWER_FIXED_CPU
+#define POWER_SCALE_CPU false
+#else
+#define POWER_SCALE_CPU true
+#endif
+#define POWER_BACKLIGHT_DAY 1.0f
+#define POWER_BACKLIGHT_NIGHT 0.25f
+#define POWER_BACKLIGHT_STEP 0.05f    // Dimming per update, a touch brightens at once
+
+enum PowerState { POWER_ACTIVE, POWER_IDLE, POWER_NIGHT, POWER_STATE_COUNT };
+
+enum PowerChange { POWER_CPU_CHANGED = 1, POWER_BACKLIGHT_CHANGED = 2, POWER_MODEM_CHANGED = 4 };
+
+struct PowerInputs {
+  unsigned long nowMs = 0;       // Monotonic, millis() or a simulated clock
+  unsigned long inactiveMs = 0;  // Since the last touch
+  bool redraw = false;           // A large part of the screen was invalidated since the last update
+  bool networkActive = false;    // Connecting, fetching or a fetch is due, the modem has to be awake
+  unsigned long nowUtc = 0;      // 0 without a clock
+  unsigned long sunrise = 0;     // UTC epoch seconds of today's sunrise and sunset, 0 if unknown or the sun does not cross
+  unsigned long sunset = 0;
+};
+
+struct PowerPolicy {
+  PowerState state = POWER_ACTIVE;
+  bool scaleCpu = POWER_SCALE_CPU;    // false keeps the CPU at POWER_CPU_ACTIVE_MHZ in every state
+  int cpuMhz = POWER_CPU_ACTIVE_MHZ;  // Outputs, as last applied
+  float backlight = POWER_BACKLIGHT_DAY;
+  bool modemSleep = false;
+  unsigned long lastUpdateMs = 0;
+  unsigned long redrawUntilMs = 0;
+  unsigned long residencyMs[POWER_STATE_COUNT] = {0};  // Time spent in each state
+  unsigned long modemSleepMs = 0;
+  unsigned long cpuChanges = 0;
+  unsigned long backlightChanges = 0;
+  unsigned long modemChanges = 0;
+};
+
+// Advance the policy to inputs.nowMs, returns the PowerChange flags of the outputs to apply
+int powerUpdate(PowerPolicy &policy, const PowerInputs &inputs);
+
+// A large redraw is coming: the CPU goes to full clock at once and stays there POWER_REDRAW_HOLD_MS.
+// Only the CPU, returns POWER_CPU_CHANGED if it has to be applied.
+int powerRedraw(PowerPolicy &policy, unsigned long nowMs);
+
+// "active", "idle" or "night"
+const char *powerStateName(PowerState state);
@@ -0,0 +1,289 @@
+// Headless simulator: the real screens of ui.cpp rendered by LVGL into a framebuffer in memory, driven through
+// scripted scenarios with per frame render time, invalidated area and draw tasks. Host only, built with
+// -D UI_SIMULATOR by the simulator environments: pio run -e simulator -t exec
+#ifdef UI_SIMULATOR
+
+#include <lvgl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "calc.h"
+#include "card_layers.h"
+#include "history.h"
+#include "layout.h"
+#include "ui.h"
+
+#define SIM_START_EPOCH 1718020800UL  // 2024-06-10 12:00:00 UTC
+#define SIM_FRAME_MS 33               // LV_DEF_REFR_PERIOD
+#define SIM_CHECK_SLACK_PERCENT 10    // Growth of a per frame count over the baseline that fails the check
+#define SIM_STYLE_ROUNDS 1000         // Style resolution passes per screen, averaged
+
+static uint16_t framebuffer[DISPLAY_WIDTH * DISPLAY_HEIGHT];
+static uint16_t drawBuffer[DISPLAY_WIDTH * DISPLAY_HEIGHT / 10];  // Partial rendering like on the device
+static lv_display_t *display;
+static History history;
+static ClockText clockText;
+
+// Statistics of one scenario
+struct Scenario {
+  const char *name;
+  unsigned long frames = 0;
+  uint64_t renderUs = 0;
+  uint64_t renderUsMax = 0;
+  uint64_t invalidatedPixels = 0;
+  uint64_t invalidatedPixelsMax = 0;
+  uint64_t drawTasks = 0;
+  uint64_t drawTasksMax = 0;
+  uint64_t flushedPixels = 0;
+};
+
+static Scenario *scenario;
+static uint64_t frameStartUs;
+static unsigned long frameDrawTasks;
+static unsigned long frameFlushedPixels;
+
+static uint64_t nowUs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Copy the rendered area into the framebuffer, the panel of the simulator
+static void flushCallback(lv_display_t *disp, const lv_area_t *area, uint8_t *pixels) {
+  int32_t w = lv_area_get_width(area);
+  for (int32_t y = area->y1; y <= area->y2; y++)
+    memcpy(&framebuffer[y * DISPLAY_WIDTH + area->x1], pixels + (y - area->y1) * w * 2, w * 2);
+  frameFlushedPixels += lv_area_get_size(area);
+  lv_display_flush_ready(disp);
+}
+
+static void drawTaskEvent(lv_event_t *e) { frameDrawTasks++; }
+
+// Every object of the tree reports the draw tasks it creates
+static void countDrawTasks(lv_obj_t *obj) {
+  lv_obj_add_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+  lv_obj_add_event_cb(obj, drawTaskEvent, LV_EVENT_DRAW_TASK_ADDED, NULL);
+  for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) countDrawTasks(lv_obj_get_child(obj, i));
+}
+
+static void refreshStartEvent(lv_event_t *e) {
+  frameStartUs = nowUs();
+  frameDrawTasks = 0;
+  frameFlushedPixels = 0;
+}
+
+// One line per frame that drew something, the invalidated area comes from the counter of ui.cpp
+static void refreshReadyEvent(lv_event_t *e) {
+  uint64_t renderUs = nowUs() - frameStartUs;
+  unsigned long invalidated = redrawStats.invalidatedPixels;
+  redrawStats.invalidatedPixels = 0;
+  if (!frameFlushedPixels || !scenario) return;
+  Scenario &s = *scenario;
+  printf("SIM,%s,%lu,%llu,%lu,%lu,%lu\n", s.name, s.frames, (unsigned long long)renderUs, invalidated, frameDrawTasks,
+         frameFlushedPixels);
+  s.frames++;
+  s.renderUs += renderUs;
+  s.invalidatedPixels += invalidated;
+  s.drawTasks += frameDrawTasks;
+  s.flushedPixels += frameFlushedPixels;
+  if (renderUs > s.renderUsMax) s.renderUsMax = renderUs;
+  if (invalidated > s.invalidatedPixelsMax) s.invalidatedPixelsMax = invalidated;
+  if (frameDrawTasks > s.drawTasksMax) s.drawTasksMax = frameDrawTasks;
+}
+
+// Let simulated time pass, LVGL renders whenever its refresh period is over
+static void advance(unsigned long ms) {
+  for (unsigned long elapsed = 0; elapsed < ms; elapsed += SIM_FRAME_MS) {
+    lv_tick_inc(SIM_FRAME_MS);
+    lv_timer_handler();
+  }
+}
+
+// The label updates of updateTimeCallback in main.cpp
+static void clockTick(unsigned long epoch) {
+  int changed = updateClockText(clockText, epoch);
+  if (!changed) return;
+  updateLabel(uiElements.timeDateLabel, LV_SYMBOL_LIST " %s %s", clockText.time, clockText.date);
+  lv_label_set_text(uiElements.bigTimeLabel, clockText.time);
+  if (changed & CLOCK_DATE_CHANGED) lv_label_set_text(uiElements.bigDateLabel, clockText.date);
+}
+
+// The label updates of showStation in main.cpp for a new half-hourly report
+static void weatherReport(int report) {
+  int temperature = 18 + report % 7;
+  int dewPoint = 9 + report % 3;
+  int pressure = 1012 + report / 4;
+  historyAppend(history, SIM_START_EPOCH + report * 1800, temperature, dewPoint, 8 + report % 5, pressure);
+  updateLabel(uiElements.temperatureLabel, LV_SYMBOL_BATTERY_3 " %d°C", temperature);
+  updateLabel(uiElements.humidityLabel, LV_SYMBOL_TINT " %d%%", relativeHumidity(temperature, dewPoint));
+  updateLabel(uiElements.windSpeedLabel, LV_SYMBOL_GPS " %03d° %d km/h", 240 + report % 4 * 10, (8 + report % 5) * 1852 / 1000);
+  updateLabel(uiElements.conditionsLabel, LV_SYMBOL_EYE_OPEN " %s", report % 2 ? "FEW040 BKN250 10 km" : "SCT035 9999");
+  updateLabel(uiElements.flightCategoryLabel, "%s", "VFR");
+  updateLabel(uiElements.pressureLabel, LV_SYMBOL_POWER " %d hPa", pressure);
+  updateLabel(uiElements.airportNameLabel, LV_SYMBOL_HOME " %s", "Munich/Franz Josef Strauss Intl, BY, DE");
+  updateLabel(uiElements.dataAgeLabel, LV_SYMBOL_REFRESH " %d min ago", report % 30);
+  updateLabel(uiElements.sunriseLabel, LV_SYMBOL_UP " %s", "05:12:40");
+  updateLabel(uiElements.sunsetLabel, LV_SYMBOL_DOWN " %s", "21:14:05");
+  updateLabel(uiElements.daylightLabel, "Day 16:01 h, %s %s", "Sunset", "21:14");
+  if (uiElements.forecastLabel) updateLabel(uiElements.forecastLabel, LV_SYMBOL_BELL " %s", report % 3 ? "14Z BECMG 27015G25KT" : "No change forecast");
+  uiShowHistory(history);
+}
+
+// FNV-1a of the framebuffer, the same screen content has the same hash in every build
+static uint32_t frameHash() {
+  const uint8_t *bytes = (const uint8_t *)framebuffer;
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < sizeof(framebuffer); i++) hash = (hash ^ bytes[i]) * 16777619u;
+  return hash;
+}
+
+static void printSummary(const Scenario &s) {
+  unsigned long frames = s.frames ? s.frames : 1;
+  printf("%-16s %6lu %10.1f %10llu %12llu %12llu %8llu %8llu %12llu\n", s.name, s.frames, (double)s.renderUs / frames,
+         (unsigned long long)s.renderUsMax, (unsigned long long)(s.invalidatedPixels / frames),
+         (unsigned long long)s.invalidatedPixelsMax, (unsigned long long)(s.drawTasks / frames),
+         (unsigned long long)s.drawTasksMax, (unsigned long long)(s.flushedPixels / frames));
+}
+
+// Per frame counts of a scenario that do not depend on the speed of the host
+static void baselineCounts(const Scenario &s, unsigned long long counts[4]) {
+  unsigned long frames = s.frames ? s.frames : 1;
+  counts[0] = s.frames;
+  counts[1] = s.invalidatedPixels / frames;
+  counts[2] = s.drawTasks / frames;
+  counts[3] = s.flushedPixels / frames;
+}
+
+// Smoke test against the baseline file named by SIM_BASELINE: more frames, invalidated pixels, draw tasks or
+// flushed pixels per frame than the baseline plus SIM_CHECK_SLACK_PERCENT, or another main screen, fail the run.
+// A missing file is written from this run. Returns the exit code of the simulator.
+static int checkBaseline(const Scenario *const scenarios[], int count, uint32_t mainHash) {
+  const char *path = getenv("SIM_BASELINE");
+  if (!path) return 0;
+  static const char *countNames[4] = {"frames", "invalidated_px", "draw_tasks", "flushed_px"};
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    file = fopen(path, "w");
+    if (!file) {
+      printf("SIM_CHECK,cannot write %s\n", path);
+      return 1;
+    }
+    fprintf(file, "hash %08x\n", (unsigned)mainHash);
+    for (int i = 0; i < count; i++) {
+      unsigned long long counts[4];
+      baselineCounts(*scenarios[i], counts);
+      fprintf(file, "%s;%llu;%llu;%llu;%llu\n", scenarios[i]->name, counts[0], counts[1], counts[2], counts[3]);
+    }
+    fclose(file);
+    printf("SIM_CHECK,baseline written to %s\n", path);
+    return 0;
+  }
+  int failures = 0;
+  unsigned hash = 0;
+  if (fscanf(file, "hash %x\n", &hash) != 1 || hash != mainHash) {
+    printf("SIM_CHECK,FAIL,main screen hash %08x, baseline %08x\n", (unsigned)mainHash, hash);
+    failures++;
+  }
+  char name[32];
+  unsigned long long expected[4];
+  while (fscanf(file, "%31[^;];%llu;%llu;%llu;%llu\n", name, &expected[0], &expected[1], &expected[2], &expected[3]) == 5) {
+    for (int i = 0; i < count; i++) {
+      if (strcmp(name, scenarios[i]->name) != 0) continue;
+      unsigned long long counts[4];
+      baselineCounts(*scenarios[i], counts);
+      for (int c = 0; c < 4; c++)
+        if (counts[c] * 100 > expected[c] * (100 + SIM_CHECK_SLACK_PERCENT)) {
+          printf("SIM_CHECK,FAIL,%s %s %llu, baseline %llu\n", name, countNames[c], counts[c], expected[c]);
+          failures++;
+        }
+    }
+  }
+  fclose(file);
+  printf("SIM_CHECK,%s,%d failures against %s\n", failures ? "FAIL" : "PASS", failures, path);
+  return failures ? 1 : 0;
+}
+
+// Time uiResolveStyles() on a screen, the same lookups on every pass
+static void measureStyles(const char *name, lv_obj_t *screen) {
+  uint32_t lookups = 0;
+  uint64_t start = nowUs();
+  for (int i = 0; i < SIM_STYLE_ROUNDS; i++) lookups = uiResolveStyles(screen);
+  printf("Style resolution, %s screen: %u lookups in %.1f us\n", name, (unsigned)lookups,
+         (double)(nowUs() - start) / SIM_STYLE_ROUNDS);
+}
+
+static void saveEvent(lv_event_t *e) {}
+
+int main(int argc, char **argv) {
+  lv_init();
+  display = lv_display_create(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+  lv_display_set_flush_cb(display, flushCallback);
+  lv_display_set_buffers(display, drawBuffer, NULL, sizeof(drawBuffer), LV_DISPLAY_RENDER_MODE_PARTIAL);
+  lv_display_add_event_cb(display, refreshStartEvent, LV_EVENT_REFR_START, NULL);
+  lv_display_add_event_cb(display, refreshReadyEvent, LV_EVENT_REFR_READY, NULL);
+  historyReset(history);
+
+  UiSettings settings = {"WLAN", "secret", "EDDM,EDDF,LSZH", 7200};
+  uiInit(settings, saveEvent);
+  countDrawTasks(uiElements.mainScreen);
+  countDrawTasks(uiElements.settingScreen);
+  printf("Layout %s, %dx%d, main screen %u bytes, setting screen %u bytes of LVGL heap\n", layout.name, DISPLAY_WIDTH,
+         DISPLAY_HEIGHT, (unsigned)uiBuildStats.mainScreenBytes, (unsigned)uiBuildStats.settingScreenBytes);
+  measureStyles("main", uiElements.mainScreen);
+  measureStyles("setting", uiElements.settingScreen);
+#ifdef UI_STATIC_CARD_LAYERS
+  printf("Card layers: %u cards, %u bytes\n", (unsigned)cardLayerStats.layers, (unsigned)cardLayerStats.bytes);
+#endif
+  printf("SIM,scenario,frame,render_us,invalidated_px,draw_tasks,flushed_px\n");
+
+  Scenario boot, clock, weather, screens;
+  boot.name = "boot";
+  clock.name = "clock tick";
+  weather.name = "weather refresh";
+  screens.name = "screen switch";
+
+  // First frame of the main screen
+  scenario = &boot;
+  advance(SIM_FRAME_MS);
+
+  // Two minutes of the running clock, one label update per second
+  scenario = &clock;
+  for (unsigned long second = 0; second < 120; second++) {
+    clockTick(SIM_START_EPOCH + 7200 + second);
+    advance(1000);
+  }
+
+  // A day of half-hourly reports, the trend chart grows with them
+  scenario = &weather;
+  for (int report = 0; report < 48; report++) {
+    weatherReport(report);
+    advance(1000);
+  }
+  uint32_t mainHash = frameHash();
+
+  // Settings and back, the whole screen is drawn each time
+  scenario = &screens;
+  for (int i = 0; i < 5; i++) {
+    lv_screen_load(uiElements.settingScreen);
+    advance(1000);
+    lv_screen_load(uiElements.mainScreen);
+    advance(1000);
+  }
+  scenario = nullptr;
+
+  printf("\n%-16s %6s %10s %10s %12s %12s %8s %8s %12s\n", "scenario", "frames", "render_us", "max_us", "invalid_px",
+         "max_px", "draws", "max", "flushed_px");
+  printSummary(boot);
+  printSummary(clock);
+  printSummary(weather);
+  printSummary(screens);
+  printf("\nMain screen hash after the weather scenario: %08x\n", (unsigned)mainHash);
+  printf("Main screen hash at the end: %08x\n", (unsigned)frameHash());
+  const Scenario *const scenarios[] = {&boot, &clock, &weather, &screens};
+  return checkBaseline(scenarios, 4, mainHash);
+}
+
+#endif
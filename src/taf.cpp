@@ -0,0 +1,285 @@
+// Streaming TAF decoder, see taf.h
+#include "taf.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "calc.h"
+
+static_assert(sizeof(TafDecoder) <= TAF_DECODER_MAX_BYTES, "TAF decoder state exceeds its memory ceiling");
+
+enum TafState { TAF_WAIT, TAF_STATION, TAF_ISSUE, TAF_VALID, TAF_BODY, TAF_SKIP };
+
+static bool isDigits(const char *text, int len) {
+  for (int i = 0; i < len; i++)
+    if (text[i] < '0' || text[i] > '9') return false;
+  return len > 0;
+}
+
+static int toInt(const char *text, int len) {
+  int value = 0;
+  for (int i = 0; i < len; i++) value = value * 10 + text[i] - '0';
+  return value;
+}
+
+static bool isStationId(const char *text, int len) {
+  if (len != 4 || text[0] < 'A' || text[0] > 'Z') return false;
+  for (int i = 1; i < 4; i++)
+    if (!((text[i] >= 'A' && text[i] <= 'Z') || (text[i] >= '0' && text[i] <= '9'))) return false;
+  return true;
+}
+
+// ddhh/ddhh
+static bool isRange(const char *text, int len) { return len == 9 && text[4] == '/' && isDigits(text, 4) && isDigits(text + 5, 4); }
+
+// Day of month and time in the month nearest to the reference, TAFs only carry the day
+static unsigned long resolveTime(unsigned long referenceUtc, int day, int hour, int minute) {
+  if (day < 1 || day > 31 || hour > 24 || minute > 59) return 0;
+  int year;
+  unsigned month, dayOfMonth;
+  civilFromDays(referenceUtc / 86400, year, month, dayOfMonth);
+  unsigned long best = 0;
+  unsigned long bestDistance = 0;
+  for (int shift = -1; shift <= 1; shift++) {
+    int y = year;
+    int m = (int)month + shift;
+    if (m < 1) m += 12, y--;
+    if (m > 12) m -= 12, y++;
+    long days = daysFromCivil(y, m, day);
+    if (days < 0) continue;
+    unsigned long time = (unsigned long)days * 86400 + hour * 3600 + minute * 60;
+    unsigned long distance = time > referenceUtc ? time - referenceUtc : referenceUtc - time;
+    if (!best || distance < bestDistance) best = time, bestDistance = distance;
+  }
+  return best;
+}
+
+static void closePeriod(TafDecoder &d) {
+  if (!d.periodOpen) return;
+  d.periodOpen = false;
+  MetarObservation &obs = d.conditions;
+  finishMetarObservation(obs);
+  ForecastPeriod &period = d.forecast->periods[d.forecast->periodCount - 1];
+  period.windDir = obs.windDir;
+  period.windSpeedKt = obs.windSpeedKt;
+  period.windGustKt = obs.windGustKt;
+  period.visibilityM = obs.visibilityM > 9999 ? 9999 : obs.visibilityM;
+  period.ceilingFt = obs.ceilingFt;
+  period.category = obs.category;
+  if (obs.weatherCount) snprintf(period.weather, sizeof(period.weather), "%s", obs.weather[0]);
+}
+
+static void openPeriod(TafDecoder &d, ForecastChange change, unsigned long from, unsigned long to) {
+  closePeriod(d);
+  d.expectRange = false;
+  if (!d.forecast) return;
+  if (d.forecast->periodCount >= TAF_MAX_PERIODS) {
+    if (d.forecast->droppedPeriods < UINT8_MAX) d.forecast->droppedPeriods++;
+    return;
+  }
+  ForecastPeriod &period = d.forecast->periods[d.forecast->periodCount++];
+  period = ForecastPeriod();
+  period.change = change;
+  period.from = from;
+  period.to = to;
+  if (change == FORECAST_BASE || change == FORECAST_FM) d.mainPeriod = d.forecast->periodCount - 1;
+  d.conditions = MetarObservation();
+  d.wholeMiles = 0;
+  d.periodOpen = true;
+}
+
+static void endReport(TafDecoder &d) {
+  closePeriod(d);
+  if (d.forecast && d.forecast->periodCount) d.reports++;
+  d.forecast = nullptr;
+  d.mainPeriod = -1;
+  d.expectRange = false;
+  d.state = TAF_WAIT;
+}
+
+static void startReport(TafDecoder &d, const char *icaoId) {
+  d.forecast = d.lookup ? d.lookup(icaoId, d.context) : nullptr;
+  if (d.forecast) *d.forecast = Forecast();
+  d.state = d.forecast ? TAF_ISSUE : TAF_SKIP;
+}
+
+static void bodyGroup(TafDecoder &d, const char *text, int len) {
+  Forecast &forecast = *d.forecast;
+  ForecastPeriod *current = d.periodOpen ? &forecast.periods[forecast.periodCount - 1] : nullptr;
+  // FMddhhmm, ends the base or the previous FM period
+  if (len == 8 && text[0] == 'F' && text[1] == 'M' && isDigits(text + 2, 6)) {
+    unsigned long from = resolveTime(d.referenceUtc, toInt(text + 2, 2), toInt(text + 4, 2), toInt(text + 6, 2));
+    if (d.mainPeriod >= 0) forecast.periods[d.mainPeriod].to = from;
+    openPeriod(d, FORECAST_FM, from, forecast.validTo);
+  } else if (len == 5 && strncmp(text, "BECMG", 5) == 0) {
+    openPeriod(d, FORECAST_BECMG, 0, 0);
+    d.expectRange = true;
+  } else if (len == 5 && strncmp(text, "TEMPO", 5) == 0) {
+    // PROB30 TEMPO is one change group
+    if (d.expectRange && current && current->change == FORECAST_PROB) {
+      current->tempo = true;
+      return;
+    }
+    openPeriod(d, FORECAST_TEMPO, 0, 0);
+    d.expectRange = true;
+  } else if (len == 6 && strncmp(text, "PROB", 4) == 0 && isDigits(text + 4, 2)) {
+    openPeriod(d, FORECAST_PROB, 0, 0);
+    if (d.periodOpen) forecast.periods[forecast.periodCount - 1].probability = toInt(text + 4, 2);
+    d.expectRange = true;
+  } else if (d.expectRange && isRange(text, len)) {
+    d.expectRange = false;
+    if (current) {
+      current->from = resolveTime(d.referenceUtc, toInt(text, 2), toInt(text + 2, 2), 0);
+      current->to = resolveTime(d.referenceUtc, toInt(text + 5, 2), toInt(text + 7, 2), 0);
+    }
+  } else if (len == 3 && strncmp(text, "NSW", 3) == 0) {
+    d.conditions.weatherCount = 0;
+  } else {
+    // Wind, visibility, weather and clouds like in a METAR, the rest (TX/TN, WS, QNH) is skipped
+    decodeMetarGroup(text, len, d.conditions, d.wholeMiles);
+  }
+}
+
+static void handleGroup(TafDecoder &d) {
+  const char *text = d.group;
+  int len = d.groupLen;
+  if (d.groupTooLong) {
+    d.droppedGroups++;
+    return;
+  }
+  // Several reports may follow each other without "=" or a blank line
+  if (len == 3 && strncmp(text, "TAF", 3) == 0) {
+    if (d.state != TAF_WAIT) endReport(d);
+    d.state = TAF_STATION;
+    return;
+  }
+  switch (d.state) {
+    case TAF_WAIT:
+    case TAF_STATION:
+      if (len == 3 && (strncmp(text, "AMD", 3) == 0 || strncmp(text, "COR", 3) == 0)) return;
+      if (isStationId(text, len))
+        startReport(d, text);
+      else if (d.state == TAF_STATION)
+        d.state = TAF_SKIP;
+      break;
+    case TAF_ISSUE:
+      // ddhhmmZ, missing in some amendments
+      if (len == 7 && text[6] == 'Z' && isDigits(text, 6)) {
+        d.forecast->issued = resolveTime(d.referenceUtc, toInt(text, 2), toInt(text + 2, 2), toInt(text + 4, 2));
+        d.state = TAF_VALID;
+        break;
+      }
+      // fall through
+    case TAF_VALID:
+      if (isRange(text, len)) {
+        Forecast &forecast = *d.forecast;
+        forecast.validFrom = resolveTime(d.referenceUtc, toInt(text, 2), toInt(text + 2, 2), 0);
+        forecast.validTo = resolveTime(d.referenceUtc, toInt(text + 5, 2), toInt(text + 7, 2), 0);
+        openPeriod(d, FORECAST_BASE, forecast.validFrom, forecast.validTo);
+        d.state = TAF_BODY;
+      } else {
+        *d.forecast = Forecast();  // Like "NIL", no valid period and no issue time shown
+        d.state = TAF_SKIP;
+      }
+      break;
+    case TAF_BODY:
+      if (len == 3 && strncmp(text, "RMK", 3) == 0) {
+        closePeriod(d);
+        d.state = TAF_SKIP;
+      } else if (len == 3 && (strncmp(text, "CNL", 3) == 0 || strncmp(text, "NIL", 3) == 0)) {
+        // A cancelled or missing forecast, the station has none
+        d.periodOpen = false;
+        *d.forecast = Forecast();
+        d.state = TAF_SKIP;
+      } else {
+        bodyGroup(d, text, len);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+static void endGroup(TafDecoder &d) {
+  if (d.groupLen || d.groupTooLong) {
+    d.group[d.groupLen] = '\0';
+    handleGroup(d);
+  }
+  d.groupLen = 0;
+  d.groupTooLong = false;
+}
+
+void tafDecoderBegin(TafDecoder &decoder, ForecastLookup lookup, void *context, unsigned long referenceUtc) {
+  decoder = TafDecoder();
+  decoder.lookup = lookup;
+  decoder.context = context;
+  decoder.referenceUtc = referenceUtc;
+  decoder.state = TAF_WAIT;
+}
+
+void tafDecoderFeed(TafDecoder &d, const char *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    char c = data[i];
+    if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '=') {
+      endGroup(d);
+      if (c == '\n' && ++d.newlines >= 2) c = '=';
+      if (c == '=' && d.state != TAF_WAIT) endReport(d);
+    } else {
+      d.newlines = 0;
+      if (d.groupLen < TAF_GROUP_MAX)
+        d.group[d.groupLen++] = c;
+      else
+        d.groupTooLong = true;
+    }
+  }
+}
+
+void tafDecoderEnd(TafDecoder &decoder) {
+  endGroup(decoder);
+  if (decoder.state != TAF_WAIT) endReport(decoder);
+}
+
+// "14Z", "1430Z" or "14-18Z", hour 24 for the end of a day
+static int formatHours(unsigned long from, unsigned long to, char *buffer, size_t size) {
+  unsigned fromHour = from % 86400 / 3600;
+  unsigned fromMinute = from % 3600 / 60;
+  if (!to) return fromMinute ? snprintf(buffer, size, "%02u%02uZ", fromHour, fromMinute) : snprintf(buffer, size, "%02uZ", fromHour);
+  unsigned toHour = to % 86400 / 3600;
+  if (!toHour) toHour = 24;
+  return snprintf(buffer, size, "%02u-%02uZ", fromHour, toHour);
+}
+
+void formatForecastChange(const Forecast &forecast, unsigned long nowUtc, char *buffer, size_t size) {
+  static const char *changes[] = {"", "FM", "BECMG", "TEMPO", "PROB"};
+  buffer[0] = '\0';
+  if (!forecast.issued && !forecast.validFrom) return;
+  // A TEMPO or PROB going on now, otherwise the next period that starts
+  const ForecastPeriod *shown = nullptr;
+  for (int i = 0; i < forecast.periodCount; i++) {
+    const ForecastPeriod &period = forecast.periods[i];
+    if ((period.change == FORECAST_TEMPO || period.change == FORECAST_PROB) && period.from <= nowUtc && nowUtc < period.to) {
+      shown = &period;
+      break;
+    }
+    if (period.change != FORECAST_BASE && period.from > nowUtc && (!shown || period.from < shown->from)) shown = &period;
+  }
+  if (!shown) return;
+  size_t len;
+  if (shown->change == FORECAST_PROB)
+    len = snprintf(buffer, size, "PROB%d%s ", shown->probability, shown->tempo ? " TEMPO" : "");
+  else
+    len = snprintf(buffer, size, "%s ", changes[shown->change]);
+  if (len < size) len += formatHours(shown->from, shown->change == FORECAST_FM ? 0 : shown->to, buffer + len, size - len);
+  if (shown->category != FLIGHT_UNKNOWN && len < size)
+    len += snprintf(buffer + len, size - len, " %s", flightCategoryName((FlightCategory)shown->category));
+  if (shown->weather[0] && len < size) len += snprintf(buffer + len, size - len, " %s", shown->weather);
+  // Only a wind change, like "BECMG 16-18Z 27015G25KT"
+  if (shown->category == FLIGHT_UNKNOWN && !shown->weather[0] && shown->windSpeedKt >= 0 && len < size) {
+    if (shown->windDir >= 0)
+      len += snprintf(buffer + len, size - len, " %03d%02d", shown->windDir, shown->windSpeedKt);
+    else
+      len += snprintf(buffer + len, size - len, " VRB%02d", shown->windSpeedKt);
+    if (shown->windGustKt && len < size) len += snprintf(buffer + len, size - len, "G%02d", shown->windGustKt);
+    if (len < size) snprintf(buffer + len, size - len, "KT");
+  }
+}
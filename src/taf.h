@@ -0,0 +1,77 @@
+// Streaming decoder for raw TAF reports (format=raw of the aviationweather.gov TAF API).
+// The response is pushed through in chunks of any size as it arrives. The decoder cuts it into groups and writes the
+// base forecast and its change groups (FM, BECMG, TEMPO, PROB) into the fixed period table of each station.
+// Memory is the decoder and the tables whatever the size of the response: groups longer than TAF_GROUP_MAX and
+// periods beyond TAF_MAX_PERIODS are dropped and counted.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "metar.h"
+
+#ifdef BOARD_HAS_PSRAM
+#define TAF_MAX_PERIODS 8
+#else
+#define TAF_MAX_PERIODS 4
+#endif
+#define TAF_GROUP_MAX 15           // Longest group that is decoded, like "PROB30" or "27015G25KT"
+#define TAF_DECODER_MAX_BYTES 256  // Ceiling for the decoder state, checked at compile time
+
+enum ForecastChange { FORECAST_BASE, FORECAST_FM, FORECAST_BECMG, FORECAST_TEMPO, FORECAST_PROB };
+
+// One period, the groups reported for it. BECMG, TEMPO and PROB only list what changes, the rest stays -1.
+struct ForecastPeriod {
+  uint8_t change = FORECAST_BASE;  // ForecastChange
+  uint8_t probability = 0;         // 30 or 40 for PROB, also with TEMPO
+  bool tempo = false;              // PROB30 TEMPO
+  uint8_t category = FLIGHT_UNKNOWN;
+  unsigned long from = 0;  // UTC epoch seconds
+  unsigned long to = 0;
+  int16_t windDir = -1;
+  int16_t windSpeedKt = -1;
+  int16_t windGustKt = 0;
+  int16_t visibilityM = -1;
+  int32_t ceilingFt = -1;
+  char weather[10] = {0};  // First present weather group
+};
+
+struct Forecast {
+  unsigned long issued = 0;  // UTC epoch seconds, 0 without a forecast
+  unsigned long validFrom = 0;
+  unsigned long validTo = 0;
+  uint8_t periodCount = 0;
+  uint8_t droppedPeriods = 0;  // Stops at 255
+  ForecastPeriod periods[TAF_MAX_PERIODS];
+};
+
+// Table for the report of a station, nullptr skips the report
+typedef Forecast *(*ForecastLookup)(const char *icaoId, void *context);
+
+struct TafDecoder {
+  ForecastLookup lookup = nullptr;
+  void *context = nullptr;
+  unsigned long referenceUtc = 0;  // The day of month of the TAF times is resolved around it
+  char group[TAF_GROUP_MAX + 1] = {0};
+  uint8_t groupLen = 0;
+  bool groupTooLong = false;
+  uint8_t newlines = 0;  // A blank line ends a report
+  uint8_t state = 0;
+  Forecast *forecast = nullptr;  // Report being decoded, nullptr while it is skipped
+  int8_t mainPeriod = -1;        // Base or last FM period, ends where the next FM starts
+  bool periodOpen = false;
+  bool expectRange = false;      // BECMG, TEMPO and PROB are followed by ddhh/ddhh
+  int wholeMiles = 0;
+  MetarObservation conditions;   // Groups of the open period
+  unsigned long reports = 0;
+  unsigned long droppedGroups = 0;
+};
+
+void tafDecoderBegin(TafDecoder &decoder, ForecastLookup lookup, void *context, unsigned long referenceUtc);
+void tafDecoderFeed(TafDecoder &decoder, const char *data, size_t len);
+// End of the response, completes the last report
+void tafDecoderEnd(TafDecoder &decoder);
+
+// Next change of the forecast after nowUtc, or a TEMPO/PROB going on, like "FM 18Z MVFR" or "TEMPO 14-18Z IFR +TSRA".
+// "" if there is none.
+void formatForecastChange(const Forecast &forecast, unsigned long nowUtc, char *buffer, size_t size);
@@ -0,0 +1,104 @@
+// Frame time and render cost telemetry, see telemetry.h
+#ifdef PERF_TELEMETRY
+
+#include "telemetry.h"
+
+#include <Arduino.h>
+
+// Accumulated over one sample second
+struct TelemetryWindow {
+  unsigned long refreshes = 0;
+  unsigned long renders = 0;
+  unsigned long flushes = 0;
+  unsigned long refreshUs = 0;  // Sum of REFR_START .. REFR_READY
+  unsigned long renderUs = 0;   // Sum of RENDER_START .. RENDER_READY
+  unsigned long renderMaxUs = 0;
+  unsigned long flushUs = 0;    // Sum of FLUSH_START .. FLUSH_FINISH, all flushes of all refreshes
+  unsigned long loopMaxUs = 0;
+};
+
+struct Telemetry {
+  lv_obj_t *label = nullptr;
+  TelemetryWindow window;
+  unsigned long refreshStart = 0;
+  unsigned long renderStart = 0;
+  unsigned long flushStart = 0;
+  unsigned long samples = 0;
+} telemetry;
+
+// Display events, all of them arrive from lv_timer_handler() on the LVGL task
+static void telemetryDisplayEvent(lv_event_t *e) {
+  unsigned long now = micros();
+  TelemetryWindow &window = telemetry.window;
+  switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+      telemetry.refreshStart = now;
+      break;
+    case LV_EVENT_REFR_READY:
+      window.refreshes++;
+      window.refreshUs += now - telemetry.refreshStart;
+      break;
+    case LV_EVENT_RENDER_START:
+      telemetry.renderStart = now;
+      break;
+    case LV_EVENT_RENDER_READY: {
+      unsigned long us = now - telemetry.renderStart;
+      window.renders++;
+      window.renderUs += us;
+      if (us > window.renderMaxUs) window.renderMaxUs = us;
+      break;
+    }
+    case LV_EVENT_FLUSH_START:
+      telemetry.flushStart = now;
+      break;
+    case LV_EVENT_FLUSH_FINISH:
+      window.flushes++;
+      window.flushUs += now - telemetry.flushStart;
+      break;
+    default:
+      break;
+  }
+}
+
+// Once per second: format the window, show and print it, start the next one
+static void telemetrySampleCallback(lv_timer_t *timer) {
+  TelemetryWindow window = telemetry.window;
+  telemetry.window = TelemetryWindow();
+  lv_mem_monitor_t mem;
+  lv_mem_monitor(&mem);
+  unsigned long refreshes = window.refreshes ? window.refreshes : 1;
+  float renderMs = window.renderUs / 1000.0f / refreshes;
+  float flushMs = window.flushUs / 1000.0f / refreshes;
+  float refreshMs = window.refreshUs / 1000.0f / refreshes;
+  int cpu = 100 - lv_timer_get_idle();
+  if (telemetry.label) {
+    char text[64];
+    snprintf(text, sizeof(text), "%lu FPS %d%% CPU R %.1f F %.1f ms %d%% mem", window.refreshes, cpu, renderMs, flushMs, mem.used_pct);
+    lv_label_set_text(telemetry.label, text);
+  }
+  if (telemetry.samples++ % 60 == 0)  // Header repeated, so a capture started late still has one
+    Serial.println("PERF,ms,fps,cpu_pct,refr_ms,render_ms,render_max_ms,flush_ms,flushes,loop_max_ms,mem_used,mem_max_used,mem_frag_pct");
+  Serial.printf("PERF,%lu,%lu,%d,%.2f,%.2f,%.2f,%.2f,%lu,%.2f,%lu,%lu,%d\n", millis(), window.refreshes, cpu, refreshMs, renderMs,
+                window.renderMaxUs / 1000.0f, flushMs, window.flushes, window.loopMaxUs / 1000.0f, (unsigned long)(mem.total_size - mem.free_size),
+                (unsigned long)mem.max_used, mem.frag_pct);
+}
+
+void telemetryInit(lv_display_t *display, lv_obj_t *label) {
+  telemetry.label = label;
+  lv_display_add_event_cb(display, telemetryDisplayEvent, LV_EVENT_ALL, NULL);
+  lv_timer_create(telemetrySampleCallback, 1000, NULL);
+}
+
+void telemetryMeasureScreen(lv_obj_t *screen, const char *name) {
+  lv_screen_load(screen);
+  lv_obj_invalidate(screen);
+  unsigned long start = micros();
+  lv_refr_now(NULL);
+  log_i("Full redraw of the %s screen: %.2f ms", name, (micros() - start) / 1000.0f);
+}
+
+void telemetryLoopPass(unsigned long us) {
+  if (us > telemetry.window.loopMaxUs) telemetry.window.loopMaxUs = us;
+}
+
+#endif
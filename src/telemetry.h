@@ -0,0 +1,20 @@
+// Frame time and render cost telemetry, only compiled with -D PERF_TELEMETRY.
+// Samples once per second: refreshes, render and flush time from the display events, LVGL CPU load and memory.
+// The sample is shown on an overlay label and written to the serial port as a CSV line starting with "PERF,",
+// tools/perf_summary.py turns a capture into percentiles.
+#pragma once
+
+#ifdef PERF_TELEMETRY
+
+#include <lvgl.h>
+
+// Hook into the display events and start the sampler, label shows the overlay (nullptr for CSV only)
+void telemetryInit(lv_display_t *display, lv_obj_t *label);
+
+// Load the screen, redraw all of it at once and log how long that took (style resolution, render and flush)
+void telemetryMeasureScreen(lv_obj_t *screen, const char *name);
+
+// Duration of one pass of loop(), the worst one of each second is reported
+void telemetryLoopPass(unsigned long us);
+
+#endif
@@ -0,0 +1,91 @@
+// Shared styles of the weather station screens, see theme.h
+#include "theme.h"
+
+#include "layout.h"
+
+Theme theme;
+
+void themeInit() {
+  lv_style_init(&theme.screen);
+  lv_style_set_bg_color(&theme.screen, lv_color_hex(0x0d1117));
+  lv_style_set_bg_grad_color(&theme.screen, lv_color_hex(0x161b22));
+  if (layout.gradients) lv_style_set_bg_grad_dir(&theme.screen, LV_GRAD_DIR_VER);
+
+  lv_style_init(&theme.card);
+  lv_style_set_bg_color(&theme.card, lv_color_hex(0x1a1a1a));
+  lv_style_set_bg_grad_color(&theme.card, lv_color_hex(0x2a2a2a));
+  if (layout.gradients) lv_style_set_bg_grad_dir(&theme.card, LV_GRAD_DIR_VER);
+  lv_style_set_radius(&theme.card, layout.cardRadius);
+  if (layout.cardPad >= 0) lv_style_set_pad_all(&theme.card, layout.cardPad);
+  lv_style_set_border_width(&theme.card, 1);
+  lv_style_set_border_color(&theme.card, lv_color_hex(0x444444));
+  if (layout.shadows) {
+    lv_style_set_shadow_width(&theme.card, 8);
+    lv_style_set_shadow_color(&theme.card, lv_color_black());
+    lv_style_set_shadow_opa(&theme.card, LV_OPA_50);
+    lv_style_set_shadow_offset_x(&theme.card, 2);
+    lv_style_set_shadow_offset_y(&theme.card, 2);
+  }
+
+  lv_style_init(&theme.button);
+  lv_style_set_bg_color(&theme.button, lv_color_hex(0x3366ff));
+  lv_style_set_bg_grad_color(&theme.button, lv_color_hex(0x1a4dff));
+  if (layout.gradients) lv_style_set_bg_grad_dir(&theme.button, LV_GRAD_DIR_VER);
+  lv_style_set_radius(&theme.button, 8);
+  lv_style_set_border_width(&theme.button, 1);
+  lv_style_set_border_color(&theme.button, lv_color_hex(0x4d79ff));
+  if (layout.shadows) {
+    lv_style_set_shadow_width(&theme.button, 4);
+    lv_style_set_shadow_color(&theme.button, lv_color_black());
+    lv_style_set_shadow_opa(&theme.button, LV_OPA_30);
+  }
+
+  lv_style_init(&theme.buttonPressed);
+  lv_style_set_bg_color(&theme.buttonPressed, lv_color_hex(0x1a4dff));
+  lv_style_set_bg_grad_color(&theme.buttonPressed, lv_color_hex(0x0d33cc));
+
+  lv_style_init(&theme.textArea);
+  lv_style_set_bg_color(&theme.textArea, lv_color_hex(0x2a2a2a));
+  lv_style_set_bg_grad_color(&theme.textArea, lv_color_hex(0x1a1a1a));
+  if (layout.gradients) lv_style_set_bg_grad_dir(&theme.textArea, LV_GRAD_DIR_VER);
+  lv_style_set_text_color(&theme.textArea, lv_color_white());
+  lv_style_set_radius(&theme.textArea, 6);
+  lv_style_set_border_width(&theme.textArea, 1);
+  lv_style_set_border_color(&theme.textArea, lv_color_hex(0x444444));
+  lv_style_set_pad_all(&theme.textArea, 8);
+
+  lv_style_init(&theme.textAreaFocused);
+  lv_style_set_border_color(&theme.textAreaFocused, lv_color_hex(0x3366ff));
+  lv_style_set_border_width(&theme.textAreaFocused, 2);
+
+  lv_style_init(&theme.textAreaCursor);
+  lv_style_set_bg_color(&theme.textAreaCursor, lv_color_white());
+
+  lv_style_init(&theme.label);
+  lv_style_set_text_color(&theme.label, lv_color_white());
+  lv_style_set_text_font(&theme.label, layout.font);
+
+  lv_style_init(&theme.title);
+  lv_style_set_text_color(&theme.title, lv_color_hex(0x3366ff));
+
+  lv_style_init(&theme.muted);
+  lv_style_set_text_color(&theme.muted, lv_color_hex(0x888888));
+
+  lv_style_init(&theme.formLabel);
+  lv_style_set_text_color(&theme.formLabel, lv_color_hex(0xcccccc));
+
+  lv_style_init(&theme.bigLabel);
+  lv_style_set_text_color(&theme.bigLabel, lv_color_white());
+  lv_style_set_text_font(&theme.bigLabel, layout.bigFont);
+}
+
+void themeAdd(lv_obj_t *obj, lv_style_t *style, lv_style_selector_t selector) {
+#ifdef THEME_LOCAL_STYLES
+  for (lv_style_prop_t prop = 1; prop < _LV_STYLE_LAST_BUILT_IN_PROP; prop++) {
+    lv_style_value_t value;
+    if (lv_style_get_prop(style, prop, &value) == LV_STYLE_RES_FOUND) lv_obj_set_local_style_prop(obj, prop, value, selector);
+  }
+#else
+  lv_obj_add_style(obj, style, selector);
+#endif
+}
@@ -0,0 +1,30 @@
+// Shared styles of the weather station screens.
+// Each style is initialized once and added to the objects with lv_obj_add_style(), so objects
+// only hold a pointer to it instead of a local style list of their own.
+// Radius, padding, fonts, shadows and gradients follow the layout profile of the board (layout.h).
+#pragma once
+
+#include <lvgl.h>
+
+struct Theme {
+  lv_style_t screen;           // Screen background gradient
+  lv_style_t card;             // Card panel: gradient, radius, border and shadow
+  lv_style_t button;           // Gradient button
+  lv_style_t buttonPressed;    // Added with LV_STATE_PRESSED
+  lv_style_t textArea;         // Text area of the settings form
+  lv_style_t textAreaFocused;  // Added with LV_STATE_FOCUSED
+  lv_style_t textAreaCursor;   // Added to LV_PART_CURSOR
+  lv_style_t label;            // White text in the default font
+  lv_style_t title;            // Card titles, accent color
+  lv_style_t muted;            // Secondary text
+  lv_style_t formLabel;        // Captions of the settings form
+  lv_style_t bigLabel;         // Big clock
+};
+extern Theme theme;
+
+// Initialize all styles, must run before the first screen is built
+void themeInit();
+
+// Add a shared style to an object. Built with -D THEME_LOCAL_STYLES, its properties are copied into the local style
+// list of the object instead, as the screens were styled before this module, to measure both from the same tree.
+void themeAdd(lv_obj_t *obj, lv_style_t *style, lv_style_selector_t selector);
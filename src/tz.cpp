@@ -0,0 +1,53 @@
+// Offline UTC offset lookup, see tz.h
+#include "tz.h"
+
+#include "calc.h"
+#include "tz_tables.h"
+
+// UTC epoch of a POSIX Mm.w.d transition at timeOfDay seconds local time, with utcOffset in effect before it
+static int64_t transitionUtc(int year, int month, int week, int wday, long timeOfDay, long utcOffset) {
+  long first = daysFromCivil(year, month, 1);
+  int firstWday = (int)((first + 4) % 7);  // 1970-01-01 was a Thursday
+  int day = 1 + (wday - firstWday + 7) % 7 + 7 * (week - 1);
+  int length = (int)(daysFromCivil(year + (month == 12), month % 12 + 1, 1) - first);
+  while (day > length) day -= 7;  // Week 5 means the last one of the month
+  return (int64_t)(first + day - 1) * 86400 + timeOfDay - utcOffset;
+}
+
+bool offlineUtcOffset(float lat, float lon, unsigned long nowUtc, long &offsetSeconds) {
+  if (!(lat >= -90 && lat <= 90 && lon >= -180 && lon <= 180)) return false;
+  int row = (int)((lat + 90) / TZ_CELL_DEG);
+  int col = (int)((lon + 180) / TZ_CELL_DEG);
+  if (row >= TZ_ROWS) row = TZ_ROWS - 1;
+  if (col >= TZ_COLS) col = TZ_COLS - 1;
+  // Binary search for the run of the row that covers the column
+  int lo = TZ_ROW_START[row], hi = TZ_ROW_START[row + 1] - 1;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (TZ_RUNS[mid].endCol > col)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  const TzRule &rule = TZ_RULES[TZ_RUNS[lo].rule];
+  // Transitions that do not follow the rule, from the first one until the last one, after which the rule holds again
+  const TzTransition *transitions = &TZ_TRANSITIONS[rule.firstTransition];
+  if (rule.transitionCount && nowUtc >= transitions[0].utc && nowUtc < transitions[rule.transitionCount - 1].utc) {
+    int i = 0;
+    while (transitions[i + 1].utc <= nowUtc) i++;
+    offsetSeconds = transitions[i].offset;
+    return true;
+  }
+  offsetSeconds = rule.stdOffset;
+  if (rule.startMonth == 0) return true;
+  int year;
+  unsigned month, day;
+  civilFromDays(nowUtc / 86400, year, month, day);
+  int64_t start = transitionUtc(year, rule.startMonth, rule.startWeek, rule.startWday, rule.startTime, rule.stdOffset);
+  int64_t end = transitionUtc(year, rule.endMonth, rule.endWeek, rule.endWday, rule.endTime, rule.dstOffset);
+  int64_t now = nowUtc;
+  // Southern hemisphere rules start DST late in the year and end it early in the next one
+  bool dst = start < end ? (now >= start && now < end) : (now >= start || now < end);
+  if (dst) offsetSeconds = rule.dstOffset;
+  return true;
+}
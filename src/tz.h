@@ -0,0 +1,8 @@
+// Offline lat/lon to UTC offset lookup from the generated tables in tz_tables.h.
+// Regenerate the tables with: pio run -t tztables
+// The committed grid assigns each 0.5 degree cell to the nearest zone.tab city. Near a border with a zone of another
+// rule it can give the neighbour's offset; tables generated with --boundaries follow the real borders to within a cell.
+#pragma once
+
+// Sets offsetSeconds to the UTC offset (including daylight saving time) at nowUtc for the position
+bool offlineUtcOffset(float lat, float lon, unsigned long nowUtc, long &offsetSeconds);
@@ -0,0 +1,1008 @@
+// Generated by tools/gen_tz_tables.py, do not edit. Regenerate with: pio run -t tztables
+// Grid source: nearest zone.tab location, 0.5 deg cells, 67 rules, 134 transitions, 6808 runs
+#pragma once
+
+#include <stdint.h>
+
+constexpr float TZ_CELL_DEG = 0.5f;
+constexpr int TZ_ROWS = 360;
+constexpr int TZ_COLS = 720;
+
+// Offsets in seconds east of UTC, transitions as POSIX Mm.w.d at a local time of day in seconds
+struct TzRule {
+  int32_t stdOffset;
+  int32_t dstOffset;  // May be below stdOffset (Europe/Dublin), even 0
+  uint8_t startMonth, startWeek, startWday;  // startMonth 0: no daylight saving time
+  int32_t startTime;
+  uint8_t endMonth, endWeek, endWday;
+  int32_t endTime;
+  uint16_t firstTransition, transitionCount;  // In TZ_TRANSITIONS, used instead of the rule until the last one
+};
+
+// Explicit transition of a zone that does not follow its rule: offset from utc on
+struct TzTransition {
+  uint32_t utc;
+  int32_t offset;
+};
+
+// Run of cells in a grid row, covering columns up to (excluding) endCol
+struct TzRun {
+  uint16_t endCol;
+  uint16_t rule;
+};
+
+constexpr TzRule TZ_RULES[67] = {
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // GMT0
+  {10800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // EAT-3
+  {3600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // CET-1
+  {7200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // CAT-2
+  {7200, 10800, 4, 5, 5, 0, 10, 5, 4, 86400, 0, 0},  // EET-2EEST,M4.5.5/0,M10.5.4/24
+  {3600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54},  // <+01>-1
+  {3600, 7200, 3, 5, 0, 7200, 10, 5, 0, 10800, 0, 0},  // CET-1CEST,M3.5.0,M10.5.0/3
+  {-36000, -32400, 3, 2, 0, 7200, 11, 1, 0, 7200, 0, 0},  // HST10HDT,M3.2.0,M11.1.0
+  {-32400, -28800, 3, 2, 0, 7200, 11, 1, 0, 7200, 0, 0},  // AKST9AKDT,M3.2.0,M11.1.0
+  {-14400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // AST4
+  {-10800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <-03>3
+  {-10800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 4},  // <-03>3
+  {-18000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // EST5
+  {-21600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // CST6
+  {-25200, -21600, 3, 2, 0, 7200, 11, 1, 0, 7200, 0, 0},  // MST7MDT,M3.2.0,M11.1.0
+  {-21600, -18000, 3, 2, 0, 7200, 11, 1, 0, 7200, 0, 0},  // CST6CDT,M3.2.0,M11.1.0
+  {-10800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 4},  // <-03>3
+  {-25200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // MST7
+  {-18000, -14400, 3, 2, 0, 7200, 11, 1, 0, 7200, 0, 0},  // EST5EDT,M3.2.0,M11.1.0
+  {-14400, -10800, 3, 2, 0, 7200, 11, 1, 0, 7200, 0, 0},  // AST4ADT,M3.2.0,M11.1.0
+  {-18000, -14400, 3, 2, 0, 0, 11, 1, 0, 3600, 0, 0},  // CST5CDT,M3.2.0/0,M11.1.0/1
+  {-28800, -25200, 3, 2, 0, 7200, 11, 1, 0, 7200, 0, 0},  // PST8PDT,M3.2.0,M11.1.0
+  {-10800, -7200, 3, 2, 0, 7200, 11, 1, 0, 7200, 0, 0},  // <-03>3<-02>,M3.2.0,M11.1.0
+  {-7200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <-02>2
+  {-7200, -3600, 3, 5, 0, -3600, 10, 5, 0, 0, 0, 0},  // <-02>2<-01>,M3.5.0/-1,M10.5.0/0
+  {-14400, -10800, 9, 1, 6, 86400, 4, 1, 6, 86400, 0, 0},  // <-04>4<-03>,M9.1.6/24,M4.1.6/24
+  {-12600, -9000, 3, 2, 0, 7200, 11, 1, 0, 7200, 0, 0},  // NST3:30NDT,M3.2.0,M11.1.0
+  {28800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+08>-8
+  {25200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+07>-7
+  {36000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+10>-10
+  {36000, 39600, 10, 1, 0, 7200, 4, 1, 0, 10800, 0, 0},  // AEST-10AEDT,M10.1.0,M4.1.0/3
+  {18000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+05>-5
+  {43200, 46800, 9, 5, 0, 7200, 4, 1, 0, 10800, 0, 0},  // NZST-12NZDT,M9.5.0,M4.1.0/3
+  {0, 7200, 3, 5, 0, 3600, 10, 5, 0, 10800, 0, 0},  // <+00>0<+02>-2,M3.5.0/1,M10.5.0/3
+  {43200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+12>-12
+  {14400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+04>-4
+  {7200, 10800, 3, 5, 0, 0, 10, 5, 0, 0, 0, 0},  // EET-2EEST,M3.5.0/0,M10.5.0/0
+  {21600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+06>-6
+  {32400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+09>-9
+  {19800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+0530>-5:30
+  {7200, 10800, 3, 5, 0, 10800, 10, 5, 0, 14400, 0, 0},  // EET-2EEST,M3.5.0/3,M10.5.0/4
+  {7200, 10800, 3, 4, 4, 180000, 10, 4, 4, 180000, 62, 72},  // EET-2EEST,M3.4.4/50,M10.4.4/50
+  {7200, 10800, 3, 4, 4, 93600, 10, 5, 0, 7200, 0, 0},  // IST-2IDT,M3.4.4/26,M10.5.0
+  {16200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+0430>-4:30
+  {20700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+0545>-5:45
+  {39600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+11>-11
+  {12600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+0330>-3:30
+  {23400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+0630>-6:30
+  {-3600, 0, 3, 5, 0, 0, 10, 5, 0, 3600, 0, 0},  // <-01>1<+00>,M3.5.0/0,M10.5.0/1
+  {0, 3600, 3, 5, 0, 3600, 10, 5, 0, 7200, 0, 0},  // WET0WEST,M3.5.0/1,M10.5.0
+  {-3600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <-01>1
+  {34200, 37800, 10, 1, 0, 7200, 4, 1, 0, 10800, 0, 0},  // ACST-9:30ACDT,M10.1.0,M4.1.0/3
+  {34200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // ACST-9:30
+  {31500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+0845>-8:45
+  {37800, 39600, 10, 1, 0, 7200, 4, 1, 0, 7200, 0, 0},  // <+1030>-10:30<+11>-11,M10.1.0,M4.1.0
+  {7200, 10800, 3, 5, 0, 7200, 10, 5, 0, 10800, 0, 0},  // EET-2EEST,M3.5.0,M10.5.0/3
+  {3600, 0, 10, 5, 0, 7200, 3, 5, 0, 3600, 0, 0},  // IST-1GMT0,M10.5.0,M3.5.0/1
+  {46800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+13>-13
+  {45900, 49500, 9, 5, 0, 9900, 4, 1, 0, 13500, 0, 0},  // <+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45
+  {-21600, -18000, 9, 1, 6, 79200, 4, 1, 6, 79200, 0, 0},  // <-06>6<-05>,M9.1.6/22,M4.1.6/22
+  {-32400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <-09>9
+  {-36000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // HST10
+  {50400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <+14>-14
+  {-34200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <-0930>9:30
+  {-39600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // SST11
+  {39600, 43200, 10, 1, 0, 7200, 4, 1, 0, 10800, 0, 0},  // <+11>-11<+12>,M10.1.0,M4.1.0/3
+  {-28800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // <-08>8
+};
+
+constexpr TzTransition TZ_TRANSITIONS[134] = {
+  {1710036000, 0}, {1713060000, 3600}, {1740276000, 0}, {1743904800, 3600}, {1771120800, 0}, {1774144800, 3600},
+  {1801965600, 0}, {1804989600, 3600}, {1832205600, 0}, {1835834400, 3600}, {1863050400, 0}, {1866074400, 3600},
+  {1893290400, 0}, {1896919200, 3600}, {1924135200, 0}, {1927159200, 3600}, {1954980000, 0}, {1958004000, 3600},
+  {1985220000, 0}, {1988848800, 3600}, {2016064800, 0}, {2019088800, 3600}, {2046304800, 0}, {2049933600, 3600},
+  {2077149600, 0}, {2080778400, 3600}, {2107994400, 0}, {2111018400, 3600}, {2138234400, 0}, {2141863200, 3600},
+  {2169079200, 0}, {2172103200, 3600}, {2199924000, 0}, {2202948000, 3600}, {2230164000, 0}, {2233792800, 3600},
+  {2261008800, 0}, {2264032800, 3600}, {2291248800, 0}, {2294877600, 3600}, {2322093600, 0}, {2325722400, 3600},
+  {2352938400, 0}, {2355962400, 3600}, {2383178400, 0}, {2386807200, 3600}, {2414023200, 0}, {2417047200, 3600},
+  {2444868000, 0}, {2447892000, 3600}, {2475108000, 0}, {2478736800, 3600}, {2505952800, 0}, {2508976800, 3600},
+  {1711249200, -14400}, {1728187200, -10800}, {1728961200, -10800}, {2147483647, -10800}, {1712458800, -14400}, {1725768000, -10800},
+  {1742439600, -10800}, {2147483647, -10800}, {1713571200, 10800}, {1729897200, 7200}, {1744416000, 10800}, {1761346800, 7200},
+  {1774656000, 10800}, {1792796400, 7200}, {1806105600, 10800}, {1824850800, 7200}, {1837555200, 10800}, {1856300400, 7200},
+  {1869004800, 10800}, {1887750000, 7200}, {1901059200, 10800}, {1919199600, 7200}, {1932508800, 10800}, {1950649200, 7200},
+  {1963958400, 10800}, {1982703600, 7200}, {1995408000, 10800}, {2014153200, 7200}, {2026857600, 10800}, {2045602800, 7200},
+  {2058307200, 10800}, {2077052400, 7200}, {2090361600, 10800}, {2107897200, 7200}, {2121811200, 10800}, {2138742000, 7200},
+  {2153260800, 10800}, {2168982000, 7200}, {2184710400, 10800}, {2199826800, 7200}, {2216160000, 10800}, {2230066800, 7200},
+  {2234304000, 10800}, {2234905200, 7200}, {2248214400, 10800}, {2260911600, 7200}, {2264544000, 10800}, {2266354800, 7200},
+  {2279664000, 10800}, {2291756400, 7200}, {2295388800, 10800}, {2297804400, 7200}, {2311113600, 10800}, {2321996400, 7200},
+  {2326233600, 10800}, {2329254000, 7200}, {2342563200, 10800}, {2352841200, 7200}, {2356473600, 10800}, {2361308400, 7200},
+  {2374012800, 10800}, {2383686000, 7200}, {2387318400, 10800}, {2392758000, 7200}, {2405462400, 10800}, {2413926000, 7200},
+  {2418163200, 10800}, {2424207600, 7200}, {2437516800, 10800}, {2444770800, 7200}, {2448403200, 10800}, {2455657200, 7200},
+  {2468966400, 10800}, {2475010800, 7200}, {2479248000, 10800}, {2487106800, 7200}, {2500416000, 10800}, {2505855600, 7200},
+  {2509488000, 10800}, {2519161200, 7200},
+};
+
+constexpr uint16_t TZ_ROW_START[361] = {
+  0, 1, 4, 7, 10, 13, 16, 19, 22, 27, 31, 35, 39, 44, 49, 54,
+  59, 64, 69, 75, 81, 87, 93, 99, 105, 111, 117, 125, 133, 141, 149, 157,
+  166, 175, 184, 193, 204, 214, 223, 232, 241, 250, 259, 268, 277, 286, 295, 305,
+  315, 325, 336, 347, 358, 369, 380, 391, 402, 413, 425, 437, 449, 461, 473, 485,
+  497, 509, 521, 533, 545, 555, 566, 577, 588, 600, 612, 624, 636, 648, 659, 670,
+  681, 693, 707, 722, 736, 750, 765, 779, 793, 807, 821, 835, 849, 864, 879, 894,
+  910, 926, 942, 959, 976, 992, 1011, 1030, 1050, 1070, 1090, 1110, 1130, 1150, 1170, 1190,
+  1210, 1230, 1250, 1271, 1292, 1313, 1334, 1356, 1378, 1403, 1427, 1451, 1474, 1497, 1520, 1543,
+  1568, 1593, 1619, 1645, 1670, 1694, 1720, 1745, 1771, 1798, 1823, 1848, 1872, 1897, 1922, 1945,
+  1967, 1990, 2014, 2039, 2065, 2091, 2117, 2143, 2169, 2195, 2223, 2249, 2275, 2301, 2327, 2353,
+  2379, 2405, 2432, 2459, 2486, 2513, 2540, 2566, 2591, 2616, 2641, 2668, 2693, 2718, 2743, 2768,
+  2792, 2817, 2840, 2862, 2885, 2908, 2931, 2954, 2977, 3000, 3023, 3046, 3068, 3090, 3112, 3134,
+  3158, 3182, 3206, 3231, 3257, 3283, 3306, 3329, 3352, 3375, 3398, 3423, 3447, 3471, 3495, 3519,
+  3543, 3566, 3590, 3614, 3638, 3662, 3687, 3711, 3735, 3759, 3783, 3807, 3831, 3854, 3877, 3904,
+  3930, 3962, 3993, 4023, 4054, 4086, 4118, 4150, 4183, 4215, 4246, 4280, 4313, 4347, 4376, 4405,
+  4435, 4460, 4486, 4512, 4539, 4568, 4597, 4628, 4659, 4688, 4716, 4743, 4772, 4802, 4834, 4868,
+  4900, 4937, 4971, 5003, 5038, 5065, 5091, 5117, 5142, 5168, 5193, 5218, 5243, 5270, 5298, 5327,
+  5356, 5388, 5420, 5452, 5483, 5514, 5545, 5575, 5603, 5631, 5659, 5688, 5717, 5746, 5776, 5807,
+  5835, 5861, 5889, 5916, 5944, 5971, 5998, 6022, 6043, 6063, 6084, 6104, 6125, 6144, 6163, 6182,
+  6202, 6221, 6240, 6259, 6278, 6299, 6320, 6339, 6357, 6375, 6393, 6412, 6429, 6446, 6462, 6479,
+  6493, 6507, 6521, 6534, 6547, 6560, 6573, 6586, 6600, 6611, 6622, 6633, 6643, 6653, 6663, 6672,
+  6681, 6690, 6699, 6706, 6713, 6720, 6727, 6734, 6740, 6746, 6751, 6757, 6763, 6769, 6774, 6780,
+  6786, 6790, 6794, 6797, 6800, 6803, 6806, 6807, 6808,
+};
+
+constexpr TzRun TZ_RUNS[6808] = {
+  {720, 31}, {7, 31}, {170, 32}, {720, 31}, {215, 32}, {683, 31}, {720, 32}, {231, 32},
+  {667, 31}, {720, 32}, {240, 32}, {658, 31}, {720, 32}, {245, 32}, {653, 31}, {720, 32},
+  {249, 32}, {649, 31}, {720, 32}, {251, 32}, {646, 31}, {720, 32}, {253, 32}, {268, 31},
+  {349, 33}, {644, 31}, {720, 32}, {248, 32}, {374, 33}, {643, 31}, {720, 32}, {240, 32},
+  {389, 33}, {641, 31}, {720, 32}, {233, 32}, {400, 33}, {640, 31}, {720, 32}, {213, 32},
+  {237, 10}, {409, 33}, {639, 31}, {720, 32}, {197, 32}, {243, 10}, {416, 33}, {638, 31},
+  {720, 32}, {185, 32}, {248, 10}, {422, 33}, {638, 31}, {720, 32}, {176, 32}, {253, 10},
+  {426, 33}, {637, 31}, {720, 32}, {169, 32}, {257, 10}, {431, 33}, {637, 31}, {720, 32},
+  {163, 32}, {260, 10}, {434, 33}, {636, 31}, {720, 32}, {157, 32}, {263, 10}, {437, 33},
+  {438, 1}, {636, 31}, {720, 32}, {153, 32}, {266, 10}, {433, 33}, {447, 1}, {635, 31},
+  {720, 32}, {149, 32}, {268, 10}, {430, 33}, {454, 1}, {635, 31}, {720, 32}, {145, 32},
+  {270, 10}, {427, 33}, {460, 1}, {635, 31}, {720, 32}, {142, 32}, {272, 10}, {425, 33},
+  {466, 1}, {635, 31}, {720, 32}, {139, 32}, {274, 10}, {423, 33}, {470, 1}, {634, 31},
+  {720, 32}, {136, 32}, {276, 10}, {421, 33}, {474, 1}, {634, 31}, {720, 32}, {134, 32},
+  {277, 10}, {419, 33}, {476, 1}, {634, 31}, {720, 32}, {132, 32}, {279, 10}, {417, 33},
+  {475, 1}, {487, 31}, {489, 28}, {634, 31}, {720, 32}, {130, 32}, {280, 10}, {416, 33},
+  {474, 1}, {489, 31}, {503, 28}, {633, 31}, {720, 32}, {128, 32}, {281, 10}, {414, 33},
+  {473, 1}, {490, 31}, {513, 28}, {633, 31}, {720, 32}, {126, 32}, {282, 10}, {413, 33},
+  {472, 1}, {491, 31}, {521, 28}, {633, 31}, {720, 32}, {125, 32}, {283, 10}, {412, 33},
+  {471, 1}, {492, 31}, {528, 28}, {633, 31}, {720, 32}, {123, 32}, {284, 10}, {410, 33},
+  {470, 1}, {493, 31}, {533, 28}, {630, 31}, {637, 29}, {720, 32}, {122, 32}, {285, 10},
+  {409, 33}, {469, 1}, {494, 31}, {538, 28}, {624, 31}, {645, 29}, {720, 32}, {120, 32},
+  {286, 10}, {408, 33}, {468, 1}, {494, 31}, {543, 28}, {619, 31}, {652, 29}, {720, 32},
+  {119, 32}, {287, 10}, {407, 33}, {468, 1}, {495, 31}, {547, 28}, {614, 31}, {657, 29},
+  {720, 32}, {118, 32}, {287, 10}, {406, 33}, {467, 1}, {496, 31}, {550, 28}, {572, 31},
+  {604, 27}, {610, 31}, {662, 29}, {720, 32}, {117, 32}, {288, 10}, {405, 33}, {466, 1},
+  {497, 31}, {554, 28}, {556, 31}, {609, 27}, {667, 29}, {720, 32}, {116, 32}, {289, 10},
+  {405, 33}, {466, 1}, {497, 31}, {554, 28}, {609, 27}, {671, 29}, {720, 32}, {115, 32},
+  {289, 10}, {404, 33}, {465, 1}, {498, 31}, {553, 28}, {610, 27}, {675, 29}, {720, 32},
+  {114, 32}, {290, 10}, {403, 33}, {465, 1}, {498, 31}, {552, 28}, {610, 27}, {678, 29},
+  {720, 32}, {113, 32}, {291, 10}, {402, 33}, {464, 1}, {499, 31}, {552, 28}, {610, 27},
+  {681, 29}, {720, 32}, {112, 32}, {291, 10}, {402, 33}, {464, 1}, {500, 31}, {551, 28},
+  {610, 27}, {684, 29}, {720, 32}, {111, 32}, {292, 10}, {401, 33}, {463, 1}, {500, 31},
+  {551, 28}, {610, 27}, {687, 29}, {720, 32}, {111, 32}, {293, 10}, {400, 33}, {463, 1},
+  {501, 31}, {550, 28}, {610, 27}, {690, 29}, {720, 32}, {110, 32}, {294, 10}, {400, 33},
+  {462, 1}, {501, 31}, {550, 28}, {610, 27}, {692, 29}, {720, 32}, {109, 32}, {295, 10},
+  {399, 33}, {462, 1}, {501, 31}, {549, 28}, {610, 27}, {694, 29}, {720, 32}, {108, 32},
+  {293, 10}, {298, 23}, {399, 33}, {462, 1}, {502, 31}, {549, 28}, {610, 27}, {697, 29},
+  {720, 32}, {108, 32}, {290, 10}, {302, 23}, {398, 33}, {461, 1}, {502, 31}, {548, 28},
+  {610, 27}, {699, 29}, {720, 32}, {107, 32}, {287, 10}, {305, 23}, {398, 33}, {461, 1},
+  {503, 31}, {548, 28}, {611, 27}, {701, 29}, {720, 32}, {107, 32}, {284, 10}, {308, 23},
+  {397, 33}, {460, 1}, {503, 31}, {547, 28}, {611, 27}, {699, 29}, {705, 30}, {720, 32},
+  {106, 32}, {282, 10}, {311, 23}, {397, 33}, {460, 1}, {503, 31}, {547, 28}, {611, 27},
+  {693, 29}, {713, 30}, {720, 32}, {105, 32}, {279, 10}, {314, 23}, {396, 33}, {460, 1},
+  {504, 31}, {547, 28}, {611, 27}, {687, 29}, {719, 30}, {720, 32}, {4, 30}, {105, 32},
+  {277, 10}, {317, 23}, {396, 33}, {459, 1}, {504, 31}, {546, 28}, {611, 27}, {683, 29},
+  {720, 30}, {8, 30}, {104, 32}, {275, 10}, {319, 23}, {396, 33}, {459, 1}, {504, 31},
+  {546, 28}, {611, 27}, {678, 29}, {720, 30}, {13, 30}, {104, 32}, {273, 10}, {322, 23},
+  {395, 33}, {459, 1}, {505, 31}, {545, 28}, {611, 27}, {674, 29}, {720, 30}, {16, 30},
+  {103, 32}, {271, 10}, {324, 23}, {395, 33}, {459, 1}, {505, 31}, {545, 28}, {611, 27},
+  {671, 29}, {720, 30}, {20, 30}, {103, 32}, {269, 10}, {326, 23}, {394, 33}, {458, 1},
+  {505, 31}, {545, 28}, {611, 27}, {668, 29}, {720, 30}, {21, 30}, {36, 58}, {102, 32},
+  {267, 10}, {328, 23}, {394, 33}, {458, 1}, {506, 31}, {544, 28}, {611, 27}, {665, 29},
+  {720, 30}, {18, 30}, {48, 58}, {102, 32}, {265, 10}, {330, 23}, {394, 33}, {458, 1},
+  {506, 31}, {544, 28}, {611, 27}, {662, 29}, {720, 30}, {16, 30}, {57, 58}, {102, 32},
+  {264, 10}, {332, 23}, {393, 33}, {458, 1}, {506, 31}, {544, 28}, {611, 27}, {659, 29},
+  {720, 30}, {14, 30}, {63, 58}, {101, 32}, {262, 10}, {334, 23}, {393, 33}, {457, 1},
+  {506, 31}, {544, 28}, {611, 27}, {656, 29}, {720, 30}, {12, 30}, {68, 58}, {101, 32},
+  {261, 10}, {335, 23}, {393, 33}, {457, 1}, {507, 31}, {543, 28}, {611, 27}, {654, 29},
+  {720, 30}, {10, 30}, {73, 58}, {100, 32}, {261, 10}, {337, 23}, {392, 33}, {457, 1},
+  {511, 31}, {543, 28}, {611, 27}, {652, 29}, {720, 30}, {8, 30}, {78, 58}, {100, 32},
+  {261, 10}, {339, 23}, {392, 33}, {457, 1}, {518, 31}, {543, 28}, {611, 27}, {649, 29},
+  {720, 30}, {6, 30}, {81, 58}, {100, 32}, {262, 10}, {340, 23}, {392, 33}, {456, 1},
+  {525, 31}, {543, 28}, {611, 27}, {647, 29}, {720, 30}, {5, 30}, {85, 58}, {99, 32},
+  {262, 10}, {342, 23}, {392, 33}, {456, 1}, {530, 31}, {542, 28}, {612, 27}, {645, 29},
+  {720, 30}, {3, 30}, {88, 58}, {99, 32}, {263, 10}, {343, 23}, {391, 33}, {456, 1},
+  {534, 31}, {542, 28}, {612, 27}, {643, 29}, {720, 30}, {1, 30}, {92, 58}, {99, 32},
+  {263, 10}, {344, 23}, {391, 33}, {456, 1}, {538, 31}, {542, 28}, {612, 27}, {642, 29},
+  {720, 30}, {94, 58}, {98, 32}, {263, 10}, {346, 23}, {391, 33}, {456, 1}, {542, 31},
+  {612, 27}, {640, 29}, {720, 30}, {95, 58}, {101, 66}, {264, 10}, {347, 23}, {391, 33},
+  {455, 1}, {543, 31}, {612, 27}, {638, 29}, {718, 30}, {720, 58}, {94, 58}, {106, 66},
+  {264, 10}, {348, 23}, {390, 33}, {455, 1}, {545, 31}, {612, 27}, {636, 29}, {717, 30},
+  {720, 58}, {92, 58}, {109, 66}, {264, 10}, {349, 23}, {390, 33}, {454, 1}, {546, 31},
+  {612, 27}, {635, 29}, {716, 30}, {720, 58}, {91, 58}, {110, 66}, {121, 59}, {265, 10},
+  {351, 23}, {390, 33}, {452, 1}, {547, 31}, {612, 27}, {633, 29}, {714, 30}, {720, 58},
+  {90, 58}, {110, 66}, {128, 59}, {265, 10}, {352, 23}, {390, 33}, {451, 1}, {548, 31},
+  {612, 27}, {627, 29}, {713, 30}, {720, 58}, {88, 58}, {111, 66}, {131, 59}, {265, 10},
+  {353, 23}, {389, 33}, {449, 1}, {549, 31}, {612, 27}, {622, 29}, {712, 30}, {720, 58},
+  {87, 58}, {111, 66}, {134, 59}, {266, 10}, {354, 23}, {389, 33}, {448, 1}, {550, 31},
+  {612, 27}, {618, 29}, {710, 30}, {720, 58}, {86, 58}, {111, 66}, {136, 59}, {266, 10},
+  {355, 23}, {389, 33}, {446, 1}, {551, 31}, {612, 27}, {614, 29}, {709, 30}, {720, 58},
+  {85, 58}, {112, 66}, {139, 59}, {266, 10}, {356, 23}, {389, 33}, {445, 1}, {553, 31},
+  {611, 27}, {708, 30}, {720, 58}, {83, 58}, {112, 66}, {141, 59}, {267, 10}, {357, 23},
+  {389, 33}, {443, 1}, {554, 31}, {610, 27}, {707, 30}, {720, 58}, {82, 58}, {112, 66},
+  {143, 59}, {267, 10}, {358, 23}, {388, 33}, {442, 1}, {555, 31}, {608, 27}, {706, 30},
+  {720, 58}, {81, 58}, {112, 66}, {145, 59}, {267, 10}, {359, 23}, {387, 33}, {413, 3},
+  {441, 1}, {556, 31}, {607, 27}, {705, 30}, {720, 58}, {80, 58}, {113, 66}, {148, 59},
+  {184, 10}, {212, 16}, {268, 10}, {360, 23}, {383, 33}, {424, 3}, {439, 1}, {556, 31},
+  {606, 27}, {704, 30}, {720, 58}, {79, 58}, {113, 66}, {150, 59}, {174, 10}, {217, 16},
+  {268, 10}, {361, 23}, {380, 33}, {432, 3}, {438, 1}, {557, 31}, {606, 27}, {607, 53},
+  {703, 30}, {720, 58}, {78, 58}, {113, 66}, {151, 59}, {167, 10}, {222, 16}, {268, 10},
+  {361, 23}, {376, 33}, {437, 3}, {558, 31}, {606, 27}, {609, 53}, {702, 30}, {720, 58},
+  {77, 58}, {113, 66}, {153, 59}, {161, 10}, {226, 16}, {268, 10}, {362, 23}, {373, 33},
+  {439, 3}, {559, 31}, {606, 27}, {610, 53}, {701, 30}, {720, 58}, {76, 58}, {113, 66},
+  {155, 59}, {156, 10}, {230, 16}, {269, 10}, {363, 23}, {370, 33}, {440, 3}, {559, 31},
+  {606, 27}, {611, 53}, {613, 51}, {700, 30}, {720, 58}, {75, 58}, {114, 66}, {156, 59},
+  {233, 16}, {269, 10}, {364, 23}, {367, 33}, {441, 3}, {559, 31}, {606, 27}, {612, 53},
+  {616, 51}, {699, 30}, {720, 58}, {74, 58}, {114, 66}, {158, 59}, {234, 16}, {269, 10},
+  {365, 23}, {442, 3}, {558, 31}, {606, 27}, {612, 53}, {618, 51}, {698, 30}, {699, 32},
+  {720, 58}, {73, 58}, {114, 66}, {159, 59}, {235, 16}, {269, 10}, {364, 23}, {443, 3},
+  {557, 31}, {606, 27}, {613, 53}, {620, 51}, {695, 30}, {701, 32}, {720, 58}, {72, 58},
+  {114, 66}, {160, 59}, {236, 16}, {270, 10}, {363, 23}, {444, 3}, {556, 31}, {606, 27},
+  {614, 53}, {623, 51}, {693, 30}, {702, 32}, {720, 58}, {71, 58}, {115, 66}, {161, 59},
+  {237, 16}, {270, 10}, {362, 23}, {445, 3}, {555, 31}, {605, 27}, {615, 53}, {625, 51},
+  {691, 30}, {704, 32}, {720, 58}, {70, 58}, {115, 66}, {162, 59}, {238, 16}, {270, 10},
+  {361, 23}, {446, 3}, {554, 31}, {605, 27}, {615, 53}, {627, 51}, {689, 30}, {706, 32},
+  {720, 58}, {69, 58}, {71, 60}, {115, 66}, {163, 59}, {238, 16}, {270, 10}, {359, 23},
+  {447, 3}, {554, 31}, {605, 27}, {616, 53}, {629, 51}, {687, 30}, {708, 32}, {720, 58},
+  {68, 58}, {72, 60}, {115, 66}, {164, 59}, {239, 16}, {271, 10}, {358, 23}, {448, 3},
+  {553, 31}, {605, 27}, {617, 53}, {631, 51}, {685, 30}, {709, 32}, {720, 58}, {67, 58},
+  {73, 60}, {115, 66}, {165, 59}, {238, 16}, {272, 10}, {357, 23}, {449, 3}, {552, 31},
+  {605, 27}, {617, 53}, {633, 51}, {685, 30}, {711, 32}, {720, 58}, {66, 58}, {73, 60},
+  {116, 66}, {166, 59}, {236, 16}, {274, 10}, {356, 23}, {450, 3}, {551, 31}, {605, 27},
+  {618, 53}, {634, 51}, {684, 30}, {685, 54}, {713, 32}, {720, 58}, {65, 58}, {74, 60},
+  {116, 66}, {167, 59}, {235, 16}, {276, 10}, {354, 23}, {451, 3}, {551, 31}, {605, 27},
+  {618, 53}, {635, 51}, {682, 30}, {685, 54}, {714, 32}, {720, 58}, {64, 58}, {75, 60},
+  {116, 66}, {168, 59}, {233, 16}, {278, 10}, {353, 23}, {452, 3}, {550, 31}, {605, 27},
+  {619, 53}, {636, 51}, {681, 30}, {686, 54}, {716, 32}, {720, 58}, {63, 58}, {76, 60},
+  {116, 66}, {169, 59}, {232, 16}, {279, 10}, {350, 23}, {354, 0}, {453, 3}, {549, 31},
+  {605, 27}, {620, 53}, {637, 51}, {679, 30}, {686, 54}, {717, 32}, {720, 58}, {62, 58},
+  {76, 60}, {116, 66}, {170, 59}, {228, 16}, {281, 10}, {347, 23}, {354, 0}, {454, 3},
+  {549, 31}, {605, 27}, {620, 53}, {638, 51}, {677, 30}, {687, 54}, {718, 32}, {720, 58},
+  {61, 58}, {77, 60}, {116, 66}, {171, 59}, {224, 16}, {282, 10}, {344, 23}, {355, 0},
+  {455, 3}, {548, 31}, {605, 27}, {621, 53}, {638, 51}, {677, 30}, {688, 54}, {720, 32},
+  {1, 32}, {58, 58}, {62, 61}, {78, 60}, {117, 66}, {171, 59}, {211, 16}, {224, 25},
+  {284, 10}, {341, 23}, {355, 0}, {456, 3}, {547, 31}, {605, 27}, {621, 53}, {639, 51},
+  {676, 30}, {688, 54}, {720, 32}, {2, 32}, {54, 58}, {62, 61}, {79, 60}, {117, 66},
+  {172, 59}, {202, 16}, {223, 25}, {285, 10}, {338, 23}, {356, 0}, {457, 3}, {547, 31},
+  {605, 27}, {622, 53}, {640, 51}, {676, 30}, {689, 54}, {720, 32}, {4, 32}, {51, 58},
+  {62, 61}, {79, 60}, {117, 66}, {173, 59}, {196, 16}, {223, 25}, {287, 10}, {336, 23},
+  {356, 0}, {457, 3}, {461, 35}, {546, 31}, {605, 27}, {622, 53}, {641, 51}, {675, 30},
+  {689, 54}, {720, 32}, {5, 32}, {49, 58}, {62, 61}, {80, 60}, {117, 66}, {174, 59},
+  {190, 16}, {223, 25}, {288, 10}, {333, 23}, {357, 0}, {457, 3}, {466, 35}, {545, 31},
+  {605, 27}, {623, 53}, {642, 51}, {675, 30}, {690, 54}, {720, 32}, {6, 32}, {46, 58},
+  {62, 61}, {80, 60}, {117, 66}, {175, 59}, {185, 16}, {223, 25}, {290, 10}, {331, 23},
+  {357, 0}, {457, 3}, {470, 35}, {545, 31}, {605, 27}, {623, 53}, {642, 51}, {674, 30},
+  {690, 54}, {720, 32}, {8, 32}, {43, 58}, {62, 61}, {81, 60}, {117, 66}, {176, 59},
+  {181, 16}, {223, 25}, {294, 10}, {329, 23}, {358, 0}, {456, 3}, {474, 35}, {544, 31},
+  {605, 27}, {624, 53}, {643, 51}, {674, 30}, {691, 54}, {720, 32}, {9, 32}, {41, 58},
+  {62, 61}, {82, 60}, {118, 66}, {176, 59}, {177, 16}, {223, 25}, {298, 10}, {326, 23},
+  {358, 0}, {456, 3}, {477, 35}, {543, 31}, {605, 27}, {624, 53}, {644, 51}, {673, 30},
+  {692, 54}, {720, 32}, {10, 32}, {38, 58}, {62, 61}, {82, 60}, {118, 66}, {177, 59},
+  {223, 25}, {301, 10}, {324, 23}, {359, 0}, {456, 3}, {480, 35}, {543, 31}, {605, 27},
+  {625, 53}, {644, 51}, {673, 30}, {691, 54}, {693, 65}, {720, 32}, {11, 32}, {36, 58},
+  {63, 61}, {83, 60}, {118, 66}, {177, 59}, {222, 25}, {304, 10}, {322, 23}, {359, 0},
+  {455, 3}, {484, 35}, {542, 31}, {605, 27}, {625, 53}, {645, 51}, {673, 30}, {691, 54},
+  {695, 65}, {720, 32}, {12, 32}, {34, 58}, {63, 61}, {84, 60}, {118, 66}, {177, 59},
+  {222, 25}, {307, 10}, {320, 23}, {359, 0}, {455, 3}, {487, 35}, {542, 31}, {605, 27},
+  {626, 53}, {647, 51}, {672, 30}, {691, 54}, {696, 65}, {720, 32}, {13, 32}, {32, 58},
+  {63, 61}, {84, 60}, {118, 66}, {177, 59}, {221, 25}, {310, 10}, {318, 23}, {360, 0},
+  {455, 3}, {490, 35}, {541, 31}, {605, 27}, {626, 53}, {649, 51}, {672, 30}, {690, 54},
+  {698, 65}, {720, 32}, {14, 32}, {29, 58}, {63, 61}, {85, 60}, {118, 66}, {178, 59},
+  {221, 25}, {312, 10}, {316, 23}, {360, 0}, {454, 3}, {493, 35}, {541, 31}, {605, 27},
+  {627, 53}, {652, 51}, {671, 30}, {690, 54}, {700, 65}, {720, 32}, {15, 32}, {27, 58},
+  {63, 61}, {85, 60}, {118, 66}, {178, 59}, {221, 25}, {315, 10}, {361, 0}, {454, 3},
+  {455, 1}, {496, 35}, {540, 31}, {605, 27}, {627, 53}, {652, 51}, {671, 30}, {689, 54},
+  {702, 65}, {720, 32}, {17, 32}, {25, 58}, {63, 61}, {86, 60}, {119, 66}, {178, 59},
+  {220, 25}, {314, 10}, {361, 0}, {453, 3}, {455, 1}, {499, 35}, {538, 31}, {541, 47},
+  {605, 27}, {628, 53}, {653, 51}, {670, 30}, {689, 54}, {703, 65}, {720, 32}, {15, 32},
+  {25, 57}, {64, 61}, {87, 60}, {119, 66}, {178, 59}, {220, 25}, {314, 10}, {362, 0},
+  {452, 3}, {455, 1}, {502, 35}, {536, 31}, {543, 47}, {605, 27}, {628, 53}, {653, 51},
+  {670, 30}, {689, 54}, {705, 65}, {720, 32}, {12, 32}, {25, 57}, {64, 61}, {87, 60},
+  {119, 66}, {179, 59}, {219, 25}, {314, 10}, {362, 0}, {452, 3}, {456, 1}, {505, 35},
+  {534, 31}, {544, 47}, {605, 27}, {629, 53}, {653, 51}, {670, 30}, {688, 54}, {706, 65},
+  {720, 32}, {10, 32}, {25, 57}, {65, 61}, {88, 60}, {119, 66}, {179, 59}, {218, 25},
+  {314, 10}, {362, 0}, {451, 3}, {456, 1}, {507, 35}, {532, 31}, {546, 47}, {605, 27},
+  {629, 53}, {654, 51}, {669, 30}, {688, 54}, {708, 65}, {720, 32}, {8, 32}, {25, 57},
+  {65, 61}, {88, 60}, {119, 66}, {179, 59}, {217, 25}, {313, 10}, {363, 0}, {450, 3},
+  {456, 1}, {510, 35}, {530, 31}, {548, 47}, {605, 27}, {630, 53}, {654, 51}, {665, 30},
+  {670, 29}, {687, 54}, {709, 65}, {720, 32}, {5, 32}, {25, 57}, {66, 61}, {89, 60},
+  {119, 66}, {179, 59}, {215, 25}, {313, 10}, {363, 0}, {450, 3}, {457, 1}, {512, 35},
+  {528, 31}, {549, 47}, {605, 27}, {630, 53}, {654, 51}, {660, 30}, {671, 29}, {687, 54},
+  {711, 65}, {720, 32}, {3, 32}, {24, 57}, {25, 64}, {66, 61}, {89, 60}, {119, 66},
+  {180, 59}, {214, 25}, {242, 10}, {252, 11}, {313, 10}, {364, 0}, {449, 3}, {457, 1},
+  {515, 35}, {526, 31}, {551, 47}, {605, 27}, {630, 53}, {654, 51}, {656, 30}, {672, 29},
+  {687, 54}, {712, 65}, {720, 32}, {1, 32}, {24, 57}, {25, 64}, {67, 61}, {90, 60},
+  {120, 66}, {180, 59}, {213, 25}, {241, 10}, {258, 11}, {313, 10}, {364, 0}, {448, 3},
+  {457, 1}, {517, 35}, {524, 31}, {552, 47}, {605, 27}, {630, 53}, {654, 51}, {673, 29},
+  {686, 54}, {714, 65}, {720, 32}, {23, 57}, {26, 64}, {67, 61}, {90, 60}, {120, 66},
+  {180, 59}, {212, 25}, {239, 10}, {257, 11}, {313, 10}, {364, 0}, {448, 3}, {458, 1},
+  {519, 35}, {522, 31}, {554, 47}, {605, 27}, {630, 53}, {654, 51}, {673, 29}, {686, 54},
+  {715, 65}, {719, 32}, {720, 57}, {23, 57}, {26, 64}, {68, 61}, {91, 60}, {120, 66},
+  {180, 59}, {211, 25}, {238, 10}, {257, 11}, {313, 10}, {365, 0}, {447, 3}, {458, 1},
+  {520, 35}, {521, 37}, {555, 47}, {605, 27}, {630, 53}, {653, 51}, {674, 29}, {686, 54},
+  {717, 65}, {720, 57}, {22, 57}, {26, 64}, {68, 61}, {91, 60}, {120, 66}, {180, 59},
+  {210, 25}, {238, 10}, {257, 11}, {313, 10}, {365, 0}, {446, 3}, {458, 1}, {519, 35},
+  {521, 37}, {557, 47}, {605, 27}, {631, 53}, {653, 51}, {675, 29}, {685, 54}, {716, 65},
+  {720, 57}, {22, 57}, {27, 64}, {69, 61}, {92, 60}, {120, 66}, {181, 59}, {209, 25},
+  {238, 10}, {257, 11}, {313, 10}, {366, 0}, {446, 3}, {459, 1}, {518, 35}, {521, 37},
+  {558, 47}, {605, 27}, {631, 53}, {652, 51}, {676, 29}, {685, 54}, {716, 65}, {720, 57},
+  {21, 57}, {27, 64}, {69, 61}, {92, 60}, {120, 66}, {181, 59}, {208, 25}, {238, 10},
+  {257, 11}, {313, 10}, {366, 0}, {445, 3}, {459, 1}, {517, 35}, {522, 37}, {560, 47},
+  {604, 27}, {631, 53}, {652, 51}, {677, 29}, {685, 54}, {715, 65}, {720, 57}, {21, 57},
+  {27, 64}, {70, 61}, {93, 60}, {120, 66}, {181, 59}, {207, 25}, {237, 10}, {256, 11},
+  {313, 10}, {366, 0}, {445, 3}, {459, 1}, {516, 35}, {522, 37}, {561, 47}, {604, 27},
+  {631, 53}, {651, 51}, {678, 29}, {684, 54}, {687, 45}, {713, 65}, {716, 34}, {720, 57},
+  {20, 57}, {27, 64}, {70, 61}, {93, 60}, {120, 66}, {181, 59}, {206, 25}, {237, 10},
+  {256, 11}, {313, 10}, {367, 0}, {444, 3}, {460, 1}, {514, 35}, {522, 37}, {563, 47},
+  {604, 27}, {631, 53}, {649, 51}, {678, 29}, {682, 54}, {693, 45}, {712, 65}, {716, 34},
+  {720, 57}, {20, 57}, {28, 64}, {71, 61}, {94, 60}, {121, 66}, {181, 59}, {188, 12},
+  {205, 25}, {237, 10}, {256, 11}, {313, 10}, {367, 0}, {443, 3}, {460, 1}, {513, 35},
+  {522, 37}, {564, 47}, {604, 27}, {631, 53}, {647, 51}, {679, 29}, {681, 54}, {699, 45},
+  {711, 65}, {717, 34}, {720, 57}, {19, 57}, {28, 64}, {71, 61}, {94, 60}, {121, 66},
+  {180, 59}, {194, 12}, {204, 25}, {237, 10}, {255, 11}, {256, 9}, {314, 10}, {367, 0},
+  {443, 3}, {460, 1}, {512, 35}, {523, 37}, {565, 47}, {604, 27}, {631, 53}, {646, 51},
+  {680, 29}, {704, 45}, {710, 65}, {718, 34}, {720, 57}, {19, 57}, {28, 64}, {72, 61},
+  {95, 60}, {121, 66}, {179, 59}, {199, 12}, {203, 25}, {237, 10}, {253, 11}, {257, 9},
+  {314, 10}, {368, 0}, {442, 3}, {460, 1}, {511, 35}, {523, 37}, {567, 47}, {604, 27},
+  {631, 53}, {644, 51}, {679, 29}, {708, 45}, {718, 34}, {720, 57}, {18, 57}, {28, 64},
+  {72, 61}, {95, 60}, {121, 66}, {179, 59}, {203, 12}, {237, 10}, {251, 11}, {257, 9},
+  {314, 10}, {368, 0}, {442, 3}, {461, 1}, {510, 35}, {523, 37}, {568, 47}, {604, 27},
+  {631, 53}, {642, 51}, {679, 29}, {708, 45}, {719, 34}, {720, 57}, {18, 57}, {29, 64},
+  {73, 61}, {96, 60}, {121, 66}, {178, 59}, {205, 12}, {206, 9}, {238, 10}, {249, 11},
+  {258, 9}, {314, 10}, {368, 0}, {441, 3}, {461, 1}, {509, 35}, {523, 37}, {568, 47},
+  {570, 28}, {604, 27}, {631, 53}, {640, 51}, {678, 29}, {707, 45}, {719, 34}, {720, 57},
+  {17, 57}, {29, 64}, {73, 61}, {96, 60}, {121, 66}, {178, 59}, {205, 12}, {210, 9},
+  {238, 10}, {247, 11}, {258, 9}, {314, 10}, {369, 0}, {441, 3}, {461, 1}, {508, 35},
+  {524, 37}, {568, 47}, {573, 28}, {604, 27}, {631, 53}, {638, 51}, {678, 29}, {707, 45},
+  {720, 34}, {17, 57}, {29, 64}, {74, 61}, {97, 60}, {121, 66}, {177, 59}, {206, 12},
+  {214, 9}, {238, 10}, {246, 11}, {258, 9}, {314, 10}, {369, 0}, {440, 3}, {462, 1},
+  {507, 35}, {524, 37}, {567, 47}, {576, 28}, {604, 27}, {624, 53}, {632, 52}, {637, 51},
+  {677, 29}, {707, 45}, {720, 34}, {1, 34}, {16, 57}, {29, 64}, {74, 61}, {97, 60},
+  {121, 66}, {177, 59}, {206, 12}, {217, 9}, {238, 10}, {244, 11}, {259, 9}, {314, 10},
+  {369, 0}, {440, 3}, {462, 1}, {506, 35}, {524, 37}, {567, 47}, {578, 28}, {604, 27},
+  {613, 53}, {634, 52}, {635, 51}, {677, 29}, {706, 45}, {720, 34}, {1, 34}, {16, 57},
+  {30, 64}, {75, 61}, {98, 60}, {122, 66}, {176, 59}, {207, 12}, {221, 9}, {238, 10},
+  {242, 11}, {259, 9}, {314, 10}, {370, 0}, {440, 3}, {462, 1}, {505, 35}, {524, 37},
+  {567, 47}, {581, 28}, {604, 27}, {635, 52}, {676, 29}, {706, 45}, {720, 34}, {2, 34},
+  {16, 57}, {30, 64}, {75, 61}, {98, 60}, {122, 66}, {176, 59}, {208, 12}, {224, 9},
+  {238, 10}, {240, 11}, {260, 9}, {315, 10}, {370, 0}, {441, 3}, {462, 1}, {504, 35},
+  {525, 37}, {567, 47}, {583, 28}, {603, 27}, {635, 52}, {676, 29}, {707, 45}, {720, 34},
+  {3, 34}, {15, 57}, {30, 64}, {75, 61}, {99, 60}, {122, 66}, {175, 59}, {208, 12},
+  {227, 9}, {238, 10}, {260, 9}, {315, 10}, {370, 0}, {441, 3}, {463, 1}, {503, 35},
+  {525, 37}, {567, 47}, {586, 28}, {601, 27}, {636, 52}, {676, 29}, {707, 45}, {720, 34},
+  {3, 34}, {15, 57}, {30, 64}, {76, 61}, {99, 60}, {122, 66}, {174, 59}, {209, 12},
+  {230, 9}, {238, 10}, {261, 9}, {315, 10}, {371, 0}, {441, 3}, {463, 1}, {502, 35},
+  {525, 37}, {566, 47}, {588, 28}, {599, 27}, {601, 38}, {636, 52}, {676, 29}, {707, 45},
+  {720, 34}, {4, 34}, {14, 57}, {31, 64}, {76, 61}, {99, 60}, {122, 66}, {174, 59},
+  {209, 12}, {233, 9}, {237, 10}, {261, 9}, {315, 10}, {371, 0}, {441, 3}, {463, 1},
+  {501, 35}, {525, 37}, {566, 47}, {590, 28}, {596, 27}, {602, 38}, {637, 52}, {676, 29},
+  {707, 45}, {720, 34}, {4, 34}, {14, 57}, {31, 64}, {77, 61}, {100, 60}, {122, 66},
+  {173, 59}, {210, 12}, {262, 9}, {316, 10}, {371, 0}, {442, 3}, {464, 1}, {500, 35},
+  {525, 37}, {566, 47}, {593, 28}, {594, 27}, {603, 38}, {637, 52}, {676, 29}, {707, 45},
+  {720, 34}, {5, 34}, {13, 57}, {31, 64}, {77, 61}, {100, 60}, {122, 66}, {173, 59},
+  {210, 12}, {262, 9}, {316, 10}, {372, 0}, {442, 3}, {464, 1}, {499, 35}, {526, 37},
+  {566, 47}, {593, 28}, {604, 38}, {638, 52}, {676, 29}, {707, 45}, {720, 34}, {5, 34},
+  {13, 57}, {31, 64}, {78, 61}, {101, 60}, {122, 66}, {172, 59}, {211, 12}, {262, 9},
+  {316, 10}, {372, 0}, {373, 2}, {442, 3}, {464, 1}, {498, 35}, {526, 37}, {565, 47},
+  {593, 28}, {605, 38}, {638, 52}, {675, 29}, {707, 45}, {720, 34}, {8, 34}, {13, 57},
+  {32, 64}, {78, 61}, {101, 60}, {122, 66}, {171, 59}, {173, 13}, {212, 12}, {263, 9},
+  {316, 10}, {372, 0}, {377, 2}, {442, 3}, {464, 1}, {497, 35}, {526, 37}, {565, 47},
+  {593, 28}, {606, 38}, {639, 52}, {674, 29}, {707, 45}, {720, 34}, {11, 34}, {15, 57},
+  {32, 64}, {77, 61}, {81, 63}, {102, 60}, {123, 66}, {170, 59}, {174, 13}, {212, 12},
+  {263, 9}, {317, 10}, {371, 0}, {382, 2}, {442, 3}, {465, 1}, {496, 35}, {526, 37},
+  {565, 47}, {593, 28}, {606, 38}, {639, 52}, {673, 29}, {707, 45}, {720, 34}, {11, 34},
+  {16, 57}, {32, 64}, {76, 61}, {84, 63}, {102, 60}, {123, 66}, {168, 59}, {175, 13},
+  {213, 12}, {264, 9}, {317, 10}, {371, 0}, {386, 2}, {441, 3}, {465, 1}, {495, 35},
+  {527, 37}, {565, 47}, {592, 28}, {594, 27}, {607, 38}, {640, 52}, {672, 29}, {707, 45},
+  {720, 34}, {12, 34}, {16, 57}, {32, 64}, {76, 61}, {88, 63}, {102, 60}, {123, 66},
+  {167, 59}, {176, 13}, {213, 12}, {264, 9}, {317, 10}, {370, 0}, {390, 2}, {440, 3},
+  {465, 1}, {494, 35}, {527, 37}, {565, 47}, {592, 28}, {595, 27}, {608, 38}, {640, 52},
+  {671, 29}, {707, 45}, {720, 34}, {12, 34}, {16, 57}, {33, 64}, {75, 61}, {91, 63},
+  {103, 60}, {123, 66}, {165, 59}, {177, 13}, {214, 12}, {265, 9}, {317, 10}, {370, 0},
+  {394, 2}, {440, 3}, {465, 1}, {493, 35}, {527, 37}, {564, 47}, {591, 28}, {595, 27},
+  {609, 38}, {640, 52}, {670, 29}, {707, 45}, {720, 34}, {12, 34}, {17, 57}, {34, 64},
+  {74, 61}, {94, 63}, {103, 60}, {123, 66}, {164, 59}, {178, 13}, {214, 12}, {263, 9},
+  {318, 10}, {370, 0}, {397, 2}, {439, 3}, {466, 1}, {492, 35}, {527, 37}, {564, 47},
+  {591, 28}, {596, 27}, {610, 38}, {639, 52}, {669, 29}, {707, 45}, {720, 34}, {12, 34},
+  {17, 57}, {34, 64}, {73, 61}, {97, 63}, {104, 60}, {123, 66}, {162, 59}, {179, 13},
+  {215, 12}, {262, 9}, {318, 10}, {369, 0}, {399, 2}, {439, 3}, {466, 1}, {491, 35},
+  {527, 37}, {564, 47}, {590, 28}, {596, 27}, {611, 38}, {639, 52}, {668, 29}, {707, 45},
+  {720, 34}, {12, 34}, {18, 57}, {35, 64}, {72, 61}, {100, 63}, {104, 60}, {123, 66},
+  {161, 59}, {180, 13}, {215, 12}, {261, 9}, {318, 10}, {369, 0}, {399, 2}, {438, 3},
+  {466, 1}, {490, 35}, {528, 37}, {564, 47}, {590, 28}, {597, 27}, {611, 38}, {639, 52},
+  {667, 29}, {707, 45}, {720, 34}, {12, 34}, {18, 57}, {36, 64}, {71, 61}, {103, 63},
+  {105, 60}, {123, 66}, {159, 59}, {181, 13}, {216, 12}, {225, 9}, {231, 12}, {260, 9},
+  {318, 10}, {368, 0}, {399, 2}, {438, 3}, {467, 1}, {489, 35}, {528, 37}, {563, 47},
+  {590, 28}, {598, 27}, {612, 38}, {639, 52}, {667, 29}, {707, 45}, {720, 34}, {12, 34},
+  {19, 57}, {36, 64}, {70, 61}, {106, 63}, {123, 66}, {158, 59}, {182, 13}, {230, 12},
+  {259, 9}, {317, 10}, {319, 23}, {368, 0}, {400, 2}, {437, 3}, {467, 1}, {488, 35},
+  {528, 37}, {563, 47}, {589, 28}, {598, 27}, {613, 38}, {639, 52}, {667, 29}, {707, 45},
+  {720, 34}, {12, 34}, {19, 57}, {37, 64}, {69, 61}, {107, 63}, {124, 66}, {157, 59},
+  {183, 13}, {230, 12}, {258, 9}, {315, 10}, {319, 23}, {368, 0}, {400, 2}, {437, 3},
+  {467, 1}, {487, 35}, {528, 37}, {563, 47}, {589, 28}, {599, 27}, {614, 38}, {639, 52},
+  {666, 29}, {706, 45}, {720, 34}, {13, 34}, {20, 57}, {38, 64}, {68, 61}, {109, 63},
+  {124, 66}, {155, 59}, {184, 13}, {230, 12}, {257, 9}, {313, 10}, {320, 23}, {367, 0},
+  {400, 2}, {436, 3}, {466, 1}, {486, 35}, {528, 37}, {563, 47}, {588, 28}, {599, 27},
+  {614, 38}, {638, 52}, {666, 29}, {705, 45}, {720, 34}, {12, 34}, {28, 57}, {38, 64},
+  {67, 61}, {111, 63}, {124, 66}, {154, 59}, {184, 13}, {230, 12}, {255, 9}, {311, 10},
+  {320, 23}, {367, 0}, {400, 2}, {434, 3}, {465, 1}, {486, 35}, {529, 37}, {563, 47},
+  {588, 28}, {600, 27}, {615, 38}, {638, 52}, {665, 29}, {704, 45}, {720, 34}, {12, 34},
+  {36, 57}, {39, 64}, {67, 61}, {112, 63}, {124, 66}, {152, 59}, {185, 13}, {229, 12},
+  {254, 9}, {310, 10}, {321, 23}, {366, 0}, {400, 2}, {432, 3}, {464, 1}, {486, 35},
+  {529, 37}, {562, 47}, {588, 28}, {601, 27}, {616, 38}, {638, 52}, {665, 29}, {704, 45},
+  {720, 34}, {11, 34}, {40, 57}, {66, 61}, {114, 63}, {124, 66}, {151, 59}, {186, 13},
+  {229, 12}, {253, 9}, {308, 10}, {321, 23}, {366, 0}, {401, 2}, {430, 3}, {463, 1},
+  {486, 35}, {529, 37}, {562, 47}, {587, 28}, {601, 27}, {617, 38}, {637, 52}, {638, 38},
+  {665, 29}, {703, 45}, {720, 34}, {10, 34}, {41, 57}, {65, 61}, {115, 63}, {124, 66},
+  {150, 59}, {187, 13}, {229, 12}, {252, 9}, {306, 10}, {322, 23}, {366, 0}, {401, 2},
+  {428, 3}, {462, 1}, {487, 35}, {529, 37}, {562, 47}, {587, 28}, {602, 27}, {618, 38},
+  {636, 52}, {640, 38}, {664, 29}, {702, 45}, {720, 34}, {9, 34}, {41, 57}, {46, 62},
+  {64, 61}, {117, 63}, {124, 66}, {148, 59}, {188, 13}, {228, 12}, {251, 9}, {304, 10},
+  {322, 23}, {365, 0}, {401, 2}, {427, 3}, {462, 1}, {487, 35}, {529, 37}, {562, 47},
+  {587, 28}, {602, 27}, {618, 38}, {635, 52}, {641, 38}, {664, 29}, {701, 45}, {720, 34},
+  {8, 34}, {40, 57}, {48, 62}, {63, 61}, {119, 63}, {124, 66}, {147, 59}, {189, 13},
+  {228, 12}, {247, 9}, {302, 10}, {323, 23}, {367, 0}, {402, 2}, {426, 3}, {461, 1},
+  {487, 35}, {530, 37}, {562, 47}, {587, 28}, {603, 27}, {619, 38}, {634, 52}, {642, 38},
+  {663, 29}, {697, 45}, {720, 34}, {8, 34}, {39, 57}, {51, 62}, {62, 61}, {120, 63},
+  {124, 66}, {146, 59}, {189, 13}, {228, 12}, {247, 9}, {301, 10}, {323, 23}, {368, 0},
+  {402, 2}, {426, 3}, {460, 1}, {487, 35}, {530, 37}, {561, 47}, {587, 28}, {603, 27},
+  {620, 38}, {633, 52}, {643, 38}, {663, 29}, {696, 45}, {720, 34}, {8, 34}, {38, 57},
+  {53, 62}, {61, 61}, {122, 63}, {125, 66}, {144, 59}, {189, 13}, {227, 12}, {246, 9},
+  {299, 10}, {324, 23}, {370, 0}, {403, 2}, {427, 3}, {459, 1}, {487, 35}, {530, 37},
+  {561, 47}, {587, 28}, {604, 27}, {621, 38}, {632, 52}, {644, 38}, {663, 29}, {695, 45},
+  {720, 34}, {8, 34}, {37, 57}, {56, 62}, {61, 61}, {123, 63}, {125, 66}, {143, 59},
+  {189, 13}, {227, 12}, {246, 9}, {297, 10}, {324, 23}, {371, 0}, {404, 2}, {427, 3},
+  {458, 1}, {487, 35}, {530, 37}, {561, 47}, {586, 28}, {605, 27}, {621, 38}, {631, 52},
+  {645, 38}, {662, 29}, {693, 45}, {720, 34}, {8, 34}, {36, 57}, {59, 62}, {60, 61},
+  {125, 63}, {142, 59}, {189, 13}, {227, 12}, {246, 9}, {295, 10}, {324, 23}, {373, 0},
+  {404, 2}, {427, 3}, {458, 1}, {488, 35}, {530, 37}, {561, 47}, {586, 28}, {605, 27},
+  {622, 38}, {630, 52}, {646, 38}, {662, 29}, {692, 45}, {720, 34}, {8, 34}, {36, 57},
+  {60, 62}, {125, 63}, {140, 59}, {189, 13}, {227, 12}, {246, 9}, {294, 10}, {324, 23},
+  {374, 0}, {405, 2}, {428, 3}, {457, 1}, {488, 35}, {531, 37}, {560, 47}, {586, 28},
+  {606, 27}, {623, 38}, {629, 52}, {647, 38}, {661, 29}, {690, 45}, {720, 34}, {8, 34},
+  {35, 57}, {60, 62}, {126, 63}, {139, 59}, {189, 13}, {228, 12}, {246, 9}, {292, 10},
+  {323, 23}, {376, 0}, {405, 2}, {428, 3}, {456, 1}, {488, 35}, {531, 37}, {560, 47},
+  {586, 28}, {606, 27}, {624, 38}, {628, 52}, {648, 38}, {661, 29}, {689, 45}, {720, 34},
+  {7, 34}, {34, 57}, {61, 62}, {127, 63}, {138, 59}, {190, 13}, {228, 12}, {246, 9},
+  {290, 10}, {323, 23}, {376, 0}, {405, 2}, {428, 3}, {456, 1}, {488, 35}, {531, 37},
+  {559, 47}, {586, 28}, {607, 27}, {624, 38}, {627, 52}, {650, 38}, {661, 29}, {688, 45},
+  {720, 34}, {6, 34}, {34, 57}, {62, 62}, {127, 63}, {136, 59}, {190, 13}, {228, 12},
+  {246, 9}, {289, 10}, {322, 23}, {376, 0}, {405, 2}, {428, 3}, {456, 1}, {488, 35},
+  {530, 37}, {532, 39}, {558, 47}, {559, 27}, {587, 28}, {607, 27}, {625, 38}, {626, 52},
+  {651, 38}, {660, 29}, {686, 45}, {720, 34}, {6, 34}, {33, 57}, {62, 62}, {128, 63},
+  {135, 59}, {190, 13}, {229, 12}, {246, 9}, {289, 10}, {322, 23}, {376, 0}, {405, 2},
+  {427, 3}, {457, 1}, {488, 35}, {528, 37}, {533, 39}, {556, 47}, {561, 27}, {587, 28},
+  {608, 27}, {652, 38}, {660, 29}, {685, 45}, {720, 34}, {5, 34}, {33, 57}, {63, 62},
+  {128, 63}, {134, 59}, {190, 13}, {229, 12}, {245, 9}, {289, 10}, {321, 23}, {376, 0},
+  {405, 2}, {427, 3}, {458, 1}, {489, 35}, {526, 37}, {534, 39}, {554, 47}, {564, 27},
+  {588, 28}, {608, 27}, {653, 38}, {660, 29}, {684, 45}, {720, 34}, {4, 34}, {33, 57},
+  {64, 62}, {129, 63}, {132, 59}, {190, 13}, {229, 12}, {245, 9}, {289, 10}, {321, 23},
+  {376, 0}, {405, 2}, {427, 3}, {458, 1}, {489, 35}, {524, 37}, {535, 39}, {551, 47},
+  {567, 27}, {588, 28}, {609, 27}, {654, 38}, {659, 29}, {682, 45}, {720, 34}, {4, 34},
+  {32, 57}, {64, 62}, {130, 63}, {131, 59}, {190, 13}, {229, 12}, {245, 9}, {289, 10},
+  {321, 23}, {376, 0}, {405, 2}, {426, 3}, {459, 1}, {489, 35}, {522, 37}, {536, 39},
+  {547, 47}, {569, 27}, {589, 28}, {610, 27}, {655, 38}, {659, 29}, {682, 45}, {720, 34},
+  {3, 34}, {32, 57}, {65, 62}, {130, 63}, {190, 13}, {228, 12}, {245, 9}, {289, 10},
+  {320, 23}, {376, 0}, {404, 2}, {425, 3}, {460, 1}, {489, 35}, {520, 37}, {538, 39},
+  {544, 47}, {572, 27}, {589, 28}, {610, 27}, {656, 38}, {658, 29}, {681, 45}, {720, 34},
+  {3, 34}, {32, 57}, {65, 62}, {129, 63}, {191, 13}, {228, 12}, {245, 9}, {289, 10},
+  {320, 23}, {376, 0}, {405, 2}, {424, 3}, {460, 1}, {489, 35}, {509, 37}, {520, 31},
+  {539, 39}, {541, 47}, {572, 27}, {588, 28}, {611, 27}, {657, 38}, {658, 29}, {681, 45},
+  {720, 34}, {2, 34}, {31, 57}, {66, 62}, {128, 63}, {191, 13}, {227, 12}, {245, 9},
+  {289, 10}, {319, 23}, {376, 0}, {405, 2}, {423, 3}, {461, 1}, {489, 35}, {499, 37},
+  {519, 31}, {539, 39}, {572, 27}, {586, 28}, {611, 27}, {658, 38}, {680, 45}, {720, 34},
+  {1, 34}, {31, 57}, {67, 62}, {127, 63}, {191, 13}, {227, 12}, {245, 9}, {289, 10},
+  {318, 23}, {376, 0}, {406, 2}, {422, 3}, {462, 1}, {489, 35}, {519, 31}, {540, 39},
+  {573, 27}, {584, 28}, {612, 27}, {658, 38}, {681, 45}, {720, 34}, {2, 34}, {31, 57},
+  {67, 62}, {126, 63}, {191, 13}, {226, 12}, {244, 9}, {289, 10}, {318, 23}, {376, 0},
+  {407, 2}, {421, 3}, {462, 1}, {489, 35}, {518, 31}, {540, 39}, {573, 27}, {583, 28},
+  {612, 27}, {657, 38}, {661, 29}, {682, 45}, {720, 34}, {2, 34}, {30, 57}, {68, 62},
+  {125, 63}, {191, 13}, {225, 12}, {245, 9}, {289, 10}, {317, 23}, {376, 0}, {408, 2},
+  {420, 3}, {463, 1}, {488, 35}, {518, 31}, {540, 39}, {573, 27}, {581, 28}, {613, 27},
+  {656, 38}, {665, 29}, {684, 45}, {720, 34}, {2, 34}, {30, 57}, {68, 62}, {124, 63},
+  {191, 13}, {224, 12}, {245, 9}, {289, 10}, {316, 23}, {376, 0}, {408, 2}, {419, 3},
+  {464, 1}, {488, 35}, {518, 31}, {540, 39}, {573, 27}, {580, 28}, {613, 27}, {656, 38},
+  {668, 29}, {685, 45}, {720, 34}, {2, 34}, {30, 57}, {69, 62}, {123, 63}, {191, 13},
+  {225, 12}, {246, 9}, {289, 10}, {316, 23}, {376, 0}, {409, 2}, {418, 3}, {464, 1},
+  {487, 35}, {517, 31}, {540, 39}, {573, 27}, {578, 28}, {614, 27}, {655, 38}, {669, 29},
+  {686, 45}, {720, 34}, {3, 34}, {30, 57}, {70, 62}, {122, 63}, {191, 13}, {225, 12},
+  {247, 9}, {289, 10}, {315, 23}, {376, 0}, {409, 2}, {418, 3}, {465, 1}, {487, 35},
+  {517, 31}, {540, 39}, {574, 27}, {577, 28}, {613, 27}, {654, 38}, {669, 29}, {688, 45},
+  {720, 34}, {3, 34}, {29, 57}, {70, 62}, {121, 63}, {192, 13}, {225, 12}, {246, 9},
+  {289, 10}, {314, 23}, {375, 0}, {410, 2}, {420, 3}, {466, 1}, {487, 35}, {516, 31},
+  {541, 39}, {574, 27}, {575, 28}, {612, 27}, {653, 38}, {669, 29}, {689, 45}, {720, 34},
+  {3, 34}, {29, 57}, {71, 62}, {120, 63}, {192, 13}, {225, 12}, {246, 9}, {289, 10},
+  {314, 23}, {366, 0}, {368, 2}, {373, 0}, {410, 2}, {426, 3}, {466, 1}, {486, 35},
+  {516, 31}, {541, 39}, {611, 27}, {652, 38}, {669, 29}, {691, 45}, {720, 34}, {3, 34},
+  {29, 57}, {71, 62}, {120, 63}, {192, 13}, {225, 12}, {245, 9}, {289, 10}, {313, 23},
+  {365, 0}, {370, 2}, {371, 0}, {410, 2}, {432, 3}, {467, 1}, {486, 35}, {515, 31},
+  {541, 39}, {610, 27}, {651, 38}, {669, 29}, {692, 45}, {720, 34}, {4, 34}, {28, 57},
+  {72, 62}, {119, 63}, {194, 13}, {225, 12}, {245, 9}, {289, 10}, {312, 23}, {313, 50},
+  {365, 0}, {410, 2}, {433, 3}, {468, 1}, {485, 35}, {515, 31}, {541, 39}, {610, 27},
+  {650, 38}, {670, 29}, {694, 45}, {720, 34}, {4, 34}, {28, 57}, {73, 62}, {118, 63},
+  {194, 13}, {224, 12}, {245, 9}, {289, 10}, {309, 23}, {314, 50}, {365, 0}, {410, 2},
+  {434, 3}, {468, 1}, {485, 35}, {514, 31}, {541, 39}, {610, 27}, {649, 38}, {670, 29},
+  {695, 45}, {720, 34}, {4, 34}, {28, 57}, {73, 62}, {117, 63}, {194, 13}, {224, 12},
+  {246, 9}, {289, 10}, {307, 23}, {314, 50}, {365, 0}, {410, 2}, {433, 3}, {469, 1},
+  {484, 35}, {514, 31}, {541, 39}, {610, 27}, {648, 38}, {670, 29}, {695, 45}, {720, 34},
+  {5, 34}, {27, 57}, {74, 62}, {116, 63}, {195, 13}, {223, 12}, {246, 9}, {289, 10},
+  {305, 23}, {314, 50}, {364, 0}, {410, 2}, {432, 3}, {470, 1}, {484, 35}, {513, 31},
+  {542, 39}, {610, 27}, {647, 38}, {670, 29}, {694, 45}, {720, 34}, {5, 34}, {27, 57},
+  {75, 62}, {115, 63}, {195, 13}, {222, 12}, {246, 9}, {290, 10}, {303, 23}, {315, 50},
+  {364, 0}, {410, 2}, {432, 3}, {470, 1}, {483, 35}, {512, 31}, {542, 39}, {572, 27},
+  {575, 28}, {610, 27}, {645, 38}, {670, 29}, {693, 45}, {720, 34}, {5, 34}, {27, 57},
+  {75, 62}, {114, 63}, {195, 13}, {221, 12}, {247, 9}, {290, 10}, {301, 23}, {315, 50},
+  {364, 0}, {410, 2}, {431, 3}, {471, 1}, {483, 35}, {511, 31}, {542, 39}, {571, 27},
+  {578, 28}, {610, 27}, {644, 38}, {670, 29}, {692, 45}, {720, 34}, {5, 34}, {26, 57},
+  {76, 62}, {113, 63}, {195, 13}, {220, 12}, {247, 9}, {290, 10}, {299, 23}, {316, 50},
+  {364, 0}, {410, 2}, {431, 3}, {472, 1}, {482, 35}, {509, 31}, {542, 39}, {569, 27},
+  {580, 28}, {611, 27}, {644, 38}, {670, 29}, {691, 45}, {720, 34}, {6, 34}, {26, 57},
+  {76, 62}, {112, 63}, {195, 13}, {219, 12}, {247, 9}, {290, 10}, {297, 23}, {316, 50},
+  {363, 0}, {410, 2}, {430, 3}, {472, 1}, {482, 35}, {508, 31}, {542, 39}, {544, 47},
+  {567, 27}, {581, 28}, {611, 27}, {643, 38}, {670, 29}, {690, 45}, {720, 34}, {6, 34},
+  {26, 57}, {77, 62}, {111, 63}, {196, 13}, {219, 12}, {248, 9}, {290, 10}, {294, 23},
+  {316, 50}, {363, 0}, {410, 2}, {429, 3}, {474, 1}, {481, 35}, {507, 31}, {541, 39},
+  {546, 47}, {550, 28}, {565, 27}, {581, 28}, {612, 27}, {642, 38}, {670, 29}, {689, 45},
+  {720, 34}, {7, 34}, {25, 57}, {78, 62}, {110, 63}, {196, 13}, {217, 12}, {248, 9},
+  {290, 10}, {292, 23}, {317, 50}, {363, 0}, {410, 2}, {429, 3}, {475, 1}, {481, 35},
+  {506, 31}, {540, 39}, {547, 47}, {558, 28}, {562, 27}, {582, 28}, {613, 27}, {642, 38},
+  {670, 29}, {688, 45}, {720, 34}, {7, 34}, {25, 57}, {78, 62}, {110, 63}, {196, 13},
+  {215, 12}, {248, 9}, {290, 10}, {317, 50}, {363, 0}, {410, 2}, {428, 3}, {477, 1},
+  {480, 35}, {504, 31}, {540, 39}, {547, 47}, {583, 28}, {613, 27}, {641, 38}, {670, 29},
+  {688, 45}, {720, 34}, {8, 34}, {25, 57}, {79, 62}, {109, 63}, {196, 13}, {213, 12},
+  {249, 9}, {288, 10}, {318, 50}, {362, 0}, {410, 2}, {428, 3}, {479, 1}, {480, 35},
+  {503, 31}, {539, 39}, {548, 47}, {584, 28}, {614, 27}, {641, 38}, {670, 29}, {687, 45},
+  {720, 34}, {8, 34}, {24, 57}, {80, 62}, {108, 63}, {197, 13}, {211, 12}, {249, 9},
+  {287, 10}, {318, 50}, {362, 0}, {410, 2}, {427, 3}, {478, 1}, {481, 35}, {502, 31},
+  {539, 39}, {549, 47}, {584, 28}, {614, 27}, {640, 38}, {670, 29}, {686, 45}, {720, 34},
+  {9, 34}, {24, 57}, {80, 62}, {107, 63}, {197, 13}, {211, 12}, {249, 9}, {286, 10},
+  {318, 50}, {362, 0}, {410, 2}, {427, 3}, {477, 1}, {482, 35}, {500, 31}, {539, 39},
+  {549, 47}, {585, 28}, {615, 27}, {639, 38}, {670, 29}, {685, 45}, {720, 34}, {10, 34},
+  {24, 57}, {81, 62}, {106, 63}, {197, 13}, {210, 12}, {250, 9}, {284, 10}, {318, 50},
+  {362, 0}, {410, 2}, {428, 3}, {476, 1}, {484, 35}, {499, 31}, {538, 39}, {550, 47},
+  {586, 28}, {615, 27}, {639, 38}, {671, 29}, {684, 45}, {720, 34}, {10, 34}, {23, 57},
+  {28, 61}, {82, 62}, {105, 63}, {197, 13}, {210, 12}, {251, 9}, {283, 10}, {319, 50},
+  {362, 0}, {409, 2}, {429, 3}, {476, 1}, {485, 35}, {492, 39}, {498, 31}, {538, 39},
+  {551, 47}, {587, 28}, {616, 27}, {638, 38}, {671, 29}, {684, 45}, {720, 34}, {11, 34},
+  {21, 57}, {83, 61}, {103, 63}, {106, 21}, {107, 17}, {197, 13}, {210, 12}, {253, 9},
+  {283, 10}, {319, 50}, {361, 0}, {408, 2}, {430, 3}, {475, 1}, {485, 35}, {538, 39},
+  {552, 47}, {587, 28}, {616, 27}, {638, 38}, {671, 29}, {684, 45}, {720, 34}, {12, 34},
+  {19, 57}, {85, 61}, {101, 63}, {107, 21}, {109, 17}, {198, 13}, {209, 12}, {255, 9},
+  {282, 10}, {319, 50}, {361, 0}, {408, 2}, {431, 3}, {474, 1}, {485, 35}, {538, 39},
+  {552, 47}, {588, 28}, {617, 27}, {637, 38}, {671, 29}, {684, 45}, {720, 34}, {12, 34},
+  {17, 57}, {87, 61}, {99, 63}, {108, 21}, {111, 17}, {198, 13}, {209, 12}, {257, 9},
+  {282, 10}, {319, 50}, {361, 0}, {408, 2}, {431, 3}, {473, 1}, {486, 35}, {537, 39},
+  {553, 47}, {588, 28}, {618, 27}, {636, 38}, {671, 29}, {683, 45}, {720, 34}, {11, 34},
+  {16, 64}, {88, 61}, {96, 63}, {108, 21}, {112, 17}, {198, 13}, {210, 12}, {258, 9},
+  {281, 10}, {319, 50}, {360, 0}, {408, 2}, {431, 3}, {472, 1}, {486, 35}, {537, 39},
+  {554, 47}, {587, 28}, {618, 27}, {636, 38}, {671, 29}, {683, 45}, {720, 34}, {9, 34},
+  {16, 64}, {90, 61}, {94, 63}, {109, 21}, {114, 17}, {198, 13}, {211, 12}, {259, 9},
+  {281, 10}, {319, 50}, {360, 0}, {408, 2}, {431, 3}, {471, 1}, {486, 35}, {537, 39},
+  {554, 47}, {587, 28}, {619, 27}, {635, 38}, {671, 29}, {683, 45}, {720, 34}, {7, 34},
+  {17, 64}, {92, 61}, {110, 21}, {116, 17}, {197, 13}, {212, 12}, {261, 9}, {281, 10},
+  {319, 50}, {360, 0}, {407, 2}, {431, 3}, {470, 1}, {487, 35}, {537, 39}, {555, 47},
+  {587, 28}, {619, 27}, {634, 38}, {671, 29}, {681, 45}, {720, 34}, {5, 34}, {17, 64},
+  {92, 61}, {111, 21}, {118, 17}, {195, 13}, {212, 12}, {214, 18}, {262, 9}, {280, 10},
+  {319, 50}, {359, 0}, {407, 2}, {431, 3}, {470, 1}, {487, 35}, {537, 39}, {556, 47},
+  {586, 28}, {620, 27}, {634, 38}, {671, 29}, {680, 45}, {720, 34}, {3, 34}, {17, 64},
+  {92, 61}, {111, 21}, {120, 17}, {194, 13}, {212, 12}, {216, 18}, {263, 9}, {280, 10},
+  {319, 50}, {359, 0}, {407, 2}, {431, 3}, {469, 1}, {487, 35}, {537, 39}, {557, 47},
+  {584, 28}, {620, 27}, {633, 38}, {671, 29}, {678, 45}, {720, 34}, {1, 34}, {18, 64},
+  {91, 61}, {112, 21}, {122, 17}, {193, 13}, {212, 12}, {218, 18}, {264, 9}, {280, 10},
+  {319, 50}, {359, 0}, {407, 2}, {431, 3}, {468, 1}, {488, 35}, {538, 39}, {557, 47},
+  {583, 28}, {621, 27}, {632, 38}, {671, 29}, {676, 45}, {720, 34}, {18, 64}, {91, 61},
+  {113, 21}, {124, 17}, {192, 13}, {211, 12}, {218, 18}, {265, 9}, {279, 10}, {319, 50},
+  {358, 0}, {406, 2}, {431, 3}, {467, 1}, {488, 35}, {539, 39}, {558, 47}, {581, 28},
+  {622, 27}, {632, 38}, {671, 29}, {675, 45}, {719, 34}, {720, 64}, {19, 64}, {91, 61},
+  {113, 21}, {126, 17}, {191, 13}, {211, 12}, {218, 18}, {267, 9}, {279, 10}, {319, 50},
+  {358, 0}, {406, 2}, {432, 3}, {466, 1}, {488, 35}, {489, 31}, {540, 39}, {559, 47},
+  {579, 28}, {622, 27}, {631, 38}, {672, 29}, {673, 45}, {718, 34}, {720, 64}, {19, 64},
+  {90, 61}, {114, 21}, {128, 17}, {191, 13}, {211, 12}, {218, 18}, {268, 9}, {278, 10},
+  {319, 50}, {358, 0}, {406, 2}, {432, 3}, {466, 1}, {488, 35}, {490, 31}, {541, 39},
+  {559, 47}, {579, 28}, {623, 27}, {630, 38}, {672, 29}, {717, 34}, {720, 64}, {19, 64},
+  {90, 61}, {114, 21}, {130, 17}, {191, 13}, {211, 12}, {218, 18}, {269, 9}, {278, 10},
+  {319, 50}, {357, 0}, {406, 2}, {432, 3}, {466, 1}, {488, 35}, {491, 31}, {541, 39},
+  {559, 47}, {578, 28}, {623, 27}, {630, 38}, {672, 29}, {717, 34}, {720, 64}, {20, 64},
+  {90, 61}, {115, 21}, {132, 17}, {190, 13}, {211, 12}, {218, 18}, {271, 9}, {278, 10},
+  {319, 50}, {357, 0}, {406, 2}, {432, 3}, {467, 1}, {488, 35}, {492, 31}, {542, 39},
+  {558, 47}, {578, 28}, {624, 27}, {629, 38}, {672, 29}, {716, 34}, {720, 64}, {20, 64},
+  {90, 61}, {116, 21}, {134, 17}, {188, 13}, {211, 12}, {218, 18}, {272, 9}, {277, 10},
+  {318, 50}, {357, 0}, {405, 2}, {432, 3}, {467, 1}, {488, 35}, {493, 31}, {543, 39},
+  {558, 47}, {577, 28}, {625, 27}, {628, 38}, {672, 29}, {715, 34}, {720, 64}, {20, 64},
+  {89, 61}, {116, 21}, {136, 17}, {185, 13}, {211, 12}, {218, 18}, {273, 9}, {277, 10},
+  {318, 50}, {356, 0}, {405, 2}, {432, 3}, {467, 1}, {487, 35}, {494, 31}, {544, 39},
+  {558, 47}, {577, 28}, {626, 27}, {628, 38}, {671, 29}, {715, 34}, {720, 64}, {21, 64},
+  {89, 61}, {117, 21}, {138, 17}, {184, 13}, {210, 12}, {218, 18}, {275, 9}, {277, 10},
+  {317, 50}, {356, 0}, {405, 2}, {432, 3}, {467, 1}, {487, 35}, {495, 31}, {543, 39},
+  {545, 37}, {558, 47}, {576, 28}, {627, 27}, {671, 29}, {714, 34}, {720, 64}, {21, 64},
+  {89, 61}, {117, 21}, {140, 17}, {184, 13}, {210, 12}, {221, 18}, {276, 9}, {317, 50},
+  {356, 0}, {405, 2}, {432, 3}, {467, 1}, {487, 35}, {496, 31}, {543, 39}, {547, 37},
+  {558, 47}, {576, 28}, {628, 27}, {671, 29}, {714, 34}, {720, 64}, {22, 64}, {88, 61},
+  {118, 21}, {142, 17}, {184, 13}, {210, 12}, {223, 18}, {276, 9}, {317, 50}, {355, 0},
+  {404, 2}, {432, 3}, {467, 1}, {487, 35}, {497, 31}, {542, 39}, {548, 37}, {557, 47},
+  {575, 28}, {628, 27}, {671, 29}, {713, 34}, {720, 64}, {22, 64}, {88, 61}, {119, 21},
+  {145, 17}, {184, 13}, {192, 12}, {197, 20}, {210, 12}, {225, 18}, {276, 9}, {316, 50},
+  {341, 0}, {348, 5}, {355, 0}, {404, 2}, {432, 3}, {467, 1}, {487, 35}, {498, 31},
+  {541, 39}, {549, 37}, {557, 47}, {575, 28}, {629, 27}, {670, 29}, {712, 34}, {720, 64},
+  {23, 64}, {87, 61}, {119, 21}, {147, 17}, {184, 13}, {191, 12}, {201, 20}, {203, 12},
+  {225, 18}, {276, 9}, {316, 50}, {337, 0}, {351, 5}, {354, 0}, {404, 2}, {432, 3},
+  {467, 1}, {486, 35}, {498, 31}, {541, 39}, {551, 37}, {556, 47}, {629, 27}, {670, 29},
+  {712, 34}, {720, 64}, {23, 64}, {87, 61}, {120, 21}, {150, 17}, {167, 13}, {171, 15},
+  {184, 13}, {191, 12}, {202, 20}, {226, 18}, {276, 9}, {315, 50}, {334, 0}, {353, 5},
+  {354, 0}, {379, 2}, {382, 3}, {403, 2}, {412, 4}, {432, 3}, {467, 1}, {486, 35},
+  {498, 31}, {521, 39}, {522, 44}, {540, 39}, {552, 37}, {555, 47}, {630, 27}, {670, 29},
+  {711, 34}, {720, 64}, {23, 64}, {87, 61}, {121, 21}, {152, 17}, {163, 13}, {172, 15},
+  {183, 13}, {190, 12}, {202, 20}, {227, 18}, {276, 9}, {315, 50}, {330, 0}, {354, 5},
+  {377, 2}, {396, 3}, {401, 2}, {422, 4}, {432, 3}, {467, 1}, {486, 35}, {499, 31},
+  {521, 39}, {524, 44}, {539, 39}, {551, 37}, {554, 39}, {630, 27}, {670, 29}, {710, 34},
+  {720, 64}, {24, 64}, {86, 61}, {121, 21}, {154, 17}, {163, 13}, {173, 15}, {183, 13},
+  {190, 12}, {201, 20}, {227, 18}, {276, 9}, {314, 50}, {319, 0}, {327, 49}, {355, 5},
+  {375, 2}, {401, 3}, {433, 4}, {467, 1}, {486, 35}, {499, 31}, {521, 39}, {526, 44},
+  {539, 39}, {549, 37}, {554, 39}, {631, 27}, {670, 29}, {710, 34}, {720, 64}, {24, 64},
+  {86, 61}, {122, 21}, {154, 17}, {162, 13}, {173, 15}, {183, 13}, {189, 12}, {201, 20},
+  {228, 18}, {276, 9}, {312, 50}, {327, 49}, {356, 5}, {373, 2}, {401, 3}, {433, 4},
+  {436, 41}, {467, 1}, {486, 35}, {499, 31}, {521, 39}, {528, 44}, {538, 39}, {547, 37},
+  {554, 39}, {630, 27}, {633, 38}, {669, 29}, {709, 34}, {720, 64}, {25, 64}, {86, 61},
+  {123, 21}, {153, 17}, {162, 13}, {174, 15}, {183, 13}, {188, 12}, {200, 20}, {229, 18},
+  {275, 9}, {279, 48}, {310, 50}, {328, 49}, {358, 5}, {370, 2}, {402, 3}, {433, 4},
+  {436, 41}, {467, 1}, {486, 35}, {500, 31}, {521, 39}, {530, 44}, {537, 39}, {545, 37},
+  {554, 39}, {630, 27}, {636, 38}, {669, 29}, {708, 34}, {720, 64}, {25, 64}, {85, 61},
+  {123, 21}, {153, 17}, {162, 13}, {175, 15}, {183, 13}, {188, 12}, {200, 20}, {229, 18},
+  {275, 9}, {285, 48}, {308, 50}, {328, 49}, {361, 5}, {368, 2}, {402, 3}, {432, 4},
+  {437, 41}, {467, 1}, {485, 35}, {500, 31}, {522, 39}, {532, 44}, {537, 39}, {543, 37},
+  {554, 39}, {629, 27}, {640, 38}, {669, 29}, {708, 34}, {720, 64}, {25, 64}, {85, 61},
+  {124, 21}, {152, 17}, {162, 13}, {176, 15}, {183, 13}, {187, 12}, {199, 20}, {230, 18},
+  {274, 9}, {291, 48}, {306, 50}, {329, 49}, {363, 5}, {367, 2}, {402, 3}, {432, 4},
+  {438, 41}, {467, 1}, {485, 35}, {501, 31}, {522, 39}, {534, 44}, {536, 39}, {541, 37},
+  {554, 39}, {628, 27}, {644, 38}, {669, 29}, {707, 34}, {720, 64}, {26, 64}, {84, 61},
+  {125, 21}, {152, 17}, {162, 13}, {176, 15}, {183, 13}, {187, 12}, {199, 20}, {229, 18},
+  {246, 19}, {273, 9}, {299, 48}, {303, 50}, {329, 49}, {363, 5}, {367, 2}, {402, 3},
+  {431, 4}, {439, 41}, {467, 1}, {484, 35}, {485, 46}, {501, 31}, {522, 39}, {535, 44},
+  {540, 37}, {555, 39}, {628, 27}, {649, 38}, {668, 29}, {706, 34}, {720, 64}, {26, 64},
+  {84, 61}, {125, 21}, {142, 17}, {162, 13}, {177, 15}, {183, 13}, {186, 12}, {198, 20},
+  {227, 18}, {263, 19}, {272, 9}, {303, 48}, {330, 49}, {363, 5}, {368, 2}, {402, 3},
+  {431, 4}, {438, 41}, {467, 1}, {481, 35}, {486, 46}, {502, 31}, {522, 39}, {535, 44},
+  {541, 37}, {555, 39}, {627, 27}, {653, 38}, {668, 29}, {706, 34}, {720, 64}, {27, 64},
+  {84, 61}, {126, 21}, {142, 17}, {162, 13}, {178, 15}, {183, 13}, {186, 12}, {198, 20},
+  {224, 18}, {272, 19}, {304, 48}, {330, 49}, {362, 5}, {368, 2}, {403, 3}, {430, 4},
+  {438, 41}, {467, 1}, {478, 35}, {487, 46}, {502, 31}, {522, 39}, {535, 44}, {541, 37},
+  {555, 39}, {626, 27}, {658, 38}, {668, 29}, {705, 34}, {720, 64}, {27, 64}, {83, 61},
+  {127, 21}, {143, 17}, {152, 13}, {154, 15}, {162, 13}, {179, 15}, {183, 13}, {185, 12},
+  {197, 20}, {222, 18}, {272, 19}, {305, 48}, {331, 49}, {362, 5}, {368, 2}, {403, 3},
+  {430, 4}, {437, 41}, {466, 1}, {467, 46}, {476, 35}, {488, 46}, {502, 31}, {522, 39},
+  {535, 44}, {542, 37}, {555, 39}, {625, 27}, {664, 38}, {668, 29}, {704, 34}, {720, 64},
+  {28, 64}, {83, 61}, {128, 21}, {143, 17}, {151, 13}, {156, 15}, {162, 13}, {180, 15},
+  {183, 13}, {184, 12}, {197, 20}, {220, 18}, {272, 19}, {306, 48}, {332, 49}, {361, 5},
+  {369, 2}, {403, 3}, {429, 4}, {436, 41}, {464, 1}, {469, 46}, {475, 35}, {489, 46},
+  {503, 31}, {522, 39}, {535, 44}, {543, 37}, {555, 39}, {625, 27}, {668, 38}, {703, 34},
+  {720, 64}, {28, 64}, {82, 61}, {128, 21}, {143, 17}, {151, 13}, {157, 15}, {162, 13},
+  {180, 15}, {183, 13}, {184, 12}, {196, 20}, {218, 18}, {272, 19}, {307, 48}, {332, 49},
+  {361, 5}, {369, 2}, {403, 3}, {429, 4}, {436, 41}, {462, 1}, {471, 46}, {474, 35},
+  {490, 46}, {502, 31}, {523, 39}, {535, 44}, {542, 37}, {548, 27}, {555, 39}, {624, 27},
+  {669, 38}, {703, 34}, {720, 64}, {29, 64}, {82, 61}, {129, 21}, {143, 17}, {150, 13},
+  {158, 15}, {162, 13}, {181, 15}, {183, 13}, {196, 20}, {218, 18}, {271, 19}, {307, 48},
+  {333, 49}, {361, 5}, {370, 2}, {403, 3}, {428, 4}, {435, 41}, {461, 1}, {491, 46},
+  {501, 31}, {523, 39}, {535, 44}, {540, 37}, {624, 27}, {669, 38}, {702, 34}, {720, 64},
+  {29, 64}, {81, 61}, {130, 21}, {143, 17}, {149, 13}, {159, 15}, {162, 13}, {182, 15},
+  {183, 18}, {195, 20}, {217, 18}, {271, 19}, {308, 48}, {333, 49}, {360, 5}, {370, 2},
+  {404, 3}, {428, 4}, {434, 41}, {461, 1}, {492, 46}, {500, 31}, {523, 39}, {535, 44},
+  {538, 37}, {624, 27}, {670, 38}, {701, 34}, {720, 64}, {30, 64}, {81, 61}, {130, 21},
+  {143, 17}, {149, 13}, {161, 15}, {162, 13}, {181, 15}, {190, 18}, {195, 20}, {216, 18},
+  {271, 19}, {309, 48}, {334, 49}, {360, 5}, {371, 2}, {404, 3}, {427, 4}, {434, 41},
+  {461, 1}, {493, 46}, {495, 31}, {499, 43}, {523, 39}, {535, 44}, {536, 37}, {623, 27},
+  {671, 38}, {700, 34}, {720, 64}, {30, 64}, {81, 61}, {131, 21}, {143, 17}, {148, 14},
+  {180, 15}, {215, 18}, {271, 19}, {310, 48}, {334, 49}, {359, 5}, {360, 6}, {371, 2},
+  {404, 3}, {426, 4}, {433, 41}, {460, 1}, {493, 46}, {500, 43}, {523, 39}, {535, 44},
+  {621, 27}, {672, 38}, {700, 34}, {720, 64}, {31, 64}, {80, 61}, {132, 21}, {142, 17},
+  {149, 14}, {179, 15}, {215, 18}, {271, 19}, {310, 48}, {335, 49}, {358, 5}, {359, 6},
+  {372, 2}, {403, 3}, {406, 40}, {426, 4}, {432, 41}, {460, 1}, {492, 46}, {501, 43},
+  {523, 39}, {535, 44}, {620, 27}, {673, 38}, {699, 34}, {720, 64}, {31, 64}, {80, 61},
+  {132, 21}, {141, 17}, {151, 14}, {178, 15}, {214, 18}, {270, 19}, {311, 48}, {336, 49},
+  {357, 5}, {359, 6}, {372, 2}, {402, 3}, {407, 40}, {425, 4}, {432, 41}, {460, 1},
+  {491, 46}, {502, 43}, {523, 39}, {534, 44}, {618, 27}, {674, 38}, {698, 34}, {720, 64},
+  {32, 64}, {79, 61}, {132, 21}, {141, 17}, {152, 14}, {179, 15}, {213, 18}, {270, 19},
+  {312, 48}, {336, 49}, {355, 5}, {359, 6}, {373, 2}, {402, 3}, {409, 40}, {424, 4},
+  {430, 41}, {431, 42}, {460, 1}, {490, 46}, {502, 43}, {524, 39}, {534, 44}, {617, 27},
+  {674, 38}, {697, 34}, {720, 64}, {32, 64}, {79, 61}, {131, 21}, {141, 17}, {154, 14},
+  {180, 15}, {212, 18}, {269, 19}, {271, 26}, {313, 48}, {336, 49}, {354, 5}, {359, 6},
+  {374, 2}, {400, 3}, {401, 6}, {410, 40}, {424, 4}, {429, 41}, {431, 42}, {460, 1},
+  {490, 46}, {503, 43}, {524, 39}, {533, 44}, {615, 27}, {675, 38}, {697, 34}, {720, 64},
+  {33, 64}, {78, 61}, {131, 21}, {142, 17}, {155, 14}, {180, 15}, {212, 18}, {268, 19},
+  {271, 26}, {313, 48}, {336, 49}, {353, 5}, {359, 6}, {376, 2}, {398, 3}, {401, 6},
+  {411, 40}, {423, 4}, {429, 41}, {431, 42}, {458, 1}, {489, 46}, {504, 43}, {524, 39},
+  {533, 44}, {614, 27}, {676, 38}, {696, 34}, {720, 64}, {33, 64}, {78, 61}, {131, 21},
+  {142, 17}, {157, 14}, {171, 15}, {172, 18}, {181, 15}, {213, 18}, {266, 19}, {272, 26},
+  {314, 48}, {335, 49}, {351, 5}, {359, 6}, {377, 2}, {395, 3}, {401, 6}, {413, 40},
+  {420, 4}, {427, 40}, {431, 36}, {457, 1}, {488, 46}, {504, 43}, {524, 39}, {532, 44},
+  {612, 27}, {677, 38}, {695, 34}, {720, 64}, {34, 64}, {77, 61}, {130, 21}, {142, 17},
+  {158, 14}, {169, 15}, {173, 18}, {182, 15}, {214, 18}, {264, 19}, {272, 26}, {315, 48},
+  {335, 49}, {350, 5}, {359, 6}, {379, 2}, {392, 3}, {400, 6}, {414, 40}, {416, 4},
+  {428, 40}, {432, 36}, {457, 1}, {488, 46}, {505, 43}, {525, 39}, {532, 44}, {610, 27},
+  {678, 38}, {694, 34}, {720, 64}, {34, 64}, {77, 61}, {130, 21}, {143, 17}, {160, 14},
+  {167, 15}, {174, 18}, {183, 15}, {215, 18}, {263, 19}, {273, 26}, {316, 48}, {335, 49},
+  {349, 5}, {358, 6}, {381, 2}, {389, 3}, {400, 6}, {429, 40}, {433, 36}, {456, 1},
+  {488, 46}, {506, 43}, {525, 39}, {531, 44}, {609, 27}, {679, 38}, {693, 34}, {720, 64},
+  {35, 64}, {76, 61}, {130, 21}, {143, 17}, {167, 14}, {176, 18}, {184, 15}, {217, 18},
+  {261, 19}, {273, 26}, {317, 48}, {335, 49}, {347, 5}, {358, 6}, {383, 2}, {385, 3},
+  {400, 6}, {430, 40}, {433, 36}, {456, 1}, {488, 46}, {507, 43}, {526, 39}, {531, 44},
+  {607, 27}, {680, 38}, {692, 34}, {720, 64}, {35, 64}, {76, 61}, {130, 21}, {144, 17},
+  {167, 14}, {177, 18}, {185, 15}, {218, 18}, {260, 19}, {274, 26}, {318, 48}, {335, 49},
+  {346, 5}, {358, 6}, {384, 2}, {399, 6}, {431, 40}, {434, 36}, {454, 1}, {489, 46},
+  {507, 43}, {526, 39}, {530, 44}, {605, 27}, {681, 38}, {691, 34}, {720, 64}, {36, 64},
+  {75, 61}, {130, 21}, {144, 17}, {167, 14}, {178, 18}, {185, 15}, {219, 18}, {258, 19},
+  {274, 26}, {319, 48}, {339, 49}, {344, 5}, {358, 6}, {384, 2}, {399, 6}, {432, 40},
+  {435, 36}, {450, 1}, {471, 46}, {472, 31}, {489, 46}, {508, 43}, {527, 39}, {530, 44},
+  {604, 27}, {682, 38}, {691, 34}, {720, 64}, {36, 64}, {73, 61}, {130, 21}, {144, 17},
+  {167, 14}, {180, 18}, {186, 15}, {221, 18}, {256, 19}, {257, 22}, {275, 26}, {319, 48},
+  {343, 49}, {358, 6}, {385, 2}, {399, 6}, {434, 40}, {435, 36}, {446, 1}, {470, 46},
+  {474, 31}, {489, 46}, {491, 31}, {509, 43}, {526, 39}, {533, 37}, {601, 27}, {681, 38},
+  {690, 34}, {720, 64}, {37, 64}, {72, 61}, {131, 21}, {142, 17}, {167, 14}, {181, 18},
+  {187, 15}, {222, 18}, {254, 19}, {256, 22}, {275, 26}, {320, 48}, {344, 49}, {358, 6},
+  {385, 2}, {398, 6}, {435, 40}, {436, 36}, {441, 1}, {442, 35}, {470, 46}, {476, 31},
+  {488, 46}, {507, 31}, {510, 43}, {522, 39}, {526, 31}, {539, 37}, {601, 27}, {680, 38},
+  {691, 34}, {720, 64}, {37, 64}, {71, 61}, {131, 21}, {141, 17}, {167, 14}, {183, 18},
+  {188, 15}, {224, 18}, {252, 19}, {256, 22}, {276, 26}, {321, 48}, {345, 49}, {357, 6},
+  {385, 2}, {398, 6}, {417, 40}, {419, 1}, {436, 40}, {437, 36}, {440, 1}, {444, 35},
+  {469, 46}, {479, 31}, {487, 46}, {512, 31}, {515, 39}, {526, 31}, {546, 37}, {602, 27},
+  {677, 38}, {679, 45}, {692, 34}, {720, 64}, {38, 64}, {69, 61}, {131, 21}, {140, 17},
+  {167, 14}, {184, 18}, {188, 15}, {225, 18}, {251, 19}, {256, 22}, {277, 26}, {322, 48},
+  {346, 49}, {358, 6}, {386, 2}, {398, 6}, {416, 40}, {421, 1}, {438, 40}, {446, 35},
+  {469, 46}, {481, 31}, {487, 46}, {511, 31}, {514, 37}, {526, 31}, {548, 37}, {602, 27},
+  {674, 38}, {679, 45}, {694, 34}, {720, 64}, {39, 64}, {67, 61}, {70, 8}, {131, 21},
+  {138, 17}, {167, 14}, {186, 18}, {187, 15}, {227, 18}, {251, 19}, {256, 22}, {277, 26},
+  {323, 48}, {347, 49}, {359, 6}, {386, 2}, {400, 6}, {415, 40}, {423, 1}, {437, 40},
+  {447, 35}, {458, 46}, {464, 35}, {468, 46}, {483, 31}, {486, 46}, {509, 31}, {514, 37},
+  {525, 31}, {549, 37}, {602, 27}, {627, 38}, {628, 29}, {671, 38}, {678, 45}, {695, 34},
+  {720, 64}, {37, 64}, {40, 7}, {65, 61}, {71, 8}, {127, 21}, {134, 14}, {137, 17},
+  {167, 14}, {227, 18}, {251, 19}, {256, 22}, {278, 26}, {324, 48}, {348, 49}, {360, 6},
+  {386, 2}, {401, 6}, {414, 40}, {425, 1}, {437, 40}, {449, 35}, {457, 46}, {468, 35},
+  {508, 31}, {514, 37}, {525, 31}, {550, 37}, {602, 27}, {625, 38}, {630, 29}, {667, 38},
+  {677, 45}, {697, 34}, {720, 64}, {29, 64}, {43, 7}, {63, 61}, {72, 8}, {118, 21},
+  {168, 14}, {227, 18}, {250, 19}, {255, 22}, {278, 26}, {325, 48}, {347, 49}, {361, 6},
+  {383, 2}, {402, 6}, {413, 40}, {428, 1}, {436, 40}, {451, 35}, {456, 46}, {468, 35},
+  {507, 31}, {514, 37}, {525, 31}, {551, 37}, {602, 27}, {623, 38}, {631, 29}, {663, 38},
+  {677, 45}, {699, 34}, {720, 64}, {19, 64}, {47, 7}, {60, 61}, {73, 8}, {102, 21},
+  {168, 14}, {226, 18}, {250, 19}, {255, 22}, {279, 26}, {325, 48}, {347, 49}, {366, 6},
+  {373, 2}, {374, 6}, {379, 2}, {404, 6}, {412, 40}, {430, 1}, {435, 40}, {453, 35},
+  {455, 46}, {469, 35}, {506, 31}, {513, 37}, {525, 31}, {552, 37}, {602, 27}, {621, 38},
+  {633, 29}, {659, 38}, {676, 45}, {700, 34}, {705, 7}, {720, 64}, {51, 7}, {58, 61},
+  {74, 8}, {103, 21}, {167, 14}, {183, 15}, {225, 18}, {249, 19}, {255, 22}, {280, 26},
+  {325, 48}, {346, 49}, {407, 6}, {411, 40}, {435, 1}, {469, 35}, {506, 31}, {513, 37},
+  {525, 31}, {552, 37}, {602, 27}, {620, 38}, {635, 29}, {654, 38}, {676, 45}, {700, 34},
+  {720, 7}, {55, 7}, {75, 8}, {104, 21}, {167, 14}, {184, 15}, {225, 18}, {249, 19},
+  {255, 22}, {280, 26}, {325, 48}, {346, 49}, {407, 6}, {411, 40}, {436, 1}, {470, 35},
+  {505, 31}, {513, 37}, {525, 31}, {553, 37}, {603, 27}, {618, 38}, {636, 29}, {649, 38},
+  {675, 45}, {700, 34}, {720, 7}, {55, 7}, {76, 8}, {105, 21}, {167, 14}, {190, 15},
+  {224, 18}, {249, 19}, {254, 22}, {281, 26}, {325, 48}, {345, 49}, {406, 6}, {412, 40},
+  {437, 1}, {470, 35}, {505, 31}, {513, 37}, {525, 31}, {554, 37}, {603, 27}, {617, 38},
+  {638, 29}, {643, 38}, {674, 45}, {700, 34}, {720, 7}, {54, 7}, {77, 8}, {107, 21},
+  {164, 14}, {190, 15}, {224, 18}, {248, 19}, {254, 22}, {281, 26}, {324, 48}, {345, 49},
+  {406, 6}, {412, 40}, {437, 1}, {471, 35}, {504, 31}, {512, 37}, {525, 31}, {555, 37},
+  {603, 27}, {616, 38}, {639, 29}, {674, 45}, {700, 34}, {720, 7}, {54, 7}, {78, 8},
+  {108, 21}, {161, 14}, {190, 15}, {223, 18}, {248, 19}, {254, 22}, {282, 26}, {324, 48},
+  {344, 49}, {405, 6}, {413, 40}, {438, 1}, {466, 35}, {504, 31}, {512, 37}, {525, 31},
+  {553, 37}, {557, 28}, {603, 27}, {615, 38}, {638, 29}, {673, 45}, {700, 34}, {720, 7},
+  {54, 7}, {79, 8}, {109, 21}, {157, 14}, {189, 15}, {222, 18}, {247, 19}, {254, 22},
+  {283, 26}, {324, 48}, {344, 49}, {404, 6}, {415, 40}, {438, 1}, {456, 35}, {503, 31},
+  {512, 37}, {525, 31}, {551, 37}, {558, 28}, {615, 27}, {638, 29}, {672, 45}, {700, 34},
+  {720, 7}, {54, 7}, {80, 8}, {111, 21}, {154, 14}, {189, 15}, {221, 18}, {247, 19},
+  {253, 22}, {284, 26}, {324, 48}, {343, 49}, {403, 6}, {417, 40}, {439, 1}, {455, 35},
+  {503, 31}, {511, 37}, {525, 31}, {550, 37}, {558, 28}, {616, 27}, {637, 29}, {672, 45},
+  {700, 34}, {720, 7}, {53, 7}, {81, 8}, {112, 21}, {150, 14}, {189, 15}, {220, 18},
+  {246, 19}, {253, 22}, {284, 26}, {324, 48}, {342, 49}, {404, 6}, {420, 40}, {440, 1},
+  {454, 35}, {502, 31}, {511, 37}, {524, 31}, {548, 37}, {558, 28}, {617, 27}, {636, 29},
+  {671, 45}, {700, 34}, {720, 7}, {53, 7}, {82, 8}, {114, 21}, {146, 14}, {170, 15},
+  {171, 12}, {191, 15}, {219, 18}, {246, 19}, {253, 22}, {285, 26}, {324, 48}, {342, 49},
+  {405, 6}, {420, 40}, {440, 1}, {454, 35}, {501, 31}, {511, 37}, {524, 31}, {546, 37},
+  {558, 28}, {618, 27}, {636, 29}, {670, 45}, {700, 34}, {720, 7}, {52, 7}, {84, 8},
+  {115, 21}, {142, 14}, {169, 15}, {173, 12}, {192, 15}, {218, 18}, {246, 19}, {252, 22},
+  {286, 26}, {324, 48}, {341, 49}, {407, 6}, {419, 40}, {421, 55}, {441, 1}, {456, 35},
+  {501, 31}, {511, 37}, {524, 31}, {544, 37}, {558, 28}, {619, 27}, {635, 29}, {669, 45},
+  {701, 34}, {720, 7}, {52, 7}, {85, 8}, {117, 21}, {141, 14}, {143, 13}, {169, 15},
+  {175, 12}, {193, 15}, {217, 18}, {245, 19}, {252, 22}, {286, 26}, {324, 48}, {355, 49},
+  {407, 6}, {417, 40}, {422, 55}, {446, 1}, {458, 35}, {501, 31}, {510, 37}, {524, 31},
+  {542, 37}, {558, 28}, {620, 27}, {634, 29}, {669, 45}, {701, 34}, {720, 7}, {51, 7},
+  {86, 8}, {119, 21}, {140, 14}, {144, 13}, {169, 15}, {176, 12}, {194, 15}, {216, 18},
+  {245, 19}, {252, 22}, {287, 26}, {324, 48}, {359, 49}, {407, 6}, {415, 40}, {423, 55},
+  {448, 1}, {459, 35}, {502, 31}, {510, 37}, {524, 31}, {540, 37}, {558, 28}, {621, 27},
+  {633, 29}, {668, 45}, {701, 34}, {720, 7}, {50, 7}, {87, 8}, {120, 21}, {122, 17},
+  {138, 14}, {145, 13}, {168, 15}, {178, 12}, {194, 15}, {215, 18}, {244, 19}, {252, 22},
+  {288, 26}, {323, 48}, {359, 49}, {407, 6}, {413, 40}, {423, 55}, {449, 1}, {460, 35},
+  {502, 31}, {510, 37}, {524, 31}, {538, 37}, {558, 28}, {590, 27}, {595, 38}, {622, 27},
+  {633, 29}, {667, 45}, {701, 34}, {720, 7}, {49, 7}, {89, 8}, {120, 21}, {137, 17},
+  {146, 13}, {169, 15}, {180, 12}, {195, 15}, {214, 18}, {244, 19}, {251, 22}, {289, 26},
+  {322, 48}, {331, 56}, {360, 49}, {407, 6}, {411, 40}, {424, 55}, {450, 1}, {460, 35},
+  {503, 31}, {509, 37}, {524, 31}, {535, 37}, {559, 28}, {589, 27}, {596, 38}, {623, 27},
+  {632, 29}, {666, 45}, {701, 34}, {720, 7}, {49, 7}, {90, 8}, {120, 21}, {137, 17},
+  {147, 13}, {169, 15}, {182, 12}, {195, 15}, {214, 18}, {243, 19}, {251, 22}, {290, 26},
+  {321, 48}, {333, 56}, {360, 49}, {408, 6}, {409, 40}, {425, 55}, {452, 1}, {460, 35},
+  {503, 31}, {509, 37}, {524, 31}, {533, 37}, {559, 28}, {588, 27}, {597, 38}, {624, 27},
+  {631, 29}, {666, 45}, {701, 34}, {720, 7}, {48, 7}, {91, 8}, {120, 21}, {137, 17},
+  {148, 13}, {170, 15}, {184, 12}, {196, 15}, {214, 18}, {243, 19}, {251, 22}, {290, 26},
+  {319, 48}, {335, 56}, {360, 49}, {408, 6}, {426, 55}, {453, 1}, {459, 35}, {503, 31},
+  {509, 37}, {524, 31}, {531, 37}, {559, 28}, {587, 27}, {598, 38}, {625, 27}, {630, 29},
+  {665, 45}, {701, 34}, {720, 7}, {47, 7}, {93, 8}, {120, 21}, {137, 17}, {151, 13},
+  {170, 15}, {186, 12}, {196, 15}, {213, 18}, {242, 19}, {250, 22}, {291, 26}, {317, 48},
+  {337, 56}, {360, 49}, {408, 6}, {423, 55}, {429, 40}, {455, 1}, {459, 35}, {504, 31},
+  {508, 37}, {521, 31}, {559, 28}, {585, 27}, {599, 38}, {626, 27}, {630, 29}, {664, 45},
+  {701, 34}, {720, 7}, {47, 7}, {94, 8}, {120, 21}, {136, 17}, {153, 13}, {171, 15},
+  {188, 12}, {196, 15}, {213, 18}, {241, 19}, {250, 22}, {292, 26}, {315, 48}, {339, 56},
+  {360, 49}, {408, 6}, {419, 55}, {432, 40}, {456, 1}, {458, 35}, {504, 31}, {508, 37},
+  {517, 31}, {558, 28}, {584, 27}, {600, 38}, {628, 27}, {629, 29}, {663, 45}, {701, 34},
+  {720, 7}, {46, 7}, {96, 8}, {120, 21}, {136, 17}, {156, 13}, {171, 15}, {191, 12},
+  {197, 15}, {212, 18}, {239, 19}, {247, 9}, {250, 22}, {293, 26}, {313, 48}, {341, 56},
+  {360, 49}, {409, 6}, {414, 55}, {435, 40}, {457, 1}, {502, 31}, {513, 37}, {514, 31},
+  {557, 28}, {582, 27}, {601, 38}, {628, 27}, {662, 45}, {701, 34}, {720, 7}, {45, 7},
+  {97, 8}, {120, 21}, {136, 17}, {158, 13}, {172, 15}, {193, 12}, {197, 15}, {212, 18},
+  {235, 19}, {251, 9}, {294, 26}, {310, 48}, {343, 56}, {360, 49}, {410, 6}, {435, 40},
+  {454, 1}, {457, 35}, {501, 31}, {514, 37}, {556, 28}, {581, 27}, {602, 38}, {628, 27},
+  {661, 45}, {702, 34}, {720, 7}, {44, 7}, {99, 8}, {121, 21}, {135, 17}, {158, 13},
+  {172, 15}, {196, 12}, {198, 15}, {212, 18}, {236, 19}, {254, 9}, {295, 26}, {308, 48},
+  {345, 56}, {363, 49}, {411, 6}, {435, 40}, {450, 1}, {457, 35}, {501, 31}, {514, 37},
+  {556, 28}, {579, 27}, {603, 38}, {628, 27}, {660, 45}, {702, 34}, {720, 7}, {43, 7},
+  {100, 8}, {121, 21}, {134, 17}, {135, 14}, {158, 13}, {173, 15}, {198, 12}, {211, 18},
+  {238, 19}, {256, 9}, {296, 26}, {306, 48}, {348, 56}, {364, 49}, {411, 6}, {436, 40},
+  {445, 1}, {457, 35}, {500, 31}, {514, 37}, {555, 28}, {578, 27}, {605, 38}, {628, 27},
+  {659, 45}, {702, 34}, {720, 7}, {42, 7}, {102, 8}, {121, 21}, {131, 17}, {137, 14},
+  {159, 13}, {173, 15}, {199, 12}, {211, 18}, {239, 19}, {258, 9}, {296, 26}, {304, 0},
+  {351, 56}, {364, 49}, {411, 6}, {413, 1}, {435, 40}, {440, 1}, {457, 35}, {500, 31},
+  {515, 37}, {554, 28}, {578, 27}, {606, 38}, {628, 27}, {658, 45}, {702, 34}, {720, 7},
+  {42, 7}, {104, 8}, {121, 21}, {127, 17}, {138, 14}, {159, 13}, {174, 15}, {200, 12},
+  {210, 18}, {241, 19}, {261, 9}, {295, 26}, {306, 0}, {353, 56}, {365, 49}, {410, 6},
+  {416, 1}, {433, 40}, {439, 1}, {458, 35}, {499, 31}, {515, 37}, {553, 28}, {578, 27},
+  {607, 38}, {627, 27}, {657, 45}, {702, 34}, {720, 7}, {41, 7}, {106, 8}, {120, 21},
+  {122, 17}, {140, 14}, {159, 13}, {174, 15}, {202, 12}, {209, 18}, {242, 19}, {263, 9},
+  {293, 26}, {307, 0}, {353, 56}, {364, 49}, {410, 6}, {419, 1}, {431, 40}, {440, 1},
+  {462, 35}, {499, 31}, {516, 37}, {554, 28}, {578, 27}, {609, 38}, {627, 27}, {656, 45},
+  {702, 34}, {720, 7}, {40, 7}, {108, 8}, {114, 21}, {123, 17}, {141, 14}, {159, 13},
+  {175, 15}, {203, 12}, {208, 18}, {244, 19}, {266, 9}, {292, 26}, {309, 0}, {352, 56},
+  {364, 49}, {408, 6}, {410, 40}, {422, 1}, {429, 40}, {441, 1}, {467, 35}, {498, 31},
+  {516, 37}, {555, 28}, {578, 27}, {610, 38}, {627, 27}, {655, 45}, {702, 34}, {720, 7},
+  {39, 7}, {109, 8}, {124, 17}, {143, 14}, {159, 13}, {175, 15}, {204, 12}, {206, 18},
+  {245, 19}, {269, 9}, {291, 26}, {311, 0}, {351, 56}, {364, 49}, {394, 6}, {396, 3},
+  {407, 6}, {411, 40}, {425, 1}, {427, 40}, {443, 1}, {471, 35}, {498, 31}, {516, 37},
+  {556, 28}, {578, 27}, {611, 38}, {627, 27}, {656, 45}, {702, 34}, {720, 7}, {38, 7},
+  {109, 8}, {125, 17}, {145, 14}, {160, 13}, {176, 15}, {205, 12}, {247, 19}, {272, 9},
+  {289, 26}, {312, 0}, {349, 56}, {363, 49}, {394, 6}, {406, 3}, {412, 40}, {444, 1},
+  {472, 35}, {497, 31}, {516, 37}, {557, 28}, {578, 27}, {613, 38}, {620, 27}, {629, 38},
+  {658, 45}, {702, 34}, {720, 7}, {37, 7}, {109, 8}, {126, 17}, {147, 14}, {160, 13},
+  {177, 15}, {205, 12}, {249, 19}, {275, 9}, {287, 26}, {314, 0}, {348, 56}, {363, 49},
+  {393, 6}, {406, 3}, {413, 40}, {445, 1}, {472, 35}, {497, 31}, {516, 37}, {558, 28},
+  {578, 27}, {632, 38}, {660, 45}, {703, 34}, {720, 7}, {36, 7}, {108, 8}, {127, 17},
+  {148, 14}, {160, 13}, {177, 15}, {204, 12}, {205, 18}, {251, 19}, {279, 9}, {284, 26},
+  {286, 24}, {316, 0}, {347, 56}, {362, 49}, {393, 6}, {406, 3}, {414, 40}, {446, 1},
+  {471, 35}, {496, 31}, {516, 37}, {559, 28}, {578, 27}, {638, 38}, {662, 45}, {703, 34},
+  {720, 7}, {35, 7}, {108, 8}, {128, 17}, {149, 14}, {160, 13}, {178, 15}, {202, 12},
+  {208, 18}, {252, 19}, {279, 9}, {286, 24}, {318, 0}, {345, 56}, {363, 49}, {393, 6},
+  {406, 3}, {415, 40}, {446, 1}, {470, 35}, {496, 31}, {516, 37}, {560, 28}, {578, 27},
+  {638, 38}, {664, 45}, {703, 34}, {720, 7}, {34, 7}, {108, 8}, {129, 17}, {150, 14},
+  {160, 13}, {178, 15}, {185, 12}, {202, 15}, {211, 18}, {254, 19}, {274, 9}, {286, 24},
+  {320, 0}, {344, 56}, {363, 49}, {394, 6}, {405, 3}, {416, 40}, {447, 1}, {469, 35},
+  {495, 31}, {516, 37}, {561, 28}, {578, 27}, {639, 38}, {667, 45}, {703, 34}, {720, 7},
+  {31, 7}, {107, 8}, {130, 17}, {151, 14}, {161, 13}, {201, 15}, {214, 18}, {256, 19},
+  {270, 9}, {286, 24}, {322, 0}, {342, 56}, {364, 49}, {394, 6}, {403, 3}, {417, 40},
+  {447, 1}, {462, 35}, {469, 1}, {494, 31}, {516, 37}, {562, 28}, {578, 27}, {639, 38},
+  {670, 45}, {703, 34}, {720, 7}, {27, 7}, {106, 8}, {131, 17}, {152, 14}, {161, 13},
+  {201, 15}, {217, 18}, {259, 19}, {265, 9}, {286, 24}, {324, 0}, {341, 56}, {365, 49},
+  {395, 6}, {401, 3}, {420, 40}, {448, 1}, {450, 35}, {469, 1}, {495, 31}, {516, 37},
+  {563, 28}, {578, 27}, {640, 38}, {672, 45}, {703, 34}, {720, 7}, {24, 7}, {105, 8},
+  {132, 17}, {154, 14}, {158, 13}, {201, 15}, {221, 18}, {259, 19}, {286, 24}, {325, 0},
+  {330, 49}, {339, 56}, {365, 49}, {400, 6}, {422, 40}, {470, 1}, {495, 31}, {516, 37},
+  {564, 28}, {579, 27}, {641, 38}, {675, 45}, {708, 34}, {720, 7}, {20, 7}, {103, 8},
+  {133, 17}, {154, 14}, {201, 15}, {225, 18}, {256, 19}, {286, 24}, {325, 0}, {364, 49},
+  {401, 6}, {423, 40}, {470, 1}, {496, 31}, {516, 37}, {565, 28}, {579, 27}, {641, 38},
+  {678, 45}, {713, 34}, {720, 7}, {16, 7}, {103, 8}, {134, 17}, {153, 14}, {201, 15},
+  {229, 18}, {252, 19}, {286, 24}, {326, 0}, {362, 49}, {402, 6}, {424, 40}, {471, 1},
+  {496, 31}, {516, 37}, {566, 28}, {579, 27}, {642, 38}, {682, 45}, {720, 34}, {10, 34},
+  {12, 7}, {103, 8}, {136, 17}, {151, 14}, {201, 15}, {234, 18}, {247, 19}, {286, 24},
+  {326, 0}, {362, 49}, {401, 6}, {425, 40}, {472, 1}, {497, 31}, {516, 37}, {568, 28},
+  {579, 27}, {643, 38}, {686, 45}, {720, 34}, {11, 34}, {103, 8}, {137, 17}, {150, 14},
+  {201, 15}, {239, 18}, {242, 19}, {286, 24}, {327, 0}, {363, 49}, {399, 6}, {426, 40},
+  {472, 1}, {498, 31}, {515, 37}, {569, 28}, {579, 27}, {644, 38}, {689, 45}, {720, 34},
+  {11, 34}, {86, 8}, {101, 17}, {102, 8}, {140, 17}, {148, 14}, {200, 15}, {241, 18},
+  {286, 24}, {328, 0}, {363, 49}, {398, 6}, {428, 40}, {473, 1}, {498, 31}, {515, 37},
+  {570, 28}, {579, 27}, {644, 38}, {691, 45}, {720, 34}, {12, 34}, {85, 8}, {142, 17},
+  {146, 14}, {200, 15}, {241, 18}, {286, 24}, {328, 0}, {364, 49}, {396, 6}, {429, 40},
+  {473, 1}, {499, 31}, {514, 37}, {572, 28}, {579, 27}, {645, 38}, {690, 45}, {720, 34},
+  {12, 34}, {84, 8}, {144, 17}, {200, 15}, {241, 18}, {286, 24}, {329, 0}, {364, 49},
+  {395, 6}, {431, 40}, {474, 1}, {499, 31}, {514, 37}, {573, 28}, {579, 27}, {645, 38},
+  {647, 29}, {690, 45}, {720, 34}, {12, 34}, {83, 8}, {144, 17}, {200, 15}, {240, 18},
+  {286, 24}, {329, 0}, {365, 49}, {393, 6}, {432, 40}, {475, 1}, {500, 31}, {513, 37},
+  {575, 28}, {579, 27}, {644, 38}, {650, 29}, {689, 45}, {720, 34}, {12, 34}, {82, 8},
+  {143, 17}, {144, 14}, {200, 15}, {240, 18}, {286, 24}, {330, 0}, {365, 49}, {391, 6},
+  {434, 40}, {476, 1}, {501, 31}, {512, 37}, {576, 28}, {578, 27}, {643, 38}, {652, 29},
+  {688, 45}, {720, 34}, {12, 34}, {71, 8}, {140, 17}, {146, 14}, {200, 15}, {240, 18},
+  {286, 24}, {331, 0}, {366, 49}, {390, 6}, {436, 40}, {476, 1}, {501, 31}, {512, 37},
+  {576, 28}, {642, 38}, {655, 29}, {687, 45}, {720, 34}, {12, 34}, {70, 8}, {138, 17},
+  {148, 14}, {199, 15}, {240, 18}, {286, 24}, {331, 0}, {366, 49}, {390, 6}, {437, 40},
+  {477, 1}, {502, 31}, {511, 37}, {576, 28}, {641, 38}, {659, 29}, {688, 45}, {720, 34},
+  {12, 34}, {69, 8}, {135, 17}, {150, 14}, {199, 15}, {240, 18}, {286, 24}, {332, 0},
+  {367, 49}, {390, 6}, {437, 40}, {478, 1}, {503, 31}, {511, 37}, {575, 28}, {640, 38},
+  {662, 29}, {688, 45}, {720, 34}, {12, 34}, {67, 8}, {132, 17}, {152, 14}, {199, 15},
+  {240, 18}, {286, 24}, {333, 0}, {367, 49}, {390, 6}, {437, 40}, {479, 1}, {503, 31},
+  {510, 37}, {574, 28}, {638, 38}, {664, 29}, {689, 45}, {720, 34}, {12, 34}, {66, 8},
+  {102, 17}, {111, 14}, {129, 17}, {155, 14}, {199, 15}, {240, 18}, {286, 24}, {333, 0},
+  {368, 49}, {390, 6}, {438, 40}, {479, 1}, {504, 31}, {509, 37}, {573, 28}, {637, 38},
+  {662, 29}, {689, 45}, {720, 34}, {12, 34}, {64, 8}, {98, 17}, {117, 14}, {125, 17},
+  {157, 14}, {199, 15}, {240, 18}, {286, 24}, {334, 0}, {369, 49}, {390, 6}, {438, 40},
+  {480, 1}, {505, 31}, {508, 37}, {572, 28}, {636, 38}, {661, 29}, {690, 45}, {720, 34},
+  {12, 34}, {63, 8}, {95, 17}, {160, 14}, {198, 15}, {239, 18}, {286, 24}, {335, 0},
+  {369, 49}, {390, 6}, {438, 40}, {481, 1}, {506, 31}, {508, 37}, {571, 28}, {634, 38},
+  {659, 29}, {691, 45}, {720, 34}, {12, 34}, {61, 8}, {91, 17}, {162, 14}, {198, 15},
+  {239, 18}, {286, 24}, {336, 0}, {370, 49}, {390, 6}, {439, 40}, {482, 1}, {507, 31},
+  {570, 28}, {633, 38}, {658, 29}, {691, 45}, {720, 34}, {12, 34}, {60, 8}, {86, 17},
+  {165, 14}, {198, 15}, {239, 18}, {286, 24}, {337, 0}, {371, 49}, {389, 6}, {439, 40},
+  {483, 1}, {507, 31}, {569, 28}, {631, 38}, {656, 29}, {692, 45}, {720, 34}, {12, 34},
+  {58, 8}, {81, 17}, {169, 14}, {198, 15}, {239, 18}, {290, 24}, {338, 0}, {372, 49},
+  {389, 6}, {440, 40}, {484, 1}, {507, 31}, {568, 28}, {630, 38}, {654, 29}, {693, 45},
+  {720, 34}, {13, 34}, {56, 8}, {76, 17}, {172, 14}, {197, 15}, {239, 18}, {308, 24},
+  {326, 0}, {340, 24}, {372, 49}, {389, 6}, {440, 40}, {485, 1}, {507, 31}, {567, 28},
+  {628, 38}, {652, 29}, {694, 45}, {720, 34}, {13, 34}, {56, 8}, {69, 17}, {176, 14},
+  {197, 15}, {239, 18}, {345, 24}, {373, 49}, {389, 6}, {440, 40}, {487, 1}, {507, 31},
+  {566, 28}, {626, 38}, {650, 29}, {694, 45}, {720, 34}, {13, 34}, {56, 8}, {61, 17},
+  {180, 14}, {197, 15}, {238, 18}, {349, 24}, {374, 49}, {389, 6}, {441, 40}, {488, 1},
+  {507, 31}, {564, 28}, {624, 38}, {648, 29}, {695, 45}, {720, 34}, {13, 34}, {56, 8},
+  {184, 14}, {197, 15}, {238, 18}, {355, 24}, {375, 49}, {389, 6}, {441, 40}, {489, 1},
+  {507, 31}, {563, 28}, {622, 38}, {646, 29}, {696, 45}, {720, 34}, {13, 34}, {55, 8},
+  {182, 14}, {200, 15}, {238, 18}, {361, 24}, {374, 49}, {410, 6}, {435, 40}, {444, 6},
+  {490, 1}, {507, 31}, {562, 28}, {620, 38}, {644, 29}, {697, 45}, {720, 34}, {13, 34},
+  {54, 8}, {179, 14}, {204, 15}, {238, 18}, {368, 24}, {450, 6}, {492, 1}, {508, 31},
+  {560, 28}, {618, 38}, {641, 29}, {698, 45}, {720, 34}, {13, 34}, {53, 8}, {175, 14},
+  {205, 15}, {240, 19}, {367, 24}, {458, 6}, {493, 1}, {508, 31}, {559, 28}, {615, 38},
+  {639, 29}, {699, 45}, {720, 34}, {13, 34}, {51, 8}, {171, 14}, {204, 15}, {248, 19},
+  {365, 24}, {469, 6}, {495, 1}, {508, 31}, {557, 28}, {613, 38}, {636, 29}, {700, 45},
+  {720, 34}, {14, 34}, {50, 8}, {166, 14}, {203, 15}, {257, 19}, {363, 24}, {497, 6},
+  {508, 31}, {556, 28}, {611, 38}, {633, 29}, {701, 45}, {720, 34}, {14, 34}, {49, 8},
+  {161, 14}, {203, 15}, {268, 19}, {358, 24}, {362, 0}, {510, 6}, {554, 28}, {609, 38},
+  {629, 29}, {702, 45}, {720, 34}, {14, 34}, {48, 8}, {155, 14}, {202, 15}, {270, 19},
+  {351, 24}, {362, 0}, {516, 6}, {552, 28}, {607, 38}, {626, 29}, {703, 45}, {720, 34},
+  {14, 34}, {46, 8}, {148, 14}, {201, 15}, {271, 19}, {343, 24}, {362, 0}, {523, 6},
+  {550, 28}, {604, 38}, {622, 29}, {705, 45}, {720, 34}, {14, 34}, {45, 8}, {140, 14},
+  {200, 15}, {273, 19}, {332, 24}, {361, 0}, {531, 6}, {548, 28}, {602, 38}, {618, 29},
+  {706, 45}, {720, 34}, {14, 34}, {43, 8}, {128, 14}, {199, 15}, {273, 19}, {293, 0},
+  {311, 24}, {361, 0}, {542, 6}, {547, 28}, {599, 38}, {613, 29}, {708, 45}, {720, 34},
+  {15, 34}, {41, 8}, {117, 14}, {199, 15}, {273, 19}, {360, 0}, {548, 6}, {596, 38},
+  {607, 29}, {709, 45}, {720, 34}, {15, 34}, {40, 8}, {115, 14}, {198, 15}, {273, 19},
+  {360, 0}, {551, 6}, {593, 38}, {601, 29}, {711, 45}, {720, 34}, {15, 34}, {38, 8},
+  {112, 14}, {196, 15}, {273, 19}, {359, 0}, {554, 6}, {589, 38}, {594, 29}, {713, 45},
+  {720, 34}, {15, 34}, {35, 8}, {109, 14}, {195, 15}, {272, 19}, {359, 0}, {557, 6},
+  {585, 38}, {715, 45}, {720, 34}, {15, 34}, {33, 8}, {106, 14}, {194, 15}, {272, 19},
+  {358, 0}, {561, 6}, {579, 38}, {717, 45}, {720, 34}, {16, 34}, {31, 8}, {102, 14},
+  {193, 15}, {272, 19}, {357, 0}, {565, 6}, {571, 38}, {719, 45}, {720, 34}, {2, 45},
+  {16, 34}, {28, 8}, {98, 14}, {191, 15}, {272, 19}, {357, 0}, {568, 6}, {720, 45},
+  {5, 45}, {16, 34}, {25, 8}, {94, 14}, {190, 15}, {272, 19}, {356, 0}, {570, 6},
+  {720, 45}, {8, 45}, {17, 34}, {22, 8}, {89, 14}, {188, 15}, {272, 19}, {355, 0},
+  {573, 6}, {720, 45}, {11, 45}, {17, 34}, {18, 8}, {83, 14}, {186, 15}, {272, 19},
+  {354, 0}, {576, 6}, {720, 45}, {15, 45}, {77, 14}, {184, 15}, {272, 19}, {353, 0},
+  {579, 6}, {720, 45}, {15, 45}, {69, 14}, {182, 15}, {272, 19}, {352, 0}, {582, 6},
+  {720, 45}, {14, 45}, {59, 14}, {179, 15}, {272, 19}, {351, 0}, {586, 6}, {720, 45},
+  {14, 45}, {46, 14}, {176, 15}, {271, 19}, {350, 0}, {591, 6}, {720, 45}, {13, 45},
+  {25, 14}, {173, 15}, {271, 19}, {348, 0}, {596, 6}, {720, 45}, {10, 45}, {170, 15},
+  {271, 19}, {346, 0}, {602, 6}, {720, 45}, {5, 45}, {165, 15}, {271, 19}, {344, 0},
+  {609, 6}, {720, 45}, {161, 15}, {271, 19}, {342, 0}, {618, 6}, {720, 45}, {155, 15},
+  {270, 19}, {340, 0}, {629, 6}, {714, 45}, {720, 15}, {148, 15}, {270, 19}, {337, 0},
+  {644, 6}, {706, 45}, {720, 15}, {139, 15}, {270, 19}, {333, 0}, {671, 6}, {695, 45},
+  {720, 15}, {128, 15}, {269, 19}, {329, 0}, {695, 6}, {720, 15}, {113, 15}, {269, 19},
+  {324, 0}, {700, 6}, {702, 19}, {720, 15}, {7, 19}, {87, 15}, {268, 19}, {317, 0},
+  {703, 6}, {720, 19}, {267, 19}, {309, 0}, {707, 6}, {720, 19}, {266, 19}, {297, 0},
+  {712, 6}, {720, 19}, {265, 19}, {279, 0}, {720, 6}, {10, 6}, {258, 19}, {720, 6},
+  {29, 6}, {240, 19}, {720, 6}, {70, 6}, {198, 19}, {720, 6}, {720, 6}, {720, 6},
+};
@@ -0,0 +1,356 @@
+// Screens and widgets of the weather station, see ui.h
+#include "ui.h"
+#include "card_layers.h"
+#include "layout.h"
+#include "theme.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+UiElements uiElements;
+RedrawStats redrawStats;
+UiBuildStats uiBuildStats;
+
+// Bytes in use on the LVGL heap
+static uint32_t lvglHeapUsed() {
+  lv_mem_monitor_t monitor;
+  lv_mem_monitor(&monitor);
+  return monitor.total_size - monitor.free_size;
+}
+
+// Properties the draw of an object reads from its main part: background, border, shadow, padding and text
+static const lv_style_prop_t drawnProps[] = {
+    LV_STYLE_BG_COLOR,     LV_STYLE_BG_OPA,       LV_STYLE_BG_GRAD_COLOR, LV_STYLE_BG_GRAD_DIR,  LV_STYLE_RADIUS,
+    LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_OPA,    LV_STYLE_SHADOW_WIDTH, LV_STYLE_PAD_TOP,
+    LV_STYLE_PAD_LEFT,     LV_STYLE_TEXT_COLOR,   LV_STYLE_TEXT_FONT,     LV_STYLE_TEXT_OPA,     LV_STYLE_OPA,
+};
+
+uint32_t uiResolveStyles(lv_obj_t *screen) {
+  uint32_t lookups = 0;
+  for (size_t i = 0; i < sizeof(drawnProps) / sizeof(drawnProps[0]); i++) {
+    lv_obj_get_style_prop(screen, LV_PART_MAIN, drawnProps[i]);
+    lookups++;
+  }
+  for (uint32_t i = 0; i < lv_obj_get_child_count(screen); i++) lookups += uiResolveStyles(lv_obj_get_child(screen, i));
+  return lookups;
+}
+
+// Update label text with formatted string, unchanged text does not touch the label
+void updateLabel(lv_obj_t *label, const char *format, ...) {
+  char buffer[128];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (strcmp(lv_label_get_text(label), buffer) == 0) {
+    redrawStats.labelUpdatesSkipped++;
+    return;
+  }
+  redrawStats.labelUpdates++;
+  lv_label_set_text(label, buffer);
+}
+
+// Display event: sum up the invalidated area
+static void invalidateAreaEvent(lv_event_t *e) {
+  const lv_area_t *area = (const lv_area_t *)lv_event_get_param(e);
+  if (area) redrawStats.invalidatedPixels += lv_area_get_size(area);
+}
+
+// Event handler for settings button
+static void settingsButtonEvent(lv_event_t *e) {
+  if (lv_event_get_code(e) == LV_EVENT_CLICKED) lv_disp_load_scr(uiElements.settingScreen);
+}
+
+// Show keyboard for text area input
+static void showKeyboard(lv_event_t *e, lv_obj_t *textArea) {
+  if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+    lv_keyboard_set_textarea(uiElements.keyboard, textArea);
+    lv_obj_clear_flag(uiElements.keyboard, LV_OBJ_FLAG_HIDDEN);
+  }
+}
+
+// Event handlers for text areas
+static void ssidTextAreaEvent(lv_event_t *e) { showKeyboard(e, uiElements.ssidTextArea); }
+static void passwordTextAreaEvent(lv_event_t *e) { showKeyboard(e, uiElements.passwordTextArea); }
+static void metarIdTextAreaEvent(lv_event_t *e) { showKeyboard(e, uiElements.metarIdTextArea); }
+static void timeOffsetTextAreaEvent(lv_event_t *e) { showKeyboard(e, uiElements.timeOffsetTextArea); }
+
+// Handle keyboard events
+static void keyboardEvent(lv_event_t *e) {
+  if (lv_event_get_code(e) == LV_EVENT_READY || lv_event_get_code(e) == LV_EVENT_CANCEL) lv_obj_add_flag(uiElements.keyboard, LV_OBJ_FLAG_HIDDEN);
+}
+
+// Create a styled card panel, a card without height in the layout profile is created hidden
+static lv_obj_t *createCard(lv_obj_t *parent, const LayoutRect &rect) {
+  lv_obj_t *card = lv_obj_create(parent);
+  lv_obj_set_size(card, rect.w, rect.h);
+  lv_obj_set_pos(card, rect.x, rect.y);
+  lv_obj_remove_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+  themeAdd(card, &theme.card, LV_PART_MAIN);
+  if (rect.h == 0)
+    lv_obj_add_flag(card, LV_OBJ_FLAG_HIDDEN);
+  else
+    lv_obj_add_flag(card, LV_OBJ_FLAG_USER_1);  // Marks cards for the static card layers
+  return card;
+}
+
+// Position of label row n inside a card
+static int rowY(int n) { return layout.firstRowY + n * layout.rowHeight; }
+
+// Create a styled label with icon
+static lv_obj_t *createStyledLabel(lv_obj_t *parent, int x, int y, const char *text, const char *icon = nullptr) {
+  lv_obj_t *label = lv_label_create(parent);
+  lv_obj_set_pos(label, x, y);
+  char fullText[200];
+  if (icon)
+    snprintf(fullText, sizeof(fullText), "%s %s", icon, text);
+  else
+    snprintf(fullText, sizeof(fullText), "%s", text);
+  lv_label_set_text(label, fullText);
+  themeAdd(label, &theme.label, LV_PART_MAIN);
+  return label;
+}
+
+// Create a gradient button with icon, small layouts only show the icon
+static lv_obj_t *createGradientButton(lv_obj_t *parent, const LayoutRect &rect, const char *text, const char *icon, lv_event_cb_t eventCb) {
+  lv_obj_t *btn = lv_button_create(parent);
+  lv_obj_set_size(btn, rect.w, rect.h);
+  lv_obj_set_pos(btn, rect.x, rect.y);
+  themeAdd(btn, &theme.button, LV_PART_MAIN);
+  themeAdd(btn, &theme.buttonPressed, LV_PART_MAIN | LV_STATE_PRESSED);
+
+  // Label with icon
+  lv_obj_t *lbl = lv_label_create(btn);
+  lv_obj_center(lbl);
+  char fullText[64];
+  if (icon && layout.iconOnlyButtons)
+    snprintf(fullText, sizeof(fullText), "%s", icon);
+  else if (icon)
+    snprintf(fullText, sizeof(fullText), "%s %s", icon, text);
+  else
+    snprintf(fullText, sizeof(fullText), "%s", text);
+  lv_label_set_text(lbl, fullText);
+  themeAdd(lbl, &theme.label, LV_PART_MAIN);
+  if (eventCb) lv_obj_add_event_cb(btn, eventCb, LV_EVENT_ALL, NULL);
+  return btn;
+}
+
+// Create a text area with modern styling
+static lv_obj_t *createModernTextArea(lv_obj_t *parent, int x, int y, int w, int h, bool oneLine, bool passwordMode, lv_event_cb_t eventCb,
+                                 const char *initialText, const char *placeholder) {
+  lv_obj_t *ta = lv_textarea_create(parent);
+  lv_obj_set_size(ta, w, h);
+  lv_obj_set_pos(ta, x, y);
+  lv_textarea_set_one_line(ta, oneLine);
+  lv_textarea_set_password_mode(ta, passwordMode);
+  if (placeholder) lv_textarea_set_placeholder_text(ta, placeholder);
+
+  themeAdd(ta, &theme.textArea, LV_PART_MAIN);
+  themeAdd(ta, &theme.textAreaFocused, LV_PART_MAIN | LV_STATE_FOCUSED);
+  themeAdd(ta, &theme.textAreaCursor, LV_PART_CURSOR);
+  if (eventCb) lv_obj_add_event_cb(ta, eventCb, LV_EVENT_ALL, NULL);
+  lv_textarea_set_text(ta, initialText);
+  return ta;
+}
+
+// Line chart of the station history, the series get their data from uiShowHistory()
+static void createTrendChart(lv_obj_t *parent) {
+  lv_obj_t *chart = lv_chart_create(parent);
+  lv_obj_set_pos(chart, layout.trendChart.x, layout.trendChart.y);
+  lv_obj_set_size(chart, layout.trendChart.w, layout.trendChart.h);
+  lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+  lv_chart_set_point_count(chart, HISTORY_CAPACITY);
+  lv_chart_set_div_line_count(chart, 0, 0);
+  lv_obj_set_style_bg_opa(chart, LV_OPA_TRANSP, LV_PART_MAIN);
+  lv_obj_set_style_border_width(chart, 0, LV_PART_MAIN);
+  lv_obj_set_style_pad_all(chart, 0, LV_PART_MAIN);
+  lv_obj_set_style_line_width(chart, 2, LV_PART_ITEMS);
+  lv_obj_set_style_size(chart, 0, 0, LV_PART_INDICATOR);  // No point markers
+  uiElements.temperatureSeries = lv_chart_add_series(chart, lv_color_hex(0xff7043), LV_CHART_AXIS_PRIMARY_Y);
+  uiElements.dewPointSeries = lv_chart_add_series(chart, lv_color_hex(0x4fc3f7), LV_CHART_AXIS_PRIMARY_Y);
+  uiElements.pressureSeries = lv_chart_add_series(chart, lv_color_hex(0xb0bec5), LV_CHART_AXIS_SECONDARY_Y);
+  uiElements.trendChart = chart;
+}
+
+void uiShowHistory(History &history) {
+  lv_obj_t *chart = uiElements.trendChart;
+  if (!chart) return;
+  lv_chart_set_ext_y_array(chart, uiElements.temperatureSeries, history.temperature);
+  lv_chart_set_ext_y_array(chart, uiElements.dewPointSeries, history.dewPoint);
+  lv_chart_set_ext_y_array(chart, uiElements.pressureSeries, history.pressure);
+  // The ring starts at head, empty slots are HISTORY_NONE and not drawn
+  lv_chart_set_x_start_point(chart, uiElements.temperatureSeries, history.head);
+  lv_chart_set_x_start_point(chart, uiElements.dewPointSeries, history.head);
+  lv_chart_set_x_start_point(chart, uiElements.pressureSeries, history.head);
+  if (history.count) {
+    // Ranges from the extremes the history keeps up to date, with a margin so no line runs along the border
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, historyExtreme(history.dewPointMin, history.dewPoint) - 2,
+                       historyExtreme(history.temperatureMax, history.temperature) + 2);
+    lv_chart_set_range(chart, LV_CHART_AXIS_SECONDARY_Y, historyExtreme(history.pressureMin, history.pressure) - 1,
+                       historyExtreme(history.pressureMax, history.pressure) + 1);
+  }
+  lv_chart_refresh(chart);
+}
+
+// Initialize main screen, positions come from the layout profile of the board
+static void mainScreenInit(void) {
+  uiElements.mainScreen = lv_obj_create(NULL);
+  lv_obj_remove_flag(uiElements.mainScreen, LV_OBJ_FLAG_SCROLLABLE);
+  themeAdd(uiElements.mainScreen, &theme.screen, LV_PART_MAIN);
+  // Header card
+  lv_obj_t *headerCard = createCard(uiElements.mainScreen, layout.headerCard);
+  uiElements.wifiStatusLabel = createStyledLabel(headerCard, 0, rowY(0), "Disconnected", LV_SYMBOL_CLOSE);
+  uiElements.timeDateLabel = createStyledLabel(headerCard, 0, rowY(1), "Time: --", LV_SYMBOL_LIST);
+  createGradientButton(headerCard, layout.settingsButton, "Settings", LV_SYMBOL_SETTINGS, settingsButtonEvent);
+  // Airport info card
+  lv_obj_t *airportCard = createCard(uiElements.mainScreen, layout.airportCard);
+  uiElements.airportNameLabel = createStyledLabel(airportCard, 0, rowY(0), "Airport: --", LV_SYMBOL_HOME);
+#ifdef UI_SUBSET_FONTS
+  lv_obj_set_style_text_font(uiElements.airportNameLabel, &font_airport_14, LV_PART_MAIN);
+#endif
+  uiElements.dataAgeLabel = createStyledLabel(airportCard, layout.dataAge.x, layout.dataAge.y, "Data Age: -- min", LV_SYMBOL_REFRESH);
+  uiElements.flightCategoryLabel = createStyledLabel(airportCard, layout.flightCategory.x, layout.flightCategory.y, "--", nullptr);
+  // Weather data card - left side
+  lv_obj_t *weatherCard = createCard(uiElements.mainScreen, layout.weatherCard);
+  uiElements.conditionsLabel = createStyledLabel(weatherCard, 0, rowY(0), "Weather Data", LV_SYMBOL_EYE_OPEN);
+  themeAdd(uiElements.conditionsLabel, &theme.title, LV_PART_MAIN);
+  lv_obj_set_width(uiElements.conditionsLabel, lv_pct(100));
+  lv_label_set_long_mode(uiElements.conditionsLabel, LV_LABEL_LONG_DOT);
+  uiElements.temperatureLabel = createStyledLabel(weatherCard, 0, rowY(1), "Temperature: -- °C", LV_SYMBOL_BATTERY_3);
+  uiElements.humidityLabel = createStyledLabel(weatherCard, 0, rowY(2), "Humidity: -- %", LV_SYMBOL_TINT);
+  uiElements.windSpeedLabel = createStyledLabel(weatherCard, 0, rowY(3), "Wind Speed: -- km/h", LV_SYMBOL_GPS);
+  uiElements.pressureLabel = createStyledLabel(weatherCard, 0, rowY(4), "Pressure: -- hPa", LV_SYMBOL_POWER);
+  // Sun times card - right side
+  lv_obj_t *sunCard = createCard(uiElements.mainScreen, layout.sunCard);
+  lv_obj_t *sunTitle = createStyledLabel(sunCard, 0, rowY(0), "Sun Times", LV_SYMBOL_WIFI);
+  lv_obj_set_style_text_color(sunTitle, lv_color_hex(0xffa500), LV_PART_MAIN);
+  uiElements.sunriseLabel = createStyledLabel(sunCard, 0, rowY(1), "Sunrise: --", LV_SYMBOL_UP);
+  uiElements.sunsetLabel = createStyledLabel(sunCard, 0, rowY(2), "Sunset: --", LV_SYMBOL_DOWN);
+  uiElements.daylightLabel = createStyledLabel(sunCard, 0, rowY(3), "Daylight Info", nullptr);
+  themeAdd(uiElements.daylightLabel, &theme.muted, LV_PART_MAIN);
+  if (layout.forecast.x >= 0) {
+    uiElements.forecastLabel = createStyledLabel(sunCard, layout.forecast.x, layout.forecast.y, "No forecast", LV_SYMBOL_BELL);
+    lv_obj_set_width(uiElements.forecastLabel, lv_pct(100));
+    lv_label_set_long_mode(uiElements.forecastLabel, LV_LABEL_LONG_DOT);
+  }
+  // Big time date card
+  lv_obj_t *bigTimeDateCard = createCard(uiElements.mainScreen, layout.clockCard);
+  uiElements.bigTimeLabel = lv_label_create(bigTimeDateCard);
+  lv_obj_align(uiElements.bigTimeLabel, LV_ALIGN_TOP_LEFT, layout.bigTime.x, layout.bigTime.y);
+  themeAdd(uiElements.bigTimeLabel, &theme.bigLabel, LV_PART_MAIN);
+  lv_label_set_text(uiElements.bigTimeLabel, "--:--:--");
+  uiElements.bigDateLabel = lv_label_create(bigTimeDateCard);
+  lv_obj_align(uiElements.bigDateLabel, LV_ALIGN_TOP_LEFT, layout.bigDate.x, layout.bigDate.y);
+  themeAdd(uiElements.bigDateLabel, &theme.bigLabel, LV_PART_MAIN);
+  lv_label_set_text(uiElements.bigDateLabel, "--.--.----");
+  if (layout.bigDate.x < 0) lv_obj_add_flag(uiElements.bigDateLabel, LV_OBJ_FLAG_HIDDEN);  // The header shows the date
+  if (layout.trendChart.h > 0) createTrendChart(bigTimeDateCard);
+  // Status card
+  lv_obj_t *statusCard = createCard(uiElements.mainScreen, layout.statusCard);
+#ifdef PERF_TELEMETRY
+  uiElements.telemetryLabel = createStyledLabel(statusCard, layout.telemetry.x, layout.telemetry.y, "-- FPS", nullptr);
+  lv_obj_set_style_text_color(uiElements.telemetryLabel, lv_color_hex(0x00c853), LV_PART_MAIN);
+  bool showTitle = layout.telemetry.x != 0 || layout.telemetry.y != rowY(0);
+#else
+  bool showTitle = true;
+#endif
+  if (showTitle) {
+    lv_obj_t *statusLabel = createStyledLabel(statusCard, 0, rowY(0), "ESP32 METAR Weather Station", LV_SYMBOL_EYE_OPEN);
+    themeAdd(statusLabel, &theme.title, LV_PART_MAIN);
+  }
+  if (layout.versionX >= 0) {
+    lv_obj_t *versionLabel = createStyledLabel(statusCard, layout.versionX, rowY(0), "v1.0", nullptr);
+    themeAdd(versionLabel, &theme.muted, LV_PART_MAIN);
+  }
+}
+
+// Caption and text area of settings field n, in a grid of two columns or one column on small layouts
+static lv_obj_t *createFormField(lv_obj_t *parent, int n, const char *caption, bool passwordMode, lv_event_cb_t eventCb,
+                                 const char *initialText, const char *placeholder) {
+  int x = layout.formPitch.x ? (n % 2) * layout.formPitch.x : 0;
+  int y = rowY(0) + (layout.formPitch.x ? n / 2 : n) * layout.formPitch.y;
+  lv_obj_t *label = createStyledLabel(parent, x, y, caption);
+  themeAdd(label, &theme.formLabel, LV_PART_MAIN);
+  return createModernTextArea(parent, x, y + layout.captionHeight, layout.fieldSize.x, layout.fieldSize.y, true, passwordMode, eventCb,
+                              initialText, placeholder);
+}
+
+// Initialize settings screen, positions come from the layout profile of the board
+static void settingScreenInit(const UiSettings &settings, lv_event_cb_t saveEvent) {
+  uiElements.settingScreen = lv_obj_create(NULL);
+  lv_obj_remove_flag(uiElements.settingScreen, LV_OBJ_FLAG_SCROLLABLE);
+  themeAdd(uiElements.settingScreen, &theme.screen, LV_PART_MAIN);
+  // Setting Header card
+  lv_obj_t *headerCard = createCard(uiElements.settingScreen, layout.settingsHeaderCard);
+  lv_obj_t *title = createStyledLabel(headerCard, layout.settingsTitle.x, layout.settingsTitle.y, "Weather Station Settings", LV_SYMBOL_SETTINGS);
+  themeAdd(title, &theme.title, LV_PART_MAIN);
+  createGradientButton(headerCard, layout.saveButton, "Save", LV_SYMBOL_SAVE, saveEvent);
+  // Settings card
+  lv_obj_t *formCard = createCard(uiElements.settingScreen, layout.formCard);
+  uiElements.ssidTextArea = createFormField(formCard, 0, "WiFi Network (SSID):", false, ssidTextAreaEvent, settings.ssid, "Enter WiFi SSID");
+  uiElements.passwordTextArea = createFormField(formCard, 1, "WiFi Password:", true, passwordTextAreaEvent, settings.password, "Enter password");
+  uiElements.metarIdTextArea =
+      createFormField(formCard, 2, "METAR IDs (comma separated):", false, metarIdTextAreaEvent, settings.metarId, "e.g. KJFK,KLGA,KEWR");
+  char offsetBuf[12];
+  snprintf(offsetBuf, sizeof(offsetBuf), "%ld", settings.timeOffset);
+  uiElements.timeOffsetTextArea = createFormField(formCard, 3, "Time Offset (seconds):", false, timeOffsetTextAreaEvent, offsetBuf, "UTC offset");
+  // Help card
+  lv_obj_t *helpCard = createCard(uiElements.settingScreen, layout.helpCard);
+  lv_obj_t *helpTitle = createStyledLabel(helpCard, 0, rowY(0), "Help:", nullptr);
+  themeAdd(helpTitle, &theme.title, LV_PART_MAIN);
+  // Small layouts put a shorter hint in a second row
+  lv_obj_t *helpText;
+  if (layout.helpTextX >= 0)
+    helpText = createStyledLabel(helpCard, layout.helpTextX, rowY(0), "METAR ID: Find airport codes at wikipedia.org/wiki/ICAO_airport_code", nullptr);
+  else
+    helpText = createStyledLabel(helpCard, 0, rowY(1), "Find ICAO codes online", nullptr);
+  themeAdd(helpText, &theme.muted, LV_PART_MAIN);
+  // Keyboard - positioned better
+  uiElements.keyboard = lv_keyboard_create(uiElements.settingScreen);
+  lv_keyboard_set_textarea(uiElements.keyboard, uiElements.ssidTextArea);
+  lv_obj_add_flag(uiElements.keyboard, LV_OBJ_FLAG_HIDDEN);
+  lv_obj_set_style_text_color(uiElements.keyboard, lv_color_white(), LV_PART_MAIN);
+  lv_obj_set_style_bg_color(uiElements.keyboard, lv_color_hex(0x1a1a1a), LV_PART_MAIN);
+  lv_obj_add_event_cb(uiElements.keyboard, keyboardEvent, LV_EVENT_ALL, NULL);
+  // Position keyboard at bottom when visible
+  lv_obj_set_size(uiElements.keyboard, layout.keyboardSize.x, layout.keyboardSize.y);
+  lv_obj_align(uiElements.keyboard, LV_ALIGN_BOTTOM_MID, 0, -10);
+}
+
+#ifdef UI_STATIC_CARD_LAYERS
+// Cache the backgrounds of all cards of a finished screen. Every layer adds an image to the screen,
+// so the cards are collected before the first one is created.
+static void createCardLayers(lv_obj_t *screen) {
+  lv_obj_t *cards[16];
+  int count = 0;
+  lv_obj_update_layout(screen);
+  for (uint32_t i = 0; i < lv_obj_get_child_count(screen) && count < 16; i++) {
+    lv_obj_t *child = lv_obj_get_child(screen, i);
+    if (lv_obj_has_flag(child, LV_OBJ_FLAG_USER_1)) cards[count++] = child;
+  }
+  for (int i = 0; i < count; i++) cardLayerCreate(cards[i]);
+}
+#endif
+
+// Initialize UI with modern theme
+void uiInit(const UiSettings &settings, lv_event_cb_t saveEvent) {
+  lv_disp_t *display = lv_display_get_default();
+  lv_theme_t *defaultTheme =
+      lv_theme_default_init(display, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED), true, LV_FONT_DEFAULT);
+  lv_disp_set_theme(display, defaultTheme);
+  lv_display_add_event_cb(display, invalidateAreaEvent, LV_EVENT_INVALIDATE_AREA, NULL);
+  themeInit();
+
+  uint32_t heapUsed = lvglHeapUsed();
+  mainScreenInit();
+  uiBuildStats.mainScreenBytes = lvglHeapUsed() - heapUsed;
+  heapUsed = lvglHeapUsed();
+  settingScreenInit(settings, saveEvent);
+  uiBuildStats.settingScreenBytes = lvglHeapUsed() - heapUsed;
+#ifdef UI_STATIC_CARD_LAYERS
+  createCardLayers(uiElements.mainScreen);
+  createCardLayers(uiElements.settingScreen);
+#endif
+  lv_disp_load_scr(uiElements.mainScreen);
+}
@@ -0,0 +1,81 @@
+// Screens and widgets of the weather station.
+// Plain LVGL, nothing from Arduino, so the screens can also be built and driven off the device.
+#pragma once
+
+#include <lvgl.h>
+
+#include "history.h"
+
+// UI elements structure
+struct UiElements {
+  lv_obj_t *mainScreen;
+  lv_obj_t *mainPanel;
+  lv_obj_t *temperatureLabel;
+  lv_obj_t *humidityLabel;
+  lv_obj_t *windSpeedLabel;
+  lv_obj_t *pressureLabel;
+  lv_obj_t *timeDateLabel;
+  lv_obj_t *wifiStatusLabel;
+  lv_obj_t *airportNameLabel;
+  lv_obj_t *dataAgeLabel;
+  lv_obj_t *flightCategoryLabel;
+  lv_obj_t *conditionsLabel;  // Title of the weather card
+  lv_obj_t *sunriseLabel;
+  lv_obj_t *sunsetLabel;
+  lv_obj_t *daylightLabel;
+  lv_obj_t *forecastLabel;  // nullptr if the layout has none
+  lv_obj_t *bigTimeLabel;
+  lv_obj_t *bigDateLabel;
+  lv_obj_t *trendChart;  // nullptr if the layout has none
+  lv_chart_series_t *temperatureSeries;
+  lv_chart_series_t *dewPointSeries;
+  lv_chart_series_t *pressureSeries;
+  lv_obj_t *telemetryLabel;
+  lv_obj_t *settingScreen;
+  lv_obj_t *ssidTextArea;
+  lv_obj_t *passwordTextArea;
+  lv_obj_t *metarIdTextArea;
+  lv_obj_t *timeOffsetTextArea;
+  lv_obj_t *keyboard;
+};
+extern UiElements uiElements;
+
+// Redraw statistics, to see how much of the screen the label updates invalidate
+struct RedrawStats {
+  unsigned long invalidatedPixels = 0;  // Since the last one second sample
+  unsigned long pixelsPerSecondSum = 0;
+  unsigned long pixelsPerSecondMax = 0;
+  unsigned long samples = 0;
+  unsigned long labelUpdates = 0;
+  unsigned long labelUpdatesSkipped = 0;
+};
+extern RedrawStats redrawStats;
+
+// LVGL heap taken by building each screen, filled by uiInit()
+struct UiBuildStats {
+  uint32_t mainScreenBytes = 0;
+  uint32_t settingScreenBytes = 0;
+};
+extern UiBuildStats uiBuildStats;
+
+// Read the style properties a draw reads on every object of the screen, without drawing. Returns the number of
+// lookups, the caller times it: the style resolution of the screen on its own.
+uint32_t uiResolveStyles(lv_obj_t *screen);
+
+// Initial content of the settings form
+struct UiSettings {
+  const char *ssid;
+  const char *password;
+  const char *metarId;
+  long timeOffset;
+};
+
+// Update label text with formatted string, unchanged text does not touch the label
+void updateLabel(lv_obj_t *label, const char *format, ...);
+
+// Build both screens and show the main screen, saveEvent handles the Save button of the settings screen
+void uiInit(const UiSettings &settings, lv_event_cb_t saveEvent);
+
+// Point the trend chart at the history of the shown station, also after a report was added to it.
+// O(1), the chart draws the history arrays in place. Redraws the whole chart, only call it when something changed.
+void uiShowHistory(History &history);
@@ -0,0 +1,85 @@
+// Host benchmark helpers: a monotonic clock, a seeded random generator and a count of heap allocations.
+// Included by the test/bench_* suites, one translation unit each.
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static unsigned long benchAllocations = 0;
+
+#if defined(__SANITIZE_ADDRESS__)
+#define BENCH_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define BENCH_ASAN 1
+#endif
+#endif
+
+#if defined(__GLIBC__) && !defined(BENCH_ASAN)
+// Count every malloc behind the code under test, operator new ends up here as well.
+// AddressSanitizer brings its own malloc, the unit tests that only use the random generator run without the count.
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void *malloc(size_t size) {
+  benchAllocations++;
+  return __libc_malloc(size);
+}
+extern "C" void *calloc(size_t count, size_t size) {
+  benchAllocations++;
+  return __libc_calloc(count, size);
+}
+extern "C" void *realloc(void *ptr, size_t size) {
+  benchAllocations++;
+  return __libc_realloc(ptr, size);
+}
+#define BENCH_COUNTS_ALLOCATIONS 1
+#else
+#define BENCH_COUNTS_ALLOCATIONS 0
+#endif
+
+static uint64_t benchNowNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// xorshift32, the same inputs on every run
+struct BenchRandom {
+  uint32_t state = 2463534242u;
+  uint32_t next() {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+  // Uniform in [low, high)
+  long range(long low, long high) { return low + (long)(next() % (uint32_t)(high - low)); }
+  float uniform(float low, float high) { return low + (high - low) * (next() / 4294967296.0f); }
+};
+
+struct BenchResult {
+  double nsPerCall;
+  double allocationsPerCall;
+};
+
+// Time calls of body(i), i = 0..calls-1, and print one BENCH line. The body returns something derived from its
+// result, summed into the printed checksum so the work cannot be optimized away and runs can be compared.
+template <typename Body>
+static BenchResult benchRun(const char *name, unsigned long calls, Body body) {
+  unsigned long checksum = 0;
+  unsigned long allocations = benchAllocations;
+  uint64_t start = benchNowNs();
+  for (unsigned long i = 0; i < calls; i++) checksum += body(i);
+  uint64_t elapsed = benchNowNs() - start;
+  allocations = benchAllocations - allocations;
+  BenchResult result = {(double)elapsed / calls, (double)allocations / calls};
+  if (BENCH_COUNTS_ALLOCATIONS)
+    printf("BENCH,%s,%lu calls,%.1f ns/call,%.3f allocs/call,checksum %08lx\n", name, calls, result.nsPerCall,
+           result.allocationsPerCall, checksum & 0xffffffff);
+  else
+    printf("BENCH,%s,%lu calls,%.1f ns/call,checksum %08lx\n", name, calls, result.nsPerCall, checksum & 0xffffffff);
+  return result;
+}
@@ -0,0 +1,145 @@
+// Benchmark of the calc.h helpers the display calls on every refresh: ns per call, heap allocations per call and a
+// checksum of the results over large seeded random inputs. pio test -e native_bench -v
+#include <string.h>
+#include <unity.h>
+
+#include "../bench.h"
+#include "calc.h"
+
+#define POOL_SIZE 1024  // Distinct inputs, cycled through so the caches see more than one string
+#define EPOCH_2100 4102444800UL
+
+static char strings[POOL_SIZE][96];
+static char buffer[96];
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static unsigned long sumChars(const char *text) {
+  unsigned long sum = 0;
+  while (*text) sum = sum * 31 + (unsigned char)*text++;
+  return sum;
+}
+
+// Append one random character: ASCII, a Latin-1 or Latin Extended-A letter as UTF-8, or an invalid byte
+static char *appendRandomChar(char *out, BenchRandom &random) {
+  uint32_t pick = random.next() % 16;
+  if (pick < 10) {
+    *out++ = (char)random.range(0x20, 0x7f);
+  } else if (pick < 15) {
+    unsigned codepoint = (unsigned)random.range(0xA0, 0x180);
+    *out++ = (char)(0xC0 | codepoint >> 6);
+    *out++ = (char)(0x80 | (codepoint & 0x3F));
+  } else {
+    *out++ = (char)random.range(0x80, 0x100);
+  }
+  return out;
+}
+
+static void test_sun_event() {
+  BenchRandom random;
+  static unsigned long epochs[POOL_SIZE];
+  static float lats[POOL_SIZE], lons[POOL_SIZE];
+  for (int i = 0; i < POOL_SIZE; i++) {
+    epochs[i] = random.range(946684800, EPOCH_2100);
+    lats[i] = random.uniform(-80, 80);
+    lons[i] = random.uniform(-180, 180);
+  }
+  unsigned long bad = 0;
+  BenchResult result = benchRun("sunEvent", 200000, [&](unsigned long i) {
+    int n = i % POOL_SIZE;
+    sunEvent(epochs[n], lats[n], lons[n], i & 1, (long)(n % 27 - 13) * 3600, buffer, sizeof(buffer));
+    if (buffer[0] != 'N' && strlen(buffer) != 8) bad++;
+    return sumChars(buffer);
+  });
+  TEST_ASSERT_EQUAL(0, bad);
+  TEST_ASSERT_EQUAL(0, result.allocationsPerCall);
+}
+
+static void test_formatted_date() {
+  BenchRandom random;
+  unsigned long bad = 0;
+  BenchResult result = benchRun("getFormattedDate", 1000000, [&](unsigned long) {
+    getFormattedDate(random.range(0, EPOCH_2100), buffer, sizeof(buffer));
+    if (strlen(buffer) != 10) bad++;
+    return sumChars(buffer);
+  });
+  TEST_ASSERT_EQUAL(0, bad);
+  TEST_ASSERT_EQUAL(0, result.allocationsPerCall);
+}
+
+static void test_formatted_time() {
+  BenchRandom random;
+  unsigned long bad = 0;
+  BenchResult result = benchRun("getFormattedTime", 1000000, [&](unsigned long) {
+    getFormattedTime(random.range(0, EPOCH_2100), buffer, sizeof(buffer));
+    if (strlen(buffer) != 8) bad++;
+    return sumChars(buffer);
+  });
+  TEST_ASSERT_EQUAL(0, bad);
+  TEST_ASSERT_EQUAL(0, result.allocationsPerCall);
+}
+
+static void test_normalize_string() {
+  BenchRandom random;
+  for (int i = 0; i < POOL_SIZE; i++) {
+    char *out = strings[i];
+    for (int n = random.range(8, 40); n > 0; n--) out = appendRandomChar(out, random);
+    *out = '\0';
+  }
+  unsigned long bad = 0;
+  BenchResult result = benchRun("normalizeString", 1000000, [&](unsigned long i) {
+    const char *input = strings[i % POOL_SIZE];
+    strcpy(buffer, input);  // In-place, every call needs a fresh copy
+    normalizeString(buffer);
+    if (strlen(buffer) > strlen(input)) bad++;
+    return sumChars(buffer);
+  });
+  TEST_ASSERT_EQUAL(0, bad);
+  TEST_ASSERT_EQUAL(0, result.allocationsPerCall);
+}
+
+static void test_trim() {
+  BenchRandom random;
+  for (int i = 0; i < POOL_SIZE; i++) {
+    char *out = strings[i];
+    for (int n = random.range(0, 6); n > 0; n--) *out++ = " \t\r\n"[random.next() % 4];
+    for (int n = random.range(0, 40); n > 0; n--) *out++ = (char)random.range(0x21, 0x7f);
+    for (int n = random.range(0, 6); n > 0; n--) *out++ = " \t\r\n"[random.next() % 4];
+    *out = '\0';
+  }
+  unsigned long bad = 0;
+  BenchResult result = benchRun("trim", 1000000, [&](unsigned long i) {
+    strcpy(buffer, strings[i % POOL_SIZE]);
+    trim(buffer);
+    size_t len = strlen(buffer);
+    if (len && (buffer[0] <= ' ' || buffer[len - 1] <= ' ')) bad++;
+    return sumChars(buffer);
+  });
+  TEST_ASSERT_EQUAL(0, bad);
+  TEST_ASSERT_EQUAL(0, result.allocationsPerCall);
+}
+
+static void test_relative_humidity() {
+  BenchRandom random;
+  unsigned long bad = 0;
+  BenchResult result = benchRun("relativeHumidity", 1000000, [&](unsigned long) {
+    int temperature = random.range(-40, 50);
+    int humidity = relativeHumidity(temperature, temperature - random.range(0, 40));
+    if (humidity < 0 || humidity > 100) bad++;
+    return (unsigned long)humidity;
+  });
+  TEST_ASSERT_EQUAL(0, bad);
+  TEST_ASSERT_EQUAL(0, result.allocationsPerCall);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_sun_event);
+  RUN_TEST(test_formatted_date);
+  RUN_TEST(test_formatted_time);
+  RUN_TEST(test_normalize_string);
+  RUN_TEST(test_trim);
+  RUN_TEST(test_relative_humidity);
+  return UNITY_END();
+}
@@ -0,0 +1,186 @@
+// normalizeString against the implementation it replaced (58 strncmp per byte, a memmove per replacement) on airport
+// names as aviationweather.gov returns them. pio test -e native_bench -v
+#include <string.h>
+#include <unity.h>
+
+#include "../bench.h"
+#include "calc.h"
+
+static const char *AIRPORTS[] = {
+    "Munich/Franz Josef Strauß Intl, BY, DE",
+    "Zürich Arpt, ZH, CH",
+    "Genève Arpt, GE, CH",
+    "Düsseldorf Intl, NW, DE",
+    "Köln/Bonn Arpt, NW, DE",
+    "Nürnberg Arpt, BY, DE",
+    "Saarbrücken Arpt, SL, DE",
+    "Münster/Osnabrück Intl, NW, DE",
+    "Salzburg/W. A. Mozart Arpt, 5, AT",
+    "Paris/Charles de Gaulle Arpt, IF, FR",
+    "Nîmes/Garons Arpt, OC, FR",
+    "Besançon/La Vèze Arpt, BF, FR",
+    "Béziers/Cap d'Agde Arpt, OC, FR",
+    "Pointe-à-Pitre/Le Raizet Intl, GP, GP",
+    "Málaga/Costa del Sol Arpt, AN, ES",
+    "A Coruña Arpt, GA, ES",
+    "Alicante-Elche Miguel Hernández Arpt, VC, ES",
+    "Logroño-Agoncillo Arpt, RI, ES",
+    "São Paulo/Guarulhos Intl, SP, BR",
+    "Brasília Intl, DF, BR",
+    "Florianópolis/Hercílio Luz Intl, SC, BR",
+    "Belém/Val de Cans Intl, PA, BR",
+    "Goiânia/Santa Genoveva Arpt, GO, BR",
+    "Bogotá/El Dorado Intl, DC, CO",
+    "Asunción/Silvio Pettirossi Intl, 11, PY",
+    "Mérida Intl, YUC, MX",
+    "Cancún Intl, ROO, MX",
+    "Querétaro Intl, QUE, MX",
+    "Montréal/Pierre Elliott Trudeau Intl, QC, CA",
+    "Québec/Jean Lesage Intl, QC, CA",
+    "Reykjavík Arpt, 1, IS",
+    "Akureyri Arpt, 6, IS",
+    "Egilsstaðir Arpt, 7, IS",
+    "Tórshavn/Vágar Arpt, VG, FO",
+    "København/Kastrup Arpt, 84, DK",
+    "Aalborg Arpt, 81, DK",
+    "Göteborg/Landvetter Arpt, O, SE",
+    "Malmö Arpt, M, SE",
+    "Luleå/Kallax Arpt, BD, SE",
+    "Ängelholm-Helsingborg Arpt, M, SE",
+    "Bodø Arpt, 18, NO",
+    "Tromsø/Langnes Arpt, 54, NO",
+    "Ålesund/Vigra Arpt, 15, NO",
+    "Helsinki-Vantaa Arpt, 18, FI",
+    "Jyväskylä Arpt, 08, FI",
+    "Kraków/Balice Intl, MA, PL",
+    "Gdańsk/Lech Wałęsa Arpt, PM, PL",
+    "Łódź/Władysław Reymont Arpt, LD, PL",
+    "Poznań-Ławica Arpt, WP, PL",
+    "Wrocław/Copernicus Arpt, DS, PL",
+    "Praha/Václav Havel Arpt, 10, CZ",
+    "Brno/Tuřany Arpt, 64, CZ",
+    "Ostrava/Leoš Janáček Arpt, 80, CZ",
+    "Košice Intl, KI, SK",
+    "Budapest/Liszt Ferenc Intl, BU, HU",
+    "Debrecen Intl, HB, HU",
+    "Zagreb/Franjo Tuđman Intl, 21, HR",
+    "Split/Resnik Arpt, 17, HR",
+    "Niš/Konstantin Veliki Arpt, 20, RS",
+    "Ljubljana/Jože Pučnik Arpt, 061, SI",
+    "București/Henri Coandă Intl, B, RO",
+    "Timișoara/Traian Vuia Intl, TM, RO",
+    "İstanbul Arpt, 34, TR",
+    "Şanlıurfa/GAP Arpt, 63, TR",
+    "Tivat Arpt, 19, ME",
+    "Vilnius Intl, VL, LT",
+    "Rīga Intl, RIX, LV",
+    "Tallinn/Lennart Meri Arpt, 37, EE",
+    "Lisboa/Humberto Delgado Arpt, 11, PT",
+    "Ponta Delgada/João Paulo II Arpt, 20, PT",
+    "Faro Arpt, 08, PT",
+    "Roma/Fiumicino Arpt, 62, IT",
+    "Forlì Arpt, 45, IT",
+    "Dubai Intl, DU, AE",
+    "Frankfurt/Main Intl, HE, DE",
+    "London/Heathrow Arpt, ENG, GB",
+    "Chicago/O'Hare Intl, IL, US",
+    "Auckland Intl, AUK, NZ",
+    "Côte d'Ivoire/Félix Houphouët-Boigny Intl, AB, CI",
+    "Curaçao/Hato Intl, CW, CW",
+};
+
+#define AIRPORT_COUNT (int)(sizeof(AIRPORTS) / sizeof(AIRPORTS[0]))
+#define CALLS 1000000
+
+static char buffer[128];
+
+// The implementation before the single pass transliteration, kept verbatim as the baseline
+static char *normalizeStringOld(char *str) {
+  static const char *rep[][2] = {
+    {"á","a"},{"à","a"},{"â","a"},{"ã","a"},{"ä","a"},{"æ","a"},{"Á","A"},{"À","A"},
+    {"Â","A"},{"Ã","A"},{"Ä","A"},{"Æ","A"},
+    {"é","e"},{"è","e"},{"ê","e"},{"ë","e"},{"É","E"},{"È","E"},{"Ê","E"},{"Ë","E"},
+    {"í","i"},{"ì","i"},{"î","i"},{"ï","i"},{"Í","I"},{"Ì","I"},{"Î","I"},{"Ï","I"},
+    {"ó","o"},{"ò","o"},{"ô","o"},{"õ","o"},{"ö","o"},{"œ","o"},{"Ó","O"},{"Ò","O"},
+    {"Ô","O"},{"Õ","O"},{"Ö","O"},{"Œ","O"},
+    {"ú","u"},{"ù","u"},{"û","u"},{"ü","u"},{"Ú","U"},{"Ù","U"},{"Û","U"},{"Ü","U"},
+    {"ñ","n"},{"Ñ","N"},{"ç","c"},{"Ç","C"},{"ÿ","y"},{"Ÿ","Y"},{"ß","s"},{"ẞ","S"}
+  };
+  for (char* p = str; *p;) {
+    int replaced = 0;
+    for (size_t i = 0; i < sizeof(rep) / sizeof(rep[0]); i++) {
+      size_t l = strlen(rep[i][0]);
+      if (!strncmp(p, rep[i][0], l)) {
+        *p = *rep[i][1];
+        memmove(p + 1, p + l, strlen(p + l) + 1);
+        replaced = 1;
+        break;
+      }
+    }
+    if (!replaced)
+      p++;
+  }
+  return str;
+}
+
+static bool isAscii(const char *text) {
+  for (; *text; text++)
+    if ((unsigned char)*text >= 0x80) return false;
+  return true;
+}
+
+static unsigned long sumChars(const char *text) {
+  unsigned long sum = 0;
+  while (*text) sum = sum * 31 + (unsigned char)*text++;
+  return sum;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_new_is_faster() {
+  BenchResult old = benchRun("normalizeString old", CALLS, [](unsigned long i) {
+    strcpy(buffer, AIRPORTS[i % AIRPORT_COUNT]);
+    return sumChars(normalizeStringOld(buffer));
+  });
+  BenchResult current = benchRun("normalizeString", CALLS, [](unsigned long i) {
+    strcpy(buffer, AIRPORTS[i % AIRPORT_COUNT]);
+    return sumChars(normalizeString(buffer));
+  });
+  printf("Speedup %.1fx on %d airport names\n", old.nsPerCall / current.nsPerCall, AIRPORT_COUNT);
+  TEST_ASSERT_EQUAL(0, current.allocationsPerCall);
+  TEST_ASSERT_TRUE(current.nsPerCall < old.nsPerCall);
+}
+
+// Every name comes out as ASCII, the old table left the letters it did not know
+static void test_results() {
+  int oldNonAscii = 0, nonAscii = 0, differ = 0;
+  for (int i = 0; i < AIRPORT_COUNT; i++) {
+    char old[128];
+    strcpy(old, AIRPORTS[i]);
+    normalizeStringOld(old);
+    strcpy(buffer, AIRPORTS[i]);
+    normalizeString(buffer);
+    if (!isAscii(old)) oldNonAscii++;
+    if (!isAscii(buffer)) {
+      nonAscii++;
+      printf("Not ASCII: %s\n", buffer);
+    }
+    // Where the old table knew every letter both agree, apart from the ligatures that now keep both letters
+    if (isAscii(old) && strcmp(old, buffer) != 0 && !strstr(AIRPORTS[i], "ß")) {
+      differ++;
+      printf("Differs: '%s' old '%s'\n", buffer, old);
+    }
+  }
+  printf("%d of %d names left with non-ASCII characters by the old implementation, %d by the new one\n", oldNonAscii,
+         AIRPORT_COUNT, nonAscii);
+  TEST_ASSERT_EQUAL(0, nonAscii);
+  TEST_ASSERT_EQUAL(0, differ);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_new_is_faster);
+  RUN_TEST(test_results);
+  return UNITY_END();
+}
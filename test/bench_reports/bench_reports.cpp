@@ -0,0 +1,77 @@
+// Throughput of the METAR and TAF decoders on the reports of ../reports.h: ns per report or response, heap
+// allocations per call and MB/s of report text. pio test -e native_bench -v
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+#include "../bench.h"
+#include "../reports.h"
+#include "metar.h"
+#include "taf.h"
+
+#define METAR_COUNT (sizeof(metarReports) / sizeof(metarReports[0]))
+
+static Forecast forecasts[8];
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void printThroughput(const char *name, const BenchResult &result, double bytesPerCall) {
+  printf("BENCH,%s,%.1f MB/s\n", name, bytesPerCall / result.nsPerCall * 1000);
+}
+
+static void test_decode_metar() {
+  size_t bytes = 0;
+  for (size_t i = 0; i < METAR_COUNT; i++) bytes += strlen(metarReports[i]);
+  BenchResult result = benchRun("decodeMetar", 1000000, [&](unsigned long i) {
+    MetarObservation obs;
+    decodeMetar(metarReports[i % METAR_COUNT], obs);
+    return (unsigned long)obs.category + obs.visibilityM + obs.cloudCount;
+  });
+  printThroughput("decodeMetar", result, (double)bytes / METAR_COUNT);
+  TEST_ASSERT_EQUAL(0, result.allocationsPerCall);
+}
+
+static void test_format_conditions() {
+  static MetarObservation observations[METAR_COUNT];
+  for (size_t i = 0; i < METAR_COUNT; i++) decodeMetar(metarReports[i], observations[i]);
+  char text[48];
+  BenchResult result = benchRun("formatMetarConditions", 1000000, [&](unsigned long i) {
+    formatMetarConditions(observations[i % METAR_COUNT], text, sizeof(text));
+    return (unsigned long)strlen(text);
+  });
+  TEST_ASSERT_EQUAL(0, result.allocationsPerCall);
+}
+
+static Forecast *lookupForecast(const char *icaoId, void *context) {
+  unsigned *next = (unsigned *)context;
+  return &forecasts[(*next)++ % 8];
+}
+
+// The whole response in chunks of the given size, like the reads of the HTTP stream
+static BenchResult benchTaf(const char *name, size_t chunk) {
+  size_t len = sizeof(tafResponse) - 1;
+  BenchResult result = benchRun(name, 20000, [&](unsigned long i) {
+    unsigned next = 0;
+    TafDecoder decoder;
+    tafDecoderBegin(decoder, lookupForecast, &next, REPORTS_UTC);
+    for (size_t offset = 0; offset < len; offset += chunk) tafDecoderFeed(decoder, tafResponse + offset, offset + chunk < len ? chunk : len - offset);
+    tafDecoderEnd(decoder);
+    return decoder.reports + forecasts[0].periodCount;
+  });
+  printThroughput(name, result, len);
+  return result;
+}
+
+static void test_taf_decoder() {
+  TEST_ASSERT_EQUAL(0, benchTaf("tafDecoderFeed 512 B chunks", 512).allocationsPerCall);
+  TEST_ASSERT_EQUAL(0, benchTaf("tafDecoderFeed 1 B chunks", 1).allocationsPerCall);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_decode_metar);
+  RUN_TEST(test_format_conditions);
+  RUN_TEST(test_taf_decoder);
+  return UNITY_END();
+}
@@ -0,0 +1,51 @@
+// Raw METAR and TAF reports as aviationweather.gov sends them, the seed corpus of the decoder tests and benchmarks.
+// Chosen for the groups they exercise: split visibility, RVR, CAVOK, vertical visibility, CB/TCU, NSW, PROB TEMPO,
+// amendments, NIL and a cancelled forecast.
+#pragma once
+
+static const char *const metarReports[] = {
+    "METAR EDDM 101220Z 25008KT 220V290 9999 FEW040 BKN250 22/11 Q1015 NOSIG",
+    "METAR KJFK 101251Z 18012G22KT 10SM FEW045 SCT250 24/14 A2998 RMK AO2 SLP152 T02440139",
+    "SPECI KSFO 101312Z 28015KT 1 1/2SM BR OVC004 13/12 A2994 RMK AO2",
+    "METAR EGLL 101220Z AUTO 24015G28KT 200V270 4000 -SHRA BKN012CB OVC020 14/12 Q1003 TEMPO 3000 SHRA",
+    "METAR LSZH 101220Z VRB03KT CAVOK 25/09 Q1019 NOSIG",
+    "METAR EHAM 101225Z 21018KT 0800 R18R/1200N R27/P2000 FG VV002 09/09 Q1011 BECMG 2000",
+    "METAR KDEN 101253Z 00000KT 1/4SM +TSRAGR FG BKN008 OVC020TCU 12/11 A3012 RMK AO2 TSB35",
+    "METAR UUEE 101230Z 34004MPS 9999 SCT030 M05/M11 Q1025 R06C/290050 NOSIG",
+    "METAR RJTT 101230Z 03012KT 9999 -RA FEW008 BKN015 OVC030 20/18 Q1008 NOSIG",
+    "METAR YSSY 101230Z 16020G35KT 9999 VCSH SCT025 SCT040 17/10 Q1018",
+    "METAR KORD 101251Z 31009KT 2 1/2SM -SN BR SCT006 OVC011 M02/M03 A3001 RMK AO2",
+    "METAR EDDF 101220Z /////KT //// // ////// ///// Q////",
+    "METAR LFPG 101230Z 27010KT 9999 NSC 18/08 Q1020 NOSIG=",
+    "METAR CYYZ 101300Z 09008KT 15SM -DZ VV/// 05/04 A2987",
+};
+
+// One response of the TAF API for several stations, reports separated by blank lines
+static const char tafResponse[] =
+    "TAF EDDM 101100Z 1012/1118 24010KT 9999 FEW040\n"
+    "      BECMG 1016/1018 27015G25KT\n"
+    "      PROB30 TEMPO 1014/1019 4000 TSRA BKN030CB\n"
+    "      FM110200 VRB03KT 3000 BR BKN008\n"
+    "      BECMG 1106/1108 9999 NSW SCT030=\n"
+    "\n"
+    "TAF AMD KJFK 101320Z 1014/1118 18012KT P6SM FEW045 SCT250\n"
+    "  FM101900 20015G25KT P6SM SCT035 BKN250\n"
+    "  FM110300 22008KT 3SM BR OVC008\n"
+    "  TEMPO 1106/1110 1 1/2SM -RA OVC004\n"
+    "  FM111400 27010KT P6SM SKC\n"
+    "\n"
+    "TAF EGLL 101058Z 1012/1118 24015KT 9999 BKN025\n"
+    "  TEMPO 1012/1018 24020G32KT 6000 -SHRA BKN014\n"
+    "  PROB40 1102/1106 BKN008 RMK NXT FCST BY 101500Z\n"
+    "\n"
+    "TAF LSZH 101100Z 1012/1118 VRB03KT CAVOK TX26/1014Z TN12/1104Z\n"
+    "\n"
+    "TAF EHAM 101100Z NIL=\n"
+    "\n"
+    "TAF AMD EDDF 101130Z 1012/1118 CNL=\n"
+    "\n"
+    "TAF KDEN 101120Z 1012/1118 00000KT P6SM SCT080 FM101900 32012G20KT 3SM TSRA BKN050CB FM110100 VRB05KT P6SM "
+    "BKN100 TEMPO 1102/1106 1/2SM FG VV002 FM110900 02008KT P6SM SKC FM111500 04010KT P6SM FEW150\n";
+
+// Reference time of the reports above, 2024-06-10 13:00 UTC
+#define REPORTS_UTC 1718024400UL
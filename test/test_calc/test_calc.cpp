@@ -0,0 +1,127 @@
+// Date and time helpers against gmtime() of the C library, every day from 1970 to 2100
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unity.h>
+
+#include "../bench.h"
+#include "calc.h"
+
+#define FIRST_DAY 0L      // 1970-01-01
+#define LAST_DAY 47846L   // 2100-12-31
+
+static struct tm utc(unsigned long epoch) {
+  time_t t = (time_t)epoch;
+  struct tm tm;
+  gmtime_r(&t, &tm);
+  return tm;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_civil_days_match_gmtime() {
+  int wrong = 0;
+  for (long day = FIRST_DAY; day <= LAST_DAY; day++) {
+    struct tm tm = utc(day * 86400UL);
+    int year;
+    unsigned month, dayOfMonth;
+    civilFromDays(day, year, month, dayOfMonth);
+    if (year != tm.tm_year + 1900 || (int)month != tm.tm_mon + 1 || (int)dayOfMonth != tm.tm_mday) wrong++;
+    if (daysFromCivil(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday) != day) wrong++;
+  }
+  struct tm last = utc(LAST_DAY * 86400UL);
+  TEST_ASSERT_EQUAL(2100 - 1900, last.tm_year);
+  TEST_ASSERT_EQUAL(11, last.tm_mon);
+  TEST_ASSERT_EQUAL(31, last.tm_mday);
+  TEST_ASSERT_EQUAL(0, wrong);
+}
+
+static void test_formatted_date_and_time_match_gmtime() {
+  BenchRandom random;
+  int wrong = 0;
+  for (int i = 0; i < 200000; i++) {
+    unsigned long epoch = random.range(0, (LAST_DAY + 1) * 86400L);
+    struct tm tm = utc(epoch);
+    char expected[16], buffer[16];
+    strftime(expected, sizeof(expected), "%d.%m.%Y", &tm);
+    getFormattedDate(epoch, buffer, sizeof(buffer));
+    if (strcmp(expected, buffer) != 0) wrong++;
+    strftime(expected, sizeof(expected), "%H:%M:%S", &tm);
+    getFormattedTime(epoch, buffer, sizeof(buffer));
+    if (strcmp(expected, buffer) != 0) wrong++;
+  }
+  TEST_ASSERT_EQUAL(0, wrong);
+}
+
+// Compare the clock text with gmtime() and check that exactly the rewritten fields are flagged
+static int checkClock(ClockText &clock, unsigned long epoch) {
+  ClockText before = clock;
+  int changed = updateClockText(clock, epoch);
+  struct tm tm = utc(epoch);
+  char time[9], date[11];
+  strftime(time, sizeof(time), "%H:%M:%S", &tm);
+  strftime(date, sizeof(date), "%d.%m.%Y", &tm);
+  int wrong = 0;
+  if (strcmp(time, clock.time) != 0 || strcmp(date, clock.date) != 0) wrong++;
+  if (strcmp(before.date, clock.date) != 0 && !(changed & CLOCK_DATE_CHANGED)) wrong++;
+  if (strncmp(before.time, clock.time, 5) != 0 && !(changed & CLOCK_MINUTE_CHANGED)) wrong++;
+  if (strcmp(before.time, clock.time) != 0 && !(changed & CLOCK_SECOND_CHANGED)) wrong++;
+  return wrong;
+}
+
+// A running clock over every day boundary from 1970 to 2100, leap days and the turn of the century included
+static void test_clock_text_over_day_boundaries() {
+  ClockText clock;
+  int wrong = 0;
+  for (long day = FIRST_DAY + 1; day <= LAST_DAY; day++)
+    for (unsigned long epoch = day * 86400UL - 61; epoch <= day * 86400UL + 61; epoch++) wrong += checkClock(clock, epoch);
+  TEST_ASSERT_EQUAL(0, wrong);
+}
+
+// Jumps after an NTP sync or a new time offset, forward and back
+static void test_clock_text_after_jumps() {
+  BenchRandom random;
+  ClockText clock;
+  int wrong = 0;
+  unsigned long epoch = 0;
+  for (int i = 0; i < 200000; i++) {
+    uint32_t pick = random.next() % 4;
+    if (pick == 0)
+      epoch = random.range(0, (LAST_DAY + 1) * 86400L);
+    else if (pick == 1 && epoch >= 3600)
+      epoch -= random.range(1, 3600);
+    else
+      epoch += random.range(1, 120);
+    wrong += checkClock(clock, epoch);
+  }
+  TEST_ASSERT_EQUAL(0, wrong);
+}
+
+static void test_parse_iso_utc_matches_timegm() {
+  BenchRandom random;
+  int wrong = 0;
+  for (int i = 0; i < 100000; i++) {
+    unsigned long expected = random.range(0, (LAST_DAY + 1) * 86400L);
+    struct tm tm = utc(expected);
+    char text[32];
+    strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%SZ", &tm);
+    unsigned long epoch = 0;
+    if (!parseIsoUtc(text, epoch) || epoch != expected) wrong++;
+  }
+  TEST_ASSERT_EQUAL(0, wrong);
+  unsigned long epoch;
+  TEST_ASSERT_FALSE(parseIsoUtc("1969-12-31T23:59:59Z", epoch));
+  TEST_ASSERT_FALSE(parseIsoUtc("2024-13-01T00:00:00Z", epoch));
+  TEST_ASSERT_FALSE(parseIsoUtc(nullptr, epoch));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_civil_days_match_gmtime);
+  RUN_TEST(test_formatted_date_and_time_match_gmtime);
+  RUN_TEST(test_clock_text_over_day_boundaries);
+  RUN_TEST(test_clock_text_after_jumps);
+  RUN_TEST(test_parse_iso_utc_matches_timegm);
+  return UNITY_END();
+}
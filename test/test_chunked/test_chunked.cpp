@@ -0,0 +1,105 @@
+// Chunked transfer coding: bodies of several chunks with extensions and trailers decode the same at any split
+// into reads, broken framing ends in an error instead of reading on into the next response
+#include <string.h>
+#include <unity.h>
+
+#include "chunked.h"
+
+// The METAR JSON as aviationweather.gov sends it over HTTP/1.1, with the next response behind it on the connection
+static const char body[] =
+    "1a\r\n[{\"icaoId\":\"EDDM\",\"temp\":2\r\n"
+    "D;name=value\r\n2,\"dewp\":11}]\r\n"
+    "0\r\n"
+    "X-Trailer: yes\r\n"
+    "\r\n"
+    "HTTP/1.1 200 OK\r\n";
+static const char decoded[] = "[{\"icaoId\":\"EDDM\",\"temp\":22,\"dewp\":11}]";
+
+static char output[256];
+
+// Decode from the start of input, returns the bytes consumed up to the end of the body or the error
+static size_t decode(ChunkedDecoder &decoder, const char *input, size_t len, size_t &outputLen) {
+  size_t i = 0;
+  outputLen = 0;
+  for (; i < len && decoder.state != CHUNKED_DONE && decoder.state != CHUNKED_ERROR; i++) {
+    if (decoder.state == CHUNKED_DATA) {
+      output[outputLen++] = input[i];
+      chunkedData(decoder);
+    } else {
+      chunkedFrame(decoder, input[i]);
+    }
+  }
+  output[outputLen] = '\0';
+  return i;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_body_is_decoded() {
+  ChunkedDecoder decoder;
+  size_t outputLen;
+  size_t used = decode(decoder, body, sizeof(body) - 1, outputLen);
+  TEST_ASSERT_EQUAL(CHUNKED_DONE, decoder.state);
+  TEST_ASSERT_EQUAL_STRING(decoded, output);
+  TEST_ASSERT_EQUAL_STRING("HTTP/1.1 200 OK\r\n", body + used);  // Nothing of the next response was read
+}
+
+// Byte by byte through one decoder, as the reads of the socket come in, same result wherever they are split
+static void test_split_reads_decode_the_same() {
+  int wrong = 0;
+  for (size_t split = 0; split < sizeof(body) - 1; split++) {
+    ChunkedDecoder decoder;
+    size_t firstLen, secondLen;
+    size_t used = decode(decoder, body, split, firstLen);
+    char first[256];
+    memcpy(first, output, firstLen + 1);
+    used += decode(decoder, body + used, sizeof(body) - 1 - used, secondLen);
+    if (decoder.state != CHUNKED_DONE || firstLen + secondLen != strlen(decoded) || strncmp(first, decoded, firstLen) != 0 ||
+        strcmp(output, decoded + firstLen) != 0 || used != sizeof(body) - 1 - strlen("HTTP/1.1 200 OK\r\n"))
+      wrong++;
+  }
+  TEST_ASSERT_EQUAL(0, wrong);
+}
+
+static void test_empty_body() {
+  ChunkedDecoder decoder;
+  size_t outputLen;
+  decode(decoder, "0\r\n\r\n", 5, outputLen);
+  TEST_ASSERT_EQUAL(CHUNKED_DONE, decoder.state);
+  TEST_ASSERT_EQUAL(0, outputLen);
+}
+
+static void test_broken_framing_is_an_error() {
+  static const char *broken[] = {
+      "\r\n",                       // No size
+      "x\r\n",                      // Not hex
+      "3\r\nabcX\r\n0\r\n\r\n",     // Data longer than the size
+      "123456789\r\n",              // Chunk beyond 256 MB
+      ";ext\r\n",                   // Extension without a size
+  };
+  for (size_t i = 0; i < sizeof(broken) / sizeof(broken[0]); i++) {
+    ChunkedDecoder decoder;
+    size_t outputLen;
+    decode(decoder, broken[i], strlen(broken[i]), outputLen);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(CHUNKED_ERROR, decoder.state, broken[i]);
+  }
+}
+
+// An incomplete body is neither done nor an error, the reader waits for more
+static void test_truncated_body_waits() {
+  ChunkedDecoder decoder;
+  size_t outputLen;
+  decode(decoder, body, 40, outputLen);
+  TEST_ASSERT_TRUE(decoder.state != CHUNKED_DONE && decoder.state != CHUNKED_ERROR);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_body_is_decoded);
+  RUN_TEST(test_split_reads_decode_the_same);
+  RUN_TEST(test_empty_body);
+  RUN_TEST(test_broken_framing_is_an_error);
+  RUN_TEST(test_truncated_body_waits);
+  return UNITY_END();
+}
@@ -0,0 +1,153 @@
+// Settings record: what configRecordCheck() makes of records read back from flash (missing, truncated, from another
+// firmware, with flipped bits) and the migration of the one-key-per-setting layout of older firmware
+#include <stddef.h>
+#include <string.h>
+#include <unity.h>
+
+#include "config_record.h"
+
+// CRC-32 of zlib, written out here to seal records of another version
+static uint32_t zlibCrc32(const void *data, size_t len) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint32_t crc = 0xffffffff;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= bytes[i];
+    for (int bit = 0; bit < 8; bit++) crc = crc & 1 ? (crc >> 1) ^ 0xedb88320 : crc >> 1;
+  }
+  return ~crc;
+}
+
+static ConfigRecord sealedRecord() {
+  ConfigRecord record;
+  strcpy(record.ssid, "Hangar WLAN");
+  strcpy(record.password, "secret");
+  strcpy(record.metarId, "EDDM,EDDF,LSZH");
+  record.timeOffset = 7200;
+  record.writeCount = 12;
+  configRecordSeal(record);
+  return record;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_sealed_record_is_ok() {
+  TEST_ASSERT_EQUAL_HEX32(0xcbf43926, zlibCrc32("123456789", 9));  // Check value of CRC-32/ISO-HDLC
+  ConfigRecord record = sealedRecord();
+  TEST_ASSERT_EQUAL_HEX32(zlibCrc32(&record, offsetof(ConfigRecord, crc)), record.crc);
+  TEST_ASSERT_EQUAL(CONFIG_RECORD_OK, configRecordCheck(record, sizeof(record)));
+  TEST_ASSERT_EQUAL_STRING("ok", configRecordStatusName(configRecordCheck(record, sizeof(record))));
+}
+
+static void test_nothing_read_is_missing() {
+  ConfigRecord record;
+  TEST_ASSERT_EQUAL(CONFIG_RECORD_MISSING, configRecordCheck(record, 0));
+}
+
+// A record of another layout has another size, it is not read as this one
+static void test_bad_size() {
+  ConfigRecord record = sealedRecord();
+  TEST_ASSERT_EQUAL(CONFIG_RECORD_BAD_SIZE, configRecordCheck(record, sizeof(record) - 4));
+  TEST_ASSERT_EQUAL(CONFIG_RECORD_BAD_SIZE, configRecordCheck(record, 1));
+  TEST_ASSERT_EQUAL_STRING("bad size", configRecordStatusName(CONFIG_RECORD_BAD_SIZE));
+}
+
+// Any flipped bit before the CRC, and in the CRC itself, is caught
+static void test_bad_crc() {
+  ConfigRecord record = sealedRecord();
+  uint8_t *bytes = (uint8_t *)&record;
+  int missed = 0;
+  for (size_t i = 0; i < sizeof(record); i++) {
+    for (int bit = 0; bit < 8; bit++) {
+      bytes[i] ^= 1 << bit;
+      ConfigRecordStatus status = configRecordCheck(record, sizeof(record));
+      if (status != CONFIG_RECORD_BAD_CRC && !(i == 0 && status == CONFIG_RECORD_BAD_VERSION)) missed++;
+      bytes[i] ^= 1 << bit;
+    }
+  }
+  TEST_ASSERT_EQUAL(0, missed);
+  TEST_ASSERT_EQUAL(CONFIG_RECORD_OK, configRecordCheck(record, sizeof(record)));
+}
+
+// A record of another firmware version with an intact CRC is recognized by its version
+static void test_bad_version() {
+  ConfigRecord record = sealedRecord();
+  record.version = CONFIG_RECORD_VERSION + 1;
+  record.crc = zlibCrc32(&record, offsetof(ConfigRecord, crc));
+  TEST_ASSERT_EQUAL(CONFIG_RECORD_BAD_VERSION, configRecordCheck(record, sizeof(record)));
+  TEST_ASSERT_EQUAL_STRING("bad version", configRecordStatusName(CONFIG_RECORD_BAD_VERSION));
+}
+
+// Same settings whatever the counter and the CRC, any changed setting differs
+static void test_same_settings() {
+  ConfigRecord a = sealedRecord();
+  ConfigRecord b = a;
+  b.writeCount = 13;
+  configRecordSeal(b);
+  TEST_ASSERT_TRUE(configRecordSameSettings(a, b));
+  b.timeOffset = 3600;
+  TEST_ASSERT_FALSE(configRecordSameSettings(a, b));
+  b = a;
+  b.metarId[0] = 'K';
+  TEST_ASSERT_FALSE(configRecordSameSettings(a, b));
+  b = a;
+  b.spare[10] = 1;
+  TEST_ASSERT_FALSE(configRecordSameSettings(a, b));
+}
+
+// The old keys become the settings of the record, which then seals to a valid record
+static void test_migrate_keys() {
+  ConfigKeys keys;
+  keys.present = true;
+  strcpy(keys.ssid, "Tower");
+  strcpy(keys.password, "pw");
+  strcpy(keys.metarId, "KJFK,KDEN");
+  keys.timeOffset = -14400;
+  ConfigRecord record;
+  record.writeCount = 3;  // Left from an earlier record, the counter goes on
+  TEST_ASSERT_TRUE(configRecordMigrate(record, keys));
+  TEST_ASSERT_EQUAL_STRING("Tower", record.ssid);
+  TEST_ASSERT_EQUAL_STRING("pw", record.password);
+  TEST_ASSERT_EQUAL_STRING("KJFK,KDEN", record.metarId);
+  TEST_ASSERT_EQUAL(-14400, record.timeOffset);
+  TEST_ASSERT_EQUAL(3, record.writeCount);
+  configRecordSeal(record);
+  TEST_ASSERT_EQUAL(CONFIG_RECORD_OK, configRecordCheck(record, sizeof(record)));
+}
+
+// Without keys nothing is migrated and the record stays as it was
+static void test_migrate_without_keys() {
+  ConfigKeys keys;
+  ConfigRecord record = sealedRecord();
+  ConfigRecord before = record;
+  TEST_ASSERT_FALSE(configRecordMigrate(record, keys));
+  TEST_ASSERT_EQUAL_MEMORY(&before, &record, sizeof(record));
+}
+
+// Keys filling their buffers without a terminator still give terminated strings
+static void test_migrate_unterminated_keys() {
+  ConfigKeys keys;
+  keys.present = true;
+  memset(keys.ssid, 'S', sizeof(keys.ssid));
+  memset(keys.password, 'P', sizeof(keys.password));
+  memset(keys.metarId, 'M', sizeof(keys.metarId));
+  ConfigRecord record;
+  TEST_ASSERT_TRUE(configRecordMigrate(record, keys));
+  TEST_ASSERT_EQUAL(sizeof(record.ssid) - 1, strlen(record.ssid));
+  TEST_ASSERT_EQUAL(sizeof(record.password) - 1, strlen(record.password));
+  TEST_ASSERT_EQUAL(sizeof(record.metarId) - 1, strlen(record.metarId));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_sealed_record_is_ok);
+  RUN_TEST(test_nothing_read_is_missing);
+  RUN_TEST(test_bad_size);
+  RUN_TEST(test_bad_crc);
+  RUN_TEST(test_bad_version);
+  RUN_TEST(test_same_settings);
+  RUN_TEST(test_migrate_keys);
+  RUN_TEST(test_migrate_without_keys);
+  RUN_TEST(test_migrate_unterminated_keys);
+  return UNITY_END();
+}
@@ -0,0 +1,114 @@
+// Solar event table: events in time order, a day length within one day and the next event as the earliest
+// future one, over a grid of positions and a whole year.
+#include <unity.h>
+
+#include "calc.h"
+#include "ephemeris.h"
+
+static long day2024;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Existing events of one day strictly increase from astronomical dawn to astronomical dusk
+static bool inOrder(const SolarDay &solarDay) {
+  unsigned long last = 0;
+  for (int i = 0; i < SUN_EVENT_COUNT; i++) {
+    unsigned long event = solarDay.events[i];
+    if (!event) continue;
+    if (event <= last) return false;
+    last = event;
+  }
+  return true;
+}
+
+static void test_events_in_order() {
+  int checked = 0, unordered = 0, badLength = 0;
+  for (float lat = -66; lat <= 66; lat += 3)
+    for (float lon = -180; lon <= 180; lon += 7.5f)
+      for (long day = day2024; day < day2024 + 366; day += 5) {
+        Ephemeris ephemeris;
+        long utcOffset = (long)(lon / 15) * 3600;
+        unsigned long now = (unsigned long)(day * 86400L - utcOffset + 43200);
+        updateEphemeris(ephemeris, now, lat, lon, utcOffset);
+        for (int d = 0; d < EPHEMERIS_DAYS; d++) {
+          const SolarDay &solarDay = ephemeris.days[d];
+          if (!inOrder(solarDay)) unordered++;
+          if (solarDay.dayLength < 0 || solarDay.dayLength > 86400) badLength++;
+        }
+        checked++;
+      }
+  TEST_ASSERT_GREATER_THAN(10000, checked);
+  TEST_ASSERT_EQUAL(0, unordered);
+  TEST_ASSERT_EQUAL(0, badLength);
+}
+
+// Southern summer at 57 S, 150 E: the dusk events wrapped on their own came out before the dawn
+static void test_dusk_not_wrapped_before_dawn() {
+  Ephemeris ephemeris;
+  long day = daysFromCivil(2024, 1, 16);
+  updateEphemeris(ephemeris, day * 86400UL - 36000 + 43200, -57.0f, 150.0f, 36000);
+  const SolarDay &today = ephemerisToday(ephemeris);
+  TEST_ASSERT_TRUE(today.events[SUN_NAUTICAL_DUSK] != 0);
+  TEST_ASSERT_GREATER_THAN(today.events[SUN_SET], today.events[SUN_NAUTICAL_DUSK]);
+  TEST_ASSERT_LESS_THAN(today.events[SUN_RISE], today.events[SUN_CIVIL_DAWN]);
+  TEST_ASSERT_TRUE(inOrder(today));
+  TEST_ASSERT_INT_WITHIN(1800, 17 * 3600, today.dayLength);
+}
+
+static void test_polar_day_and_night() {
+  Ephemeris ephemeris;
+  updateEphemeris(ephemeris, daysFromCivil(2024, 6, 21) * 86400UL + 43200, 78.2f, 15.6f, 7200);
+  TEST_ASSERT_EQUAL(86400, ephemerisToday(ephemeris).dayLength);
+  TEST_ASSERT_EQUAL(0, ephemerisToday(ephemeris).events[SUN_RISE]);
+  updateEphemeris(ephemeris, daysFromCivil(2024, 12, 21) * 86400UL + 43200, 78.2f, 15.6f, 3600);
+  TEST_ASSERT_EQUAL(0, ephemerisToday(ephemeris).dayLength);
+  TEST_ASSERT_EQUAL(0, ephemerisToday(ephemeris).events[SUN_SET]);
+}
+
+// The next event is the earliest one after now of the whole table
+static void test_next_event_is_earliest() {
+  int wrong = 0;
+  for (float lat = -66; lat <= 66; lat += 6)
+    for (float lon = -180; lon <= 180; lon += 30) {
+      Ephemeris ephemeris;
+      long utcOffset = (long)(lon / 15) * 3600;
+      unsigned long start = (unsigned long)(daysFromCivil(2024, 6, 1) * 86400L - utcOffset);
+      updateEphemeris(ephemeris, start, lat, lon, utcOffset);
+      for (unsigned long now = start; now < start + 86400; now += 900) {
+        unsigned long earliest = 0;
+        for (int d = 0; d < EPHEMERIS_DAYS; d++)
+          for (int i = 0; i < SUN_EVENT_COUNT; i++) {
+            unsigned long event = ephemeris.days[d].events[i];
+            if (event > now && (!earliest || event < earliest)) earliest = event;
+          }
+        unsigned long when = 0;
+        SunEventType next = nextSunEvent(ephemeris, now, when);
+        if (earliest ? next == SUN_EVENT_COUNT || when != earliest : next != SUN_EVENT_COUNT) wrong++;
+      }
+    }
+  TEST_ASSERT_EQUAL(0, wrong);
+}
+
+// Rolling to the next local day reuses tomorrow's entry
+static void test_roll_forward() {
+  Ephemeris ephemeris;
+  unsigned long now = daysFromCivil(2024, 3, 10) * 86400UL + 43200;
+  TEST_ASSERT_TRUE(updateEphemeris(ephemeris, now, 50.0f, 8.6f, 3600));
+  SolarDay tomorrow = ephemeris.days[1];
+  TEST_ASSERT_FALSE(updateEphemeris(ephemeris, now + 3600, 50.0f, 8.6f, 3600));
+  TEST_ASSERT_TRUE(updateEphemeris(ephemeris, now + 86400, 50.0f, 8.6f, 3600));
+  TEST_ASSERT_EQUAL(tomorrow.day, ephemerisToday(ephemeris).day);
+  TEST_ASSERT_EQUAL(tomorrow.events[SUN_RISE], ephemerisToday(ephemeris).events[SUN_RISE]);
+}
+
+int main(int argc, char **argv) {
+  day2024 = daysFromCivil(2024, 1, 1);
+  UNITY_BEGIN();
+  RUN_TEST(test_events_in_order);
+  RUN_TEST(test_dusk_not_wrapped_before_dawn);
+  RUN_TEST(test_polar_day_and_night);
+  RUN_TEST(test_next_event_is_earliest);
+  RUN_TEST(test_roll_forward);
+  return UNITY_END();
+}
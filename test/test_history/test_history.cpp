@@ -0,0 +1,98 @@
+// Sliding window extremes and revisions of the observation history against a scan of the ring
+#include <unity.h>
+
+#include "../bench.h"
+#include "history.h"
+
+static History history;
+
+static int32_t scan(const int32_t *values, bool isMax) {
+  int32_t extreme = HISTORY_NONE;
+  for (int i = 0; i < HISTORY_CAPACITY; i++) {
+    if (values[i] == HISTORY_NONE) continue;
+    if (extreme == HISTORY_NONE || (isMax ? values[i] > extreme : values[i] < extreme)) extreme = values[i];
+  }
+  return extreme;
+}
+
+void setUp(void) { historyReset(history); }
+void tearDown(void) {}
+
+static void test_empty_history_has_no_extremes() {
+  TEST_ASSERT_EQUAL_INT32(HISTORY_NONE, historyExtreme(history.temperatureMax, history.temperature));
+  TEST_ASSERT_EQUAL_INT32(HISTORY_NONE, historyExtreme(history.pressureMin, history.pressure));
+}
+
+// Random weather over many times the capacity, so every slot is overwritten again and again
+static void test_extremes_match_scan() {
+  BenchRandom random;
+  int wrong = 0;
+  for (int report = 0; report < 20 * HISTORY_CAPACITY; report++) {
+    // Runs of the same value and long climbs and falls, the cases a monotonic queue gets wrong
+    int temperature = report % 50 < 25 ? report % 25 : 25 - report % 25;
+    if (report % 7 == 0) temperature = random.range(-30, 40);
+    // Reports without dew point or pressure now and then
+    int dewPoint = random.range(0, 9) ? temperature - random.range(0, 10) : HISTORY_NONE;
+    int pressure = random.range(0, 9) ? random.range(0, 3) ? 1013 : random.range(960, 1050) : HISTORY_NONE;
+    historyAppend(history, 1800 * (report + 1), temperature, dewPoint, 10, pressure);
+    if (historyExtreme(history.temperatureMax, history.temperature) != scan(history.temperature, true)) wrong++;
+    if (historyExtreme(history.dewPointMin, history.dewPoint) != scan(history.dewPoint, false)) wrong++;
+    if (historyExtreme(history.pressureMin, history.pressure) != scan(history.pressure, false)) wrong++;
+    if (historyExtreme(history.pressureMax, history.pressure) != scan(history.pressure, true)) wrong++;
+  }
+  TEST_ASSERT_EQUAL_INT(0, wrong);
+}
+
+// An extreme leaves the range once the ring has overwritten its report
+static void test_extreme_is_evicted() {
+  historyAppend(history, 1800, 45, 0, 10, 1013);
+  for (int report = 2; report <= HISTORY_CAPACITY; report++) historyAppend(history, 1800 * report, 20, 10, 10, 1013);
+  TEST_ASSERT_EQUAL_INT32(45, historyExtreme(history.temperatureMax, history.temperature));
+  TEST_ASSERT_EQUAL_INT32(0, historyExtreme(history.dewPointMin, history.dewPoint));
+  historyAppend(history, 1800 * (HISTORY_CAPACITY + 1), 20, 10, 10, 1013);
+  TEST_ASSERT_EQUAL_INT32(20, historyExtreme(history.temperatureMax, history.temperature));
+  TEST_ASSERT_EQUAL_INT32(10, historyExtreme(history.dewPointMin, history.dewPoint));
+}
+
+// Reports without a pressure are left out of its trend, the others still give it
+static void test_missing_values_are_not_in_the_trend() {
+  for (int report = 0; report < 7; report++)
+    historyAppend(history, 1800 * (report + 1), 20, 10, 10, report % 3 == 1 ? HISTORY_NONE : 1010 + report);
+  TEST_ASSERT_EQUAL(5, history.pressureTrend.n);
+  TEST_ASSERT_EQUAL(7, history.temperatureTrend.n);
+  TEST_ASSERT_EQUAL(TREND_RISING, historyTrend(history, history.pressureTrend, 1.0f));
+  TEST_ASSERT_EQUAL(TREND_STEADY, historyTrend(history, history.temperatureTrend, 2.0f));
+  TEST_ASSERT_EQUAL_INT32(1010, historyExtreme(history.pressureMin, history.pressure));
+  TEST_ASSERT_EQUAL_INT32(1016, historyExtreme(history.pressureMax, history.pressure));
+  // Without any pressure there is neither a trend nor a range
+  historyReset(history);
+  for (int report = 0; report < 7; report++) historyAppend(history, 1800 * (report + 1), 20 + report, 10, 10, HISTORY_NONE);
+  TEST_ASSERT_EQUAL(TREND_UNKNOWN, historyTrend(history, history.pressureTrend, 1.0f));
+  TEST_ASSERT_EQUAL(TREND_RISING, historyTrend(history, history.temperatureTrend, 2.0f));
+  TEST_ASSERT_EQUAL_INT32(HISTORY_NONE, historyExtreme(history.pressureMin, history.pressure));
+}
+
+// The chart is redrawn when the revision changes, the same report fetched again must not change it
+static void test_revision_changes_only_with_a_new_report() {
+  static History other;
+  historyReset(other);
+  TEST_ASSERT_NOT_EQUAL(history.revision, other.revision);
+  uint32_t revision = history.revision;
+  TEST_ASSERT_TRUE(historyAppend(history, 1800, 20, 10, 10, 1013));
+  TEST_ASSERT_NOT_EQUAL(revision, history.revision);
+  revision = history.revision;
+  TEST_ASSERT_FALSE(historyAppend(history, 1800, 20, 10, 10, 1013));
+  TEST_ASSERT_EQUAL_UINT32(revision, history.revision);
+  historyReset(history);
+  TEST_ASSERT_NOT_EQUAL(revision, history.revision);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_empty_history_has_no_extremes);
+  RUN_TEST(test_extremes_match_scan);
+  RUN_TEST(test_extreme_is_evicted);
+  RUN_TEST(test_missing_values_are_not_in_the_trend);
+  RUN_TEST(test_revision_changes_only_with_a_new_report);
+  return UNITY_END();
+}
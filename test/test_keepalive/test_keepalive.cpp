@@ -0,0 +1,252 @@
+// Connection reuse against a stand-in HTTPS server on a simulated clock: keep-alive hits while the server keeps the
+// connection, one retry with a resumed TLS session after it closed the idle connection, a release when the next
+// request is further away than its idle timeout, and unread or undelimited bodies that must not spill into the next
+// response.
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+#include "keepalive.h"
+
+#define SERVER_IDLE_TIMEOUT_MS 75000
+
+enum Framing { FRAMING_LENGTH, FRAMING_CHUNKED, FRAMING_CLOSE };
+
+// One HTTPS server with one connection. The response head is handed over as parsed by HTTPClient, the body bytes
+// go through the socket with whatever the server sends after them.
+struct StandInServer {
+  unsigned long nowMs = 0;
+  bool open = false;              // Server side of the connection
+  unsigned long lastActivityMs = 0;
+  unsigned long sessionId = 0;    // Session the server can resume, 0 after a restart
+  unsigned long nextSessionId = 1;
+  Framing framing = FRAMING_LENGTH;
+  const char *body = "{\"icaoId\":\"EDDM\"}";
+  unsigned long connections = 0;
+  char socket[512];               // Bytes sent, not read by the client yet
+  size_t socketLen = 0;
+  size_t socketPos = 0;
+
+  // A new connection, the client offers a session. Returns true if the server resumed it.
+  bool accept(unsigned long offeredId) {
+    open = true;
+    connections++;
+    lastActivityMs = nowMs;
+    socketLen = socketPos = 0;
+    bool resumed = offeredId && offeredId == sessionId;
+    if (!resumed) sessionId = nextSessionId++;
+    return resumed;
+  }
+  // The server closes connections idle for longer than its timeout
+  void tick() {
+    if (open && nowMs - lastActivityMs > SERVER_IDLE_TIMEOUT_MS) open = false;
+  }
+  void send(const char *text, size_t len) {
+    memcpy(socket + socketLen, text, len);
+    socketLen += len;
+  }
+  void send(const char *text) { send(text, strlen(text)); }
+  // Answers a GET, returns the size of the body from Content-Length, -1 without
+  int respond(bool &chunked) {
+    lastActivityMs = nowMs;
+    if (socketPos == socketLen) socketLen = socketPos = 0;  // Whatever the client left unread comes first
+    chunked = framing == FRAMING_CHUNKED;
+    if (framing == FRAMING_CHUNKED) {
+      char size[24];
+      size_t len = strlen(body);
+      snprintf(size, sizeof(size), "%zx\r\n", len / 2);
+      send(size);
+      send(body, len / 2);
+      snprintf(size, sizeof(size), "\r\n%zx;x=y\r\n", len - len / 2);
+      send(size);
+      send(body + len / 2);
+      send("\r\n0\r\n\r\n");
+      return -1;
+    }
+    send(body);
+    if (framing == FRAMING_CLOSE) open = false;  // The end of the body is the close of the connection
+    return framing == FRAMING_LENGTH ? (int)strlen(body) : -1;
+  }
+} server;
+
+// The socket of the client, everything the server sent is there at once
+struct StandInSocket {
+  int available() { return server.socketLen - server.socketPos; }
+  int read() { return available() ? (unsigned char)server.socket[server.socketPos++] : -1; }
+  int peek() { return available() ? (unsigned char)server.socket[server.socketPos] : -1; }
+  int timedRead() { return read(); }
+} clientSocket;
+
+// The client side: open connection, saved session, the HTTP request
+struct StandInTransport {
+  bool open = false;
+  unsigned long savedSession = 0;
+  bool resumedLast = false;
+  BodyReader<StandInSocket> body;
+
+  bool connected() { return open; }
+  int request(const char *url) {
+    resumedLast = false;
+    if (!open) {
+      resumedLast = server.accept(savedSession);
+      savedSession = server.sessionId;
+      open = true;
+    } else if (!server.open) {
+      return -4;  // HTTPC_ERROR_NOT_CONNECTED: the server closed the connection while it was idle
+    }
+    bool chunked;
+    int size = server.respond(chunked);
+    body.begin(clientSocket, size, chunked);
+    return 200;
+  }
+  bool resumed() { return resumedLast; }
+  void stop() {
+    open = false;
+    server.open = false;
+  }
+  void end() {}
+} transport;
+
+static KeepAlive keepAlive;
+static char text[256];
+
+// GET, read the whole body, end
+static int get() {
+  int httpCode = keepAliveGet(keepAlive, transport, "https://aviationweather.gov/api/data/metar?ids=EDDM&format=json");
+  size_t len = transport.body.readBytes(text, sizeof(text) - 1);
+  text[len] = '\0';
+  keepAliveEnd(keepAlive, transport, transport.body);
+  return httpCode;
+}
+
+static void wait(unsigned long ms) {
+  server.nowMs += ms;
+  server.tick();
+}
+
+void setUp(void) {
+  server = StandInServer();
+  transport = StandInTransport();
+  keepAlive = KeepAlive();
+}
+
+void tearDown(void) {}
+
+// Requests closer together than the idle timeout of the server all go over the first connection
+static void test_requests_reuse_the_connection() {
+  for (int i = 0; i < 5; i++) {
+    TEST_ASSERT_EQUAL(200, get());
+    TEST_ASSERT_EQUAL_STRING(server.body, text);
+    wait(10000);
+  }
+  TEST_ASSERT_EQUAL(1, server.connections);
+  TEST_ASSERT_EQUAL(5, keepAlive.requests);
+  TEST_ASSERT_EQUAL(1, keepAlive.handshakes);
+  TEST_ASSERT_EQUAL(4, keepAlive.keepAliveHits);
+  TEST_ASSERT_EQUAL(0, keepAlive.resumptions);
+  TEST_ASSERT_TRUE(transport.open);
+}
+
+// The server closed the idle connection: one retry over a new connection, which resumes the session
+static void test_closed_idle_connection_is_retried_and_resumed() {
+  get();
+  wait(SERVER_IDLE_TIMEOUT_MS + 1000);
+  TEST_ASSERT_TRUE(transport.open);  // The client does not know yet
+  TEST_ASSERT_EQUAL(200, get());
+  TEST_ASSERT_EQUAL_STRING(server.body, text);
+  TEST_ASSERT_EQUAL(1, keepAlive.retries);
+  TEST_ASSERT_EQUAL(1, keepAlive.resumptions);
+  TEST_ASSERT_EQUAL(1, keepAlive.handshakes);
+  TEST_ASSERT_EQUAL(2, keepAlive.requests);
+}
+
+// A restarted server does not know the session any more, the client falls back to a full handshake
+static void test_forgotten_session_takes_a_full_handshake() {
+  get();
+  transport.stop();
+  server.sessionId = 0;
+  get();
+  TEST_ASSERT_EQUAL(2, keepAlive.handshakes);
+  TEST_ASSERT_EQUAL(0, keepAlive.resumptions);
+}
+
+// The next request is further away than the idle timeout: the connection is released at once and resumed later
+static void test_far_next_request_releases_the_connection() {
+  get();
+  TEST_ASSERT_FALSE(keepAliveRelease(keepAlive, transport, 30000));
+  TEST_ASSERT_TRUE(transport.open);
+  TEST_ASSERT_TRUE(keepAliveRelease(keepAlive, transport, 600000));
+  TEST_ASSERT_FALSE(transport.open);
+  TEST_ASSERT_FALSE(keepAliveRelease(keepAlive, transport, 600000));  // Nothing open any more
+  TEST_ASSERT_EQUAL(1, keepAlive.releases);
+  wait(600000);
+  TEST_ASSERT_EQUAL(200, get());
+  TEST_ASSERT_EQUAL(0, keepAlive.retries);  // No failed request on a dead connection
+  TEST_ASSERT_EQUAL(1, keepAlive.resumptions);
+  TEST_ASSERT_TRUE(keepAliveOutlived(KEEP_ALIVE_IDLE_TIMEOUT_MS + 1));
+  TEST_ASSERT_FALSE(keepAliveOutlived(KEEP_ALIVE_IDLE_TIMEOUT_MS));
+}
+
+// A body read only in part is drained, the next response starts clean on the same connection
+static void test_partly_read_body_is_drained() {
+  Framing framings[] = {FRAMING_LENGTH, FRAMING_CHUNKED};
+  for (int i = 0; i < 2; i++) {
+    setUp();
+    server.framing = framings[i];
+    keepAliveGet(keepAlive, transport, "/");
+    char part[4];
+    TEST_ASSERT_EQUAL(sizeof(part), transport.body.readBytes(part, sizeof(part)));
+    keepAliveEnd(keepAlive, transport, transport.body);
+    TEST_ASSERT_TRUE(transport.open);
+    TEST_ASSERT_EQUAL(0, transport.body.remaining());
+    TEST_ASSERT_EQUAL(200, get());
+    TEST_ASSERT_EQUAL_STRING(server.body, text);
+    TEST_ASSERT_EQUAL(1, keepAlive.keepAliveHits);
+  }
+}
+
+// Without a known end the connection cannot carry another request, it is closed
+static void test_undelimited_body_closes_the_connection() {
+  server.framing = FRAMING_CLOSE;
+  get();
+  TEST_ASSERT_EQUAL_STRING(server.body, text);
+  TEST_ASSERT_FALSE(transport.open);
+  server.framing = FRAMING_LENGTH;
+  get();
+  TEST_ASSERT_EQUAL(1, keepAlive.resumptions);
+  TEST_ASSERT_EQUAL(0, keepAlive.retries);
+}
+
+// A host that is not persistent closes after every request and still resumes its session
+static void test_not_persistent_host_closes() {
+  keepAlive.persistent = false;
+  for (int i = 0; i < 3; i++) {
+    get();
+    TEST_ASSERT_FALSE(transport.open);
+  }
+  TEST_ASSERT_EQUAL(3, server.connections);
+  TEST_ASSERT_EQUAL(1, keepAlive.handshakes);
+  TEST_ASSERT_EQUAL(2, keepAlive.resumptions);
+  TEST_ASSERT_EQUAL(0, keepAlive.keepAliveHits);
+}
+
+// A failed request over a new connection is not retried, it would only fail again
+static void test_retry_only_after_a_warm_failure() {
+  TEST_ASSERT_TRUE(keepAliveRetry(true, -4, 0));
+  TEST_ASSERT_FALSE(keepAliveRetry(true, -4, 1));
+  TEST_ASSERT_FALSE(keepAliveRetry(false, -1, 0));
+  TEST_ASSERT_FALSE(keepAliveRetry(true, 503, 0));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_requests_reuse_the_connection);
+  RUN_TEST(test_closed_idle_connection_is_retried_and_resumed);
+  RUN_TEST(test_forgotten_session_takes_a_full_handshake);
+  RUN_TEST(test_far_next_request_releases_the_connection);
+  RUN_TEST(test_partly_read_body_is_drained);
+  RUN_TEST(test_undelimited_body_closes_the_connection);
+  RUN_TEST(test_not_persistent_host_closes);
+  RUN_TEST(test_retry_only_after_a_warm_failure);
+  return UNITY_END();
+}
@@ -0,0 +1,181 @@
+// METAR JSON filter and streaming deserializer: canned responses of 1, 10 and 50 stations go through
+// metarJsonForEach, the JSON pool has to peak at the size of one station whatever the length of the response.
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+
+#include "metar_json.h"
+
+// The pool sizes below are those of the library the firmware links, lib_deps of env:native
+#if ARDUINOJSON_VERSION_MAJOR != 7
+#error "test_metar_json needs ArduinoJson 7, pio test -e native installs it"
+#endif
+
+#define MAX_STATIONS 50
+#define POOL_LIMIT 8192  // Bytes, one filtered station object with its strings
+
+// Counts the bytes the document holds, each block carries its size in front of it
+struct PeakAllocator : ArduinoJson::Allocator {
+  static const size_t HEADER = sizeof(max_align_t);
+  size_t current = 0;
+  size_t peak = 0;
+  unsigned long allocations = 0;
+
+  void *allocate(size_t size) override { return reallocate(nullptr, size); }
+  void deallocate(void *ptr) override {
+    if (!ptr) return;
+    char *block = (char *)ptr - HEADER;
+    current -= *(size_t *)block;
+    free(block);
+  }
+  void *reallocate(void *ptr, size_t size) override {
+    char *block = ptr ? (char *)ptr - HEADER : nullptr;
+    if (block) current -= *(size_t *)block;
+    block = (char *)realloc(block, size + HEADER);
+    if (!block) return nullptr;
+    *(size_t *)block = size;
+    current += size;
+    if (current > peak) peak = current;
+    allocations++;
+    return block + HEADER;
+  }
+};
+
+// Response body delivered in chunks of at most chunk bytes, like TCP segments
+struct PayloadReader {
+  const char *data;
+  size_t length;
+  size_t chunk;
+  size_t pos = 0;
+
+  PayloadReader(const char *data, size_t chunk) : data(data), length(strlen(data)), chunk(chunk) {}
+  int read() { return pos < length ? (unsigned char)data[pos++] : -1; }
+  size_t readBytes(char *buffer, size_t size) {
+    size_t n = size < chunk ? size : chunk;
+    if (n > length - pos) n = length - pos;
+    memcpy(buffer, data + pos, n);
+    pos += n;
+    return n;
+  }
+};
+
+static char payload[MAX_STATIONS * 1200 + 16];
+
+// A response like aviationweather.gov sends it, every station object has the same size
+static void buildPayload(int stations) {
+  char *out = payload;
+  *out++ = '[';
+  for (int i = 0; i < stations; i++) {
+    out += sprintf(out,
+                   "%s{\"icaoId\":\"K%03d\",\"receiptTime\":\"2024-06-10 12:23:10\",\"obsTime\":%d,"
+                   "\"reportTime\":\"2024-06-10 12:20:00\",\"temp\":%d,\"dewp\":%d,\"wdir\":250,\"wspd\":%d,"
+                   "\"wgst\":null,\"visib\":\"10+\",\"altim\":1015.2,\"slp\":1014.9,\"qcField\":4,\"wxString\":null,"
+                   "\"presTend\":null,\"maxT\":null,\"minT\":null,\"maxT24\":null,\"minT24\":null,\"precip\":null,"
+                   "\"pcp3hr\":null,\"pcp6hr\":null,\"pcp24hr\":null,\"snow\":null,\"vertVis\":null,"
+                   "\"metarType\":\"METAR\",\"rawOb\":\"METAR K%03d 101220Z 25008KT 10SM FEW040 BKN250 %02d/%02d A2998 "
+                   "RMK AO2 SLP149 T01830122\",\"mostRecent\":1,\"lat\":%d.353,\"lon\":-%d.786,\"elev\":448,"
+                   "\"prior\":0,\"name\":\"Station %03d Intl, CA, US\",\"clouds\":[{\"cover\":\"FEW\",\"base\":4000},"
+                   "{\"cover\":\"BKN\",\"base\":25000}]}",
+                   i ? ",\n" : "\n", i, 1718022000 + i, 10 + i % 10, 5 + i % 5, i % 30, i, 10 + i % 10, 5 + i % 5,
+                   30 + i % 20, 80 + i % 40, i);
+  }
+  strcpy(out, "\n]\n");
+}
+
+struct ParseResult {
+  DeserializationError error;
+  int stations;
+  bool idsInOrder;
+  bool filtered;
+  size_t peak;
+  size_t leaked;
+};
+
+static ParseResult parsePayload(int stations, size_t chunk) {
+  buildPayload(stations);
+  PayloadReader reader(payload, chunk);
+  PeakAllocator allocator;
+  ParseResult result = {DeserializationError::Ok, 0, true, true, 0, 0};
+  {
+    JsonDocument filter;
+    metarJsonFilter(filter);
+    JsonDocument doc(&allocator);
+    result.error = metarJsonForEach(reader, doc, filter, [&](JsonDocument &station) {
+      char id[8];
+      snprintf(id, sizeof(id), "K%03d", result.stations++);
+      if (strcmp(station["icaoId"] | "", id) != 0) result.idsInOrder = false;
+      if (!station["receiptTime"].isNull() || !station["clouds"].isNull() || station["rawOb"].isNull() ||
+          station.as<JsonObject>().size() != 10)
+        result.filtered = false;
+    });
+  }
+  result.peak = allocator.peak;
+  result.leaked = allocator.current;
+  printf("%d stations, %u byte chunks: %u bytes of JSON, pool peak %u bytes in %lu allocations\n", stations,
+         (unsigned)chunk, (unsigned)strlen(payload), (unsigned)allocator.peak, allocator.allocations);
+  return result;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void checkStations(int stations) {
+  ParseResult single = parsePayload(1, 1460);
+  ParseResult result = parsePayload(stations, 1460);
+  TEST_ASSERT_TRUE(result.error == DeserializationError::Ok);
+  TEST_ASSERT_EQUAL(stations, result.stations);
+  TEST_ASSERT_TRUE(result.idsInOrder);
+  TEST_ASSERT_TRUE(result.filtered);
+  TEST_ASSERT_EQUAL(0, result.leaked);
+  TEST_ASSERT_LESS_OR_EQUAL(POOL_LIMIT, result.peak);
+  // One station at a time: the longer response must not need a larger pool
+  TEST_ASSERT_LESS_OR_EQUAL(single.peak, result.peak);
+}
+
+static void test_one_station() { checkStations(1); }
+static void test_ten_stations() { checkStations(10); }
+static void test_fifty_stations() { checkStations(50); }
+
+// The walker reads the separators itself, it has to cope with the body arriving a byte at a time
+static void test_byte_chunks() {
+  ParseResult result = parsePayload(10, 1);
+  TEST_ASSERT_TRUE(result.error == DeserializationError::Ok);
+  TEST_ASSERT_EQUAL(10, result.stations);
+  TEST_ASSERT_TRUE(result.idsInOrder);
+}
+
+static void test_not_an_array() {
+  PayloadReader reader("{\"error\":\"rate limited\"}", 1460);
+  JsonDocument filter, doc;
+  metarJsonFilter(filter);
+  int stations = 0;
+  DeserializationError error = metarJsonForEach(reader, doc, filter, [&](JsonDocument &) { stations++; });
+  TEST_ASSERT_TRUE(error == DeserializationError::InvalidInput);
+  TEST_ASSERT_EQUAL(0, stations);
+}
+
+static void test_truncated_response() {
+  buildPayload(3);
+  payload[strlen(payload) - 200] = '\0';
+  PayloadReader reader(payload, 1460);
+  JsonDocument filter, doc;
+  metarJsonFilter(filter);
+  int stations = 0;
+  DeserializationError error = metarJsonForEach(reader, doc, filter, [&](JsonDocument &) { stations++; });
+  TEST_ASSERT_TRUE(error == DeserializationError::IncompleteInput);
+  TEST_ASSERT_EQUAL(2, stations);
+}
+
+int main(int argc, char **argv) {
+  printf("ArduinoJson %s, %u byte pointers\n", ARDUINOJSON_VERSION, (unsigned)sizeof(void *));
+  UNITY_BEGIN();
+  RUN_TEST(test_one_station);
+  RUN_TEST(test_ten_stations);
+  RUN_TEST(test_fifty_stations);
+  RUN_TEST(test_byte_chunks);
+  RUN_TEST(test_not_an_array);
+  RUN_TEST(test_truncated_response);
+  return UNITY_END();
+}
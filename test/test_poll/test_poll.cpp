@@ -0,0 +1,181 @@
+// Publication aware polling: learning the issuance minute, SPECIs off the schedule, the fast and idle intervals and
+// the fetch counters, and a simulated day against the fixed interval of before, with the requests it saves and the
+// time from the release of a report to its display.
+#include <stdio.h>
+#include <unity.h>
+
+#include "poll.h"
+
+#define DAY 1718064000UL  // UTC epoch seconds of a midnight
+#define HOUR 3600UL
+
+static StationPoll poll;
+static PollStats stats;
+
+void setUp(void) {
+  poll = StationPoll();
+  stats = PollStats();
+}
+
+void tearDown(void) {}
+
+// Routine reports at the given minute of each hour from start on, each one fetched once right after its release
+static void observeHours(unsigned long start, int minute, int hours, long delay) {
+  for (int h = 0; h < hours; h++) {
+    unsigned long obs = start + h * HOUR + minute * 60;
+    pollObserve(poll, obs, obs + delay + 60, obs + delay - 60);
+  }
+}
+
+static void test_issuance_minute_is_learned() {
+  int minutes[POLL_MAX_MINUTES];
+  observeHours(DAY, 50, 1, 300);
+  TEST_ASSERT_EQUAL(0, pollIssuanceMinutes(poll, minutes));  // One report may have been a SPECI
+  observeHours(DAY, 50, 3, 300);
+  TEST_ASSERT_EQUAL(1, pollIssuanceMinutes(poll, minutes));
+  TEST_ASSERT_EQUAL(50, minutes[0]);
+  // The release bracketed by the fetches before and after it sets the delay
+  TEST_ASSERT_EQUAL(300, poll.publishDelay);
+  // A station reporting half-hourly has two minutes
+  setUp();
+  for (int h = 0; h < 4; h++) {
+    pollObserve(poll, DAY + h * HOUR + 20 * 60, 0, 0);
+    pollObserve(poll, DAY + h * HOUR + 50 * 60, 0, 0);
+  }
+  TEST_ASSERT_EQUAL(2, pollIssuanceMinutes(poll, minutes));
+  TEST_ASSERT_EQUAL(20, minutes[0]);
+  TEST_ASSERT_EQUAL(50, minutes[1]);
+}
+
+// The same report fetched again or an older one is not new
+static void test_same_report_is_not_new() {
+  TEST_ASSERT_TRUE(pollObserve(poll, DAY + 50 * 60, 0, 0));
+  TEST_ASSERT_FALSE(pollObserve(poll, DAY + 50 * 60, 0, 0));
+  TEST_ASSERT_FALSE(pollObserve(poll, DAY + 20 * 60, 0, 0));
+  TEST_ASSERT_FALSE(pollObserve(poll, 0, 0, 0));
+}
+
+// A SPECI is a new report but does not move the schedule off the routine minute
+static void test_speci_off_schedule() {
+  int minutes[POLL_MAX_MINUTES];
+  observeHours(DAY, 50, 6, 300);
+  unsigned long speci = DAY + 6 * HOUR + 13 * 60;
+  TEST_ASSERT_TRUE(pollObserve(poll, speci, speci + 600, speci + 300));
+  TEST_ASSERT_EQUAL(1, pollIssuanceMinutes(poll, minutes));
+  TEST_ASSERT_EQUAL(50, minutes[0]);
+  // The next routine report still comes at 06:50 and is released at about 06:55
+  unsigned long release = DAY + 6 * HOUR + 50 * 60 + poll.publishDelay;
+  unsigned long due = pollNextDue(poll, speci + 600);
+  TEST_ASSERT_TRUE(due <= release);
+  TEST_ASSERT_TRUE(due >= release - POLL_WINDOW_BEFORE - POLL_FAST_INTERVAL);
+}
+
+// Idle interval far from the release, the window opens before it and is polled at the fast interval inside
+static void test_fast_and_idle_intervals() {
+  observeHours(DAY, 50, 4, 300);  // Last report 03:50, released 03:55
+  unsigned long release = DAY + 4 * HOUR + 50 * 60 + 300;
+  unsigned long early = DAY + 4 * HOUR;
+  TEST_ASSERT_EQUAL(early + POLL_IDLE_INTERVAL, pollNextDue(poll, early));
+  // Idle would overshoot the window, it opens instead
+  unsigned long late = DAY + 4 * HOUR + 40 * 60;
+  TEST_ASSERT_EQUAL(release - POLL_WINDOW_BEFORE, pollNextDue(poll, late));
+  // Inside the window
+  TEST_ASSERT_EQUAL(release - POLL_WINDOW_BEFORE + POLL_FAST_INTERVAL, pollNextDue(poll, release - POLL_WINDOW_BEFORE));
+  TEST_ASSERT_EQUAL(release + 600 + POLL_FAST_INTERVAL, pollNextDue(poll, release + 600));
+  // A report that did not come within its window is given up, the next one is waited for at the idle interval
+  unsigned long givenUp = release + POLL_WINDOW_AFTER;
+  TEST_ASSERT_EQUAL(givenUp + POLL_IDLE_INTERVAL, pollNextDue(poll, givenUp));
+  // Without known minutes the fixed interval of before
+  setUp();
+  TEST_ASSERT_EQUAL(early + POLL_DEFAULT_INTERVAL, pollNextDue(poll, early));
+}
+
+static void test_fetches_are_counted() {
+  pollCountFetch(stats, true, 2);
+  pollCountFetch(stats, true, 0);
+  pollCountFetch(stats, false, 0);
+  TEST_ASSERT_EQUAL(3, stats.requests);
+  TEST_ASSERT_EQUAL(1, stats.failed);
+  TEST_ASSERT_EQUAL(1, stats.wasted);  // A failed fetch is not a wasted one
+  TEST_ASSERT_EQUAL(2, stats.newReports);
+  pollCountLatency(stats, 100);
+  pollCountLatency(stats, -20);
+  TEST_ASSERT_EQUAL(50, pollAverageLatency(stats));
+  TEST_ASSERT_EQUAL(100, stats.latencyMax);
+}
+
+// One station over a day: routine reports at minute 50 released 7 minutes later, two SPECIs released after 3
+#define DAY_REPORTS 26
+
+static unsigned long dayObs[DAY_REPORTS];
+static unsigned long dayRelease[DAY_REPORTS];
+
+static void makeDay() {
+  int n = 0;
+  for (int h = 0; h < 24; h++) {
+    dayObs[n] = DAY + h * HOUR + 50 * 60;
+    dayRelease[n] = dayObs[n] + 420;
+    n++;
+  }
+  dayObs[n] = DAY + 6 * HOUR + 13 * 60;
+  dayRelease[n] = dayObs[n] + 180;
+  dayObs[n + 1] = DAY + 15 * HOUR + 37 * 60;
+  dayRelease[n + 1] = dayObs[n + 1] + 180;
+}
+
+// The newest report released at the time of the fetch, with its release time
+static unsigned long newestReleased(unsigned long nowUtc, unsigned long &release) {
+  unsigned long obs = 0;
+  for (int i = 0; i < DAY_REPORTS; i++)
+    if (dayRelease[i] <= nowUtc && dayObs[i] > obs) {
+      obs = dayObs[i];
+      release = dayRelease[i];
+    }
+  return obs;
+}
+
+// Fetches from start until the last report of the day is out, with the schedule or at the fixed interval
+static void runDay(bool scheduled, unsigned long start) {
+  unsigned long previous = 0;
+  for (unsigned long now = start; now <= DAY + 24 * HOUR + 10 * 60;) {
+    unsigned long release = 0;
+    unsigned long obs = newestReleased(now, release);
+    bool isNew = pollObserve(poll, obs, now, previous);
+    if (isNew && previous) pollCountLatency(stats, (long)(now - release));
+    pollCountFetch(stats, true, isNew);
+    previous = now;
+    now = scheduled ? pollNextDue(poll, now) : now + POLL_DEFAULT_INTERVAL;
+  }
+}
+
+static void test_simulated_day() {
+  makeDay();
+  // The schedule after learning the day before, against the fixed interval over the same day
+  observeHours(DAY - 24 * HOUR, 50, 24, 420);
+  runDay(true, DAY);
+  PollStats scheduled = stats;
+  setUp();
+  runDay(false, DAY);
+  PollStats fixed = stats;
+  printf("Simulated day, scheduled: %lu requests, %lu wasted, %lu new reports, release to display avg %lu s max %lu s\n",
+         scheduled.requests, scheduled.wasted, scheduled.newReports, pollAverageLatency(scheduled), scheduled.latencyMax);
+  printf("Simulated day, fixed %d s: %lu requests, %lu wasted, %lu new reports, release to display avg %lu s max %lu s\n",
+         POLL_DEFAULT_INTERVAL, fixed.requests, fixed.wasted, fixed.newReports, pollAverageLatency(fixed), fixed.latencyMax);
+  TEST_ASSERT_EQUAL(DAY_REPORTS, scheduled.newReports);
+  TEST_ASSERT_EQUAL(DAY_REPORTS, fixed.newReports);
+  TEST_ASSERT_TRUE(scheduled.requests < fixed.requests);
+  TEST_ASSERT_TRUE(scheduled.wasted < fixed.wasted);
+  TEST_ASSERT_TRUE(pollAverageLatency(scheduled) < pollAverageLatency(fixed));
+  TEST_ASSERT_TRUE(pollAverageLatency(scheduled) <= POLL_FAST_INTERVAL);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_issuance_minute_is_learned);
+  RUN_TEST(test_same_report_is_not_new);
+  RUN_TEST(test_speci_off_schedule);
+  RUN_TEST(test_fast_and_idle_intervals);
+  RUN_TEST(test_fetches_are_counted);
+  RUN_TEST(test_simulated_day);
+  return UNITY_END();
+}
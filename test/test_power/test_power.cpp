@@ -0,0 +1,178 @@
+// Power policy on a simulated clock: a day of touches, idle time and a night, updated every 250 ms like powerCallback
+#include <unity.h>
+
+#include "power.h"
+
+#define TICK_MS 250
+#define SUNRISE 1718000000UL  // UTC epoch seconds, any day
+#define SUNSET (SUNRISE + 16 * 3600)
+
+static PowerPolicy policy;
+static PowerInputs inputs;
+static unsigned long lastTouchMs;
+static unsigned long changes[8];  // Returned PowerChange flags, counted by value
+
+void setUp(void) {
+  policy = PowerPolicy();
+  inputs = PowerInputs();
+  inputs.sunrise = SUNRISE;
+  inputs.sunset = SUNSET;
+  inputs.nowUtc = SUNRISE + 3600;
+  lastTouchMs = 0;
+  for (int i = 0; i < 8; i++) changes[i] = 0;
+}
+
+void tearDown(void) {}
+
+// Let ms of simulated time pass, the UTC clock runs along
+static void run(unsigned long ms) {
+  for (unsigned long elapsed = 0; elapsed < ms; elapsed += TICK_MS) {
+    inputs.nowMs += TICK_MS;
+    if (inputs.nowMs % 1000 == 0) inputs.nowUtc++;
+    inputs.inactiveMs = inputs.nowMs - lastTouchMs;
+    changes[powerUpdate(policy, inputs)]++;
+    inputs.redraw = false;
+  }
+}
+
+static void touch() { lastTouchMs = inputs.nowMs; }
+
+static unsigned long residency() {
+  unsigned long total = 0;
+  for (int i = 0; i < POWER_STATE_COUNT; i++) total += policy.residencyMs[i];
+  return total;
+}
+
+// Active while touched, idle after POWER_IDLE_AFTER_MS, night after sunset and back to active with a touch
+static void test_active_idle_night_active() {
+  for (int i = 0; i < 10; i++) {
+    touch();
+    run(2000);
+  }
+  TEST_ASSERT_EQUAL(POWER_ACTIVE, policy.state);
+  TEST_ASSERT_EQUAL(POWER_CPU_ACTIVE_MHZ, policy.cpuMhz);
+  TEST_ASSERT_EQUAL_FLOAT(POWER_BACKLIGHT_DAY, policy.backlight);
+
+  touch();
+  run(POWER_IDLE_AFTER_MS - TICK_MS);
+  TEST_ASSERT_EQUAL(POWER_ACTIVE, policy.state);
+  run(TICK_MS);
+  TEST_ASSERT_EQUAL(POWER_IDLE, policy.state);
+  TEST_ASSERT_EQUAL(POWER_CPU_IDLE_MHZ, policy.cpuMhz);
+  TEST_ASSERT_EQUAL_FLOAT(POWER_BACKLIGHT_DAY, policy.backlight);  // Only the night dims
+
+  // Sunset, the backlight goes down one step per update
+  inputs.nowUtc = SUNSET;
+  run(1000);
+  TEST_ASSERT_EQUAL(POWER_NIGHT, policy.state);
+  TEST_ASSERT_TRUE(policy.backlight < POWER_BACKLIGHT_DAY && policy.backlight > POWER_BACKLIGHT_NIGHT);
+  run(10000);
+  TEST_ASSERT_EQUAL_FLOAT(POWER_BACKLIGHT_NIGHT, policy.backlight);
+  unsigned long dimSteps = policy.backlightChanges;
+  TEST_ASSERT_EQUAL(15, dimSteps);  // (1.0 - 0.25) / 0.05
+  run(60000);
+  TEST_ASSERT_EQUAL(dimSteps, policy.backlightChanges);  // Steady at night, no writes
+
+  // A touch brightens at once and raises the clock
+  touch();
+  run(TICK_MS);
+  TEST_ASSERT_EQUAL(POWER_ACTIVE, policy.state);
+  TEST_ASSERT_EQUAL_FLOAT(POWER_BACKLIGHT_DAY, policy.backlight);
+  TEST_ASSERT_EQUAL(POWER_CPU_ACTIVE_MHZ, policy.cpuMhz);
+  TEST_ASSERT_EQUAL(2, policy.cpuChanges);
+
+  // The time is split over the states it was spent in
+  TEST_ASSERT_EQUAL(inputs.nowMs, residency());
+  TEST_ASSERT_EQUAL(20000 + POWER_IDLE_AFTER_MS, policy.residencyMs[POWER_ACTIVE]);
+  TEST_ASSERT_EQUAL(71000, policy.residencyMs[POWER_NIGHT]);
+}
+
+// A large redraw keeps the CPU fast for POWER_REDRAW_HOLD_MS, then it drops back to the idle clock
+static void test_redraw_holds_the_cpu() {
+  run(POWER_IDLE_AFTER_MS + 1000);
+  TEST_ASSERT_EQUAL(POWER_CPU_IDLE_MHZ, policy.cpuMhz);
+  inputs.redraw = true;
+  run(TICK_MS);
+  TEST_ASSERT_EQUAL(POWER_IDLE, policy.state);
+  TEST_ASSERT_EQUAL(POWER_CPU_ACTIVE_MHZ, policy.cpuMhz);
+  run(POWER_REDRAW_HOLD_MS - TICK_MS);
+  TEST_ASSERT_EQUAL(POWER_CPU_ACTIVE_MHZ, policy.cpuMhz);
+  run(TICK_MS);
+  TEST_ASSERT_EQUAL(POWER_CPU_IDLE_MHZ, policy.cpuMhz);
+}
+
+// The invalidate path only touches the CPU, never the modem, the backlight or the residency
+static void test_redraw_event_changes_only_the_cpu() {
+  inputs.networkActive = false;
+  inputs.nowUtc = SUNSET + 60;
+  run(POWER_IDLE_AFTER_MS + 10000);
+  TEST_ASSERT_TRUE(policy.modemSleep);
+  TEST_ASSERT_EQUAL(POWER_CPU_IDLE_MHZ, policy.cpuMhz);
+  PowerPolicy before = policy;
+  TEST_ASSERT_EQUAL(POWER_CPU_CHANGED, powerRedraw(policy, inputs.nowMs + 100));
+  TEST_ASSERT_EQUAL(0, powerRedraw(policy, inputs.nowMs + 200));  // Already fast
+  TEST_ASSERT_EQUAL(POWER_CPU_ACTIVE_MHZ, policy.cpuMhz);
+  TEST_ASSERT_EQUAL(before.cpuChanges + 1, policy.cpuChanges);
+  TEST_ASSERT_EQUAL(before.modemSleep, policy.modemSleep);
+  TEST_ASSERT_EQUAL(before.modemChanges, policy.modemChanges);
+  TEST_ASSERT_EQUAL_FLOAT(before.backlight, policy.backlight);
+  TEST_ASSERT_EQUAL(before.state, policy.state);
+  TEST_ASSERT_EQUAL(before.lastUpdateMs, policy.lastUpdateMs);
+  // The next regular update keeps the clock up for the hold time
+  run(TICK_MS);
+  TEST_ASSERT_EQUAL(POWER_CPU_ACTIVE_MHZ, policy.cpuMhz);
+  run(POWER_REDRAW_HOLD_MS);
+  TEST_ASSERT_EQUAL(POWER_CPU_IDLE_MHZ, policy.cpuMhz);
+}
+
+// The modem sleeps while nothing needs the network and every switch is reported once
+static void test_modem_sleep_follows_network() {
+  inputs.networkActive = true;
+  run(5000);
+  TEST_ASSERT_FALSE(policy.modemSleep);
+  inputs.networkActive = false;
+  run(60000);
+  TEST_ASSERT_TRUE(policy.modemSleep);
+  inputs.networkActive = true;
+  run(5000);
+  TEST_ASSERT_FALSE(policy.modemSleep);
+  TEST_ASSERT_EQUAL(2, policy.modemChanges);
+  TEST_ASSERT_EQUAL(60000, policy.modemSleepMs);
+}
+
+// Without sun times or a clock there is no night, the backlight stays up
+static void test_no_night_without_sun_times() {
+  inputs.sunset = 0;
+  inputs.nowUtc = SUNRISE - 3600;
+  run(POWER_IDLE_AFTER_MS + 10000);
+  TEST_ASSERT_EQUAL(POWER_IDLE, policy.state);
+  TEST_ASSERT_EQUAL_FLOAT(POWER_BACKLIGHT_DAY, policy.backlight);
+  TEST_ASSERT_EQUAL(0, changes[POWER_BACKLIGHT_CHANGED]);
+}
+
+// A board with a fixed clock never changes the CPU, the backlight and the modem still follow the policy
+static void test_fixed_cpu() {
+  policy.scaleCpu = false;
+  inputs.networkActive = false;
+  inputs.nowUtc = SUNSET + 60;
+  run(POWER_IDLE_AFTER_MS + 60000);
+  TEST_ASSERT_EQUAL(POWER_NIGHT, policy.state);
+  TEST_ASSERT_EQUAL(POWER_CPU_ACTIVE_MHZ, policy.cpuMhz);
+  TEST_ASSERT_EQUAL_FLOAT(POWER_BACKLIGHT_NIGHT, policy.backlight);
+  TEST_ASSERT_TRUE(policy.modemSleep);
+  TEST_ASSERT_EQUAL(0, powerRedraw(policy, inputs.nowMs + 100));
+  TEST_ASSERT_EQUAL(0, policy.cpuChanges);
+  for (int i = 0; i < 8; i++)
+    if (i & POWER_CPU_CHANGED) TEST_ASSERT_EQUAL(0, changes[i]);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_active_idle_night_active);
+  RUN_TEST(test_redraw_holds_the_cpu);
+  RUN_TEST(test_redraw_event_changes_only_the_cpu);
+  RUN_TEST(test_modem_sleep_follows_network);
+  RUN_TEST(test_no_night_without_sun_times);
+  RUN_TEST(test_fixed_cpu);
+  return UNITY_END();
+}
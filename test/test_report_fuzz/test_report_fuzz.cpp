@@ -0,0 +1,192 @@
+// Fuzz loop of the METAR and TAF decoders on the host: the reports of ../reports.h mutated byte by byte, cut,
+// spliced and fed in chunks of random size, each input in a heap block of its exact size. Run under
+// AddressSanitizer and UBSan by pio test -e native, a read past an input or a table is a test failure.
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+
+#include "../bench.h"
+#include "../reports.h"
+#include "metar.h"
+#include "taf.h"
+
+#define METAR_COUNT (sizeof(metarReports) / sizeof(metarReports[0]))
+#define MUTATIONS 20000       // Inputs per decoder, a few seconds under the sanitizers
+#define MAX_INPUT 2048
+#define TAF_STATIONS 4
+
+// Bytes the decoders look for, so mutations keep reaching deep into the groups
+static const char alphabet[] = "0123456789/ \n=+-ABCDEFGKLMNOPRSTUVZ";
+
+static char input[MAX_INPUT];
+static Forecast forecasts[TAF_STATIONS];
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Change the input in place: overwrite, insert or delete bytes, repeat a part, cut the end
+static size_t mutate(char *data, size_t len, BenchRandom &random) {
+  int steps = random.range(1, 6);
+  for (int step = 0; step < steps; step++) {
+    size_t at = len ? random.range(0, len) : 0;
+    switch (random.next() % 6) {
+      case 0:
+      case 1:
+        if (len) data[at] = random.next() % 4 ? alphabet[random.next() % (sizeof(alphabet) - 1)] : (char)random.range(1, 256);
+        break;
+      case 2:
+        if (len < MAX_INPUT - 1) {
+          memmove(data + at + 1, data + at, len - at);
+          data[at] = alphabet[random.next() % (sizeof(alphabet) - 1)];
+          len++;
+        }
+        break;
+      case 3:
+        if (len) {
+          size_t count = random.range(1, 16);
+          if (count > len - at) count = len - at;
+          memmove(data + at, data + at + count, len - at - count);
+          len -= count;
+        }
+        break;
+      case 4: {
+        size_t count = random.range(1, 64);
+        if (count > len - at) count = len - at;
+        if (len + count < MAX_INPUT - 1) {
+          memmove(data + at + count, data + at, len - at);
+          len += count;
+        }
+        break;
+      }
+      default:
+        len = at;
+        break;
+    }
+  }
+  return len;
+}
+
+// A copy in its own heap block, without the terminator if the decoder takes a length
+static char *exactCopy(const char *data, size_t len, bool terminate) {
+  char *copy = (char *)malloc(len + terminate);
+  memcpy(copy, data, len);
+  if (terminate) copy[len] = '\0';
+  return copy;
+}
+
+static bool checkObservation(const MetarObservation &obs) {
+  if (obs.weatherCount > METAR_MAX_WEATHER || obs.cloudCount > METAR_MAX_CLOUDS) return false;
+  if (obs.category < FLIGHT_UNKNOWN || obs.category > FLIGHT_LIFR) return false;
+  for (int i = 0; i < obs.weatherCount; i++)
+    if (!memchr(obs.weather[i], '\0', sizeof(obs.weather[i]))) return false;
+  return true;
+}
+
+static void test_metar_mutations() {
+  BenchRandom random;
+  int bad = 0;
+  char text[64];
+  for (int i = 0; i < MUTATIONS; i++) {
+    const char *seed = metarReports[random.next() % METAR_COUNT];
+    size_t len = strlen(seed);
+    memcpy(input, seed, len);
+    len = mutate(input, len, random);
+    char *report = exactCopy(input, len, true);
+    MetarObservation obs;
+    decodeMetar(report, obs);
+    if (!checkObservation(obs)) bad++;
+    // Every buffer size down to 1, the text is always terminated
+    size_t size = random.range(1, sizeof(text));
+    formatMetarConditions(obs, text, size);
+    if (!memchr(text, '\0', size)) bad++;
+    flightCategoryName(obs.category);
+    free(report);
+  }
+  TEST_ASSERT_EQUAL(0, bad);
+}
+
+// Single groups without a terminator, the group decoder must stay within the length it is given
+static void test_metar_groups() {
+  BenchRandom random;
+  int bad = 0;
+  for (int i = 0; i < MUTATIONS; i++) {
+    size_t len = random.range(1, 24);
+    for (size_t j = 0; j < len; j++) input[j] = alphabet[random.next() % (sizeof(alphabet) - 1)];
+    char *group = exactCopy(input, len, false);
+    MetarObservation obs;
+    int wholeMiles = random.next() % 4 ? 0 : random.range(1, 10);
+    decodeMetarGroup(group, len, obs, wholeMiles);
+    finishMetarObservation(obs);
+    if (!checkObservation(obs)) bad++;
+    free(group);
+  }
+  TEST_ASSERT_EQUAL(0, bad);
+}
+
+// Every station gets a table, so the mutated reports are decoded and not skipped
+static Forecast *lookupForecast(const char *icaoId, void *context) {
+  unsigned *next = (unsigned *)context;
+  return &forecasts[(*next)++ % TAF_STATIONS];
+}
+
+static void test_taf_mutations() {
+  BenchRandom random;
+  int bad = 0;
+  char text[48];
+  for (int i = 0; i < MUTATIONS / 10; i++) {
+    size_t len = sizeof(tafResponse) - 1;
+    memcpy(input, tafResponse, len);
+    len = mutate(input, len, random);
+    char *response = exactCopy(input, len, false);
+    unsigned next = 0;
+    TafDecoder decoder;
+    tafDecoderBegin(decoder, lookupForecast, &next, REPORTS_UTC);
+    for (size_t offset = 0; offset < len;) {
+      size_t chunk = random.range(1, 200);
+      if (chunk > len - offset) chunk = len - offset;
+      // The chunk in its own block, like the buffer of a stream read
+      char *part = exactCopy(response + offset, chunk, false);
+      tafDecoderFeed(decoder, part, chunk);
+      free(part);
+      offset += chunk;
+    }
+    tafDecoderEnd(decoder);
+    for (int station = 0; station < TAF_STATIONS; station++) {
+      const Forecast &forecast = forecasts[station];
+      if (forecast.periodCount > TAF_MAX_PERIODS) bad++;
+      for (int p = 0; p < forecast.periodCount; p++)
+        if (forecast.periods[p].change > FORECAST_PROB || !memchr(forecast.periods[p].weather, '\0', sizeof(forecast.periods[p].weather))) bad++;
+      size_t size = random.range(1, sizeof(text));
+      formatForecastChange(forecast, REPORTS_UTC + random.range(-86400, 2 * 86400), text, size);
+      if (!memchr(text, '\0', size)) bad++;
+    }
+    free(response);
+  }
+  TEST_ASSERT_EQUAL(0, bad);
+}
+
+// Random bytes, not derived from a report
+static void test_taf_noise() {
+  BenchRandom random;
+  unsigned next = 0;
+  TafDecoder decoder;
+  tafDecoderBegin(decoder, lookupForecast, &next, REPORTS_UTC);
+  for (int i = 0; i < MUTATIONS; i++) {
+    size_t len = random.range(1, 64);
+    for (size_t j = 0; j < len; j++) input[j] = random.next() % 8 ? alphabet[random.next() % (sizeof(alphabet) - 1)] : (char)random.next();
+    char *part = exactCopy(input, len, false);
+    tafDecoderFeed(decoder, part, len);
+    free(part);
+  }
+  tafDecoderEnd(decoder);
+  for (int station = 0; station < TAF_STATIONS; station++) TEST_ASSERT_LESS_OR_EQUAL(TAF_MAX_PERIODS, forecasts[station].periodCount);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_metar_mutations);
+  RUN_TEST(test_metar_groups);
+  RUN_TEST(test_taf_mutations);
+  RUN_TEST(test_taf_noise);
+  return UNITY_END();
+}
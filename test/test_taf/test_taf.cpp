@@ -0,0 +1,179 @@
+// Streaming TAF decoder: the response of ../reports.h decoded whole and cut into chunks at every position must give
+// the same tables, and megabytes of oversized reports must not grow the memory beyond the decoder and the tables.
+#include <string.h>
+#include <unity.h>
+
+#include "../bench.h"
+#include "../reports.h"
+#include "taf.h"
+
+#if BENCH_ASAN
+extern "C" size_t __sanitizer_get_current_allocated_bytes(void);  // sanitizer/allocator_interface.h, not shipped with every gcc
+#endif
+
+#define STATION_COUNT 7
+
+static const char *stationIds[STATION_COUNT] = {"EDDM", "KJFK", "EGLL", "LSZH", "EHAM", "EDDF", "KDEN"};
+static Forecast forecasts[STATION_COUNT];
+static Forecast expected[STATION_COUNT];
+
+// Heap in use, bytes under AddressSanitizer and the allocation count with the counting malloc of bench.h
+static unsigned long heapInUse() {
+#if BENCH_ASAN
+  return __sanitizer_get_current_allocated_bytes();
+#else
+  return benchAllocations;
+#endif
+}
+
+static Forecast *lookupForecast(const char *icaoId, void *context) {
+  for (int i = 0; i < STATION_COUNT; i++)
+    if (strcmp(icaoId, stationIds[i]) == 0) return &forecasts[i];
+  return nullptr;
+}
+
+static bool samePeriod(const ForecastPeriod &a, const ForecastPeriod &b) {
+  return a.change == b.change && a.probability == b.probability && a.tempo == b.tempo && a.category == b.category &&
+         a.from == b.from && a.to == b.to && a.windDir == b.windDir && a.windSpeedKt == b.windSpeedKt &&
+         a.windGustKt == b.windGustKt && a.visibilityM == b.visibilityM && a.ceilingFt == b.ceilingFt &&
+         strcmp(a.weather, b.weather) == 0;
+}
+
+static bool sameForecast(const Forecast &a, const Forecast &b) {
+  if (a.issued != b.issued || a.validFrom != b.validFrom || a.validTo != b.validTo || a.periodCount != b.periodCount ||
+      a.droppedPeriods != b.droppedPeriods)
+    return false;
+  for (int i = 0; i < a.periodCount; i++)
+    if (!samePeriod(a.periods[i], b.periods[i])) return false;
+  return true;
+}
+
+static void decode(const char *data, size_t len, size_t firstChunk, size_t chunk) {
+  for (int i = 0; i < STATION_COUNT; i++) forecasts[i] = Forecast();
+  TafDecoder decoder;
+  tafDecoderBegin(decoder, lookupForecast, nullptr, REPORTS_UTC);
+  size_t offset = firstChunk < len ? firstChunk : len;
+  tafDecoderFeed(decoder, data, offset);
+  while (offset < len) {
+    size_t part = chunk < len - offset ? chunk : len - offset;
+    tafDecoderFeed(decoder, data + offset, part);
+    offset += part;
+  }
+  tafDecoderEnd(decoder);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_response_is_decoded() {
+  decode(tafResponse, sizeof(tafResponse) - 1, sizeof(tafResponse), 1);
+  const Forecast &eddm = forecasts[0];
+  TEST_ASSERT_EQUAL(REPORTS_UTC - 7200, eddm.issued);  // 101100Z
+  TEST_ASSERT_EQUAL(REPORTS_UTC - 3600, eddm.validFrom);
+  TEST_ASSERT_EQUAL(REPORTS_UTC + 29 * 3600, eddm.validTo);
+  TEST_ASSERT_EQUAL(TAF_MAX_PERIODS < 5 ? TAF_MAX_PERIODS : 5, eddm.periodCount);
+  TEST_ASSERT_EQUAL(TAF_MAX_PERIODS < 5 ? 5 - TAF_MAX_PERIODS : 0, eddm.droppedPeriods);
+  TEST_ASSERT_EQUAL(FORECAST_BASE, eddm.periods[0].change);
+  TEST_ASSERT_EQUAL(FLIGHT_VFR, eddm.periods[0].category);
+  TEST_ASSERT_EQUAL(240, eddm.periods[0].windDir);
+  TEST_ASSERT_EQUAL(FORECAST_BECMG, eddm.periods[1].change);
+  TEST_ASSERT_EQUAL(25, eddm.periods[1].windGustKt);
+  TEST_ASSERT_EQUAL(FORECAST_PROB, eddm.periods[2].change);
+  TEST_ASSERT_EQUAL(30, eddm.periods[2].probability);
+  TEST_ASSERT_TRUE(eddm.periods[2].tempo);
+  TEST_ASSERT_EQUAL_STRING("TSRA", eddm.periods[2].weather);
+  TEST_ASSERT_EQUAL(FORECAST_FM, eddm.periods[3].change);
+  TEST_ASSERT_EQUAL(REPORTS_UTC + 13 * 3600, eddm.periods[3].from);
+  TEST_ASSERT_EQUAL(FLIGHT_IFR, eddm.periods[3].category);
+  TEST_ASSERT_EQUAL(eddm.periods[3].from, eddm.periods[0].to);  // The FM group ends the base period
+  TEST_ASSERT_EQUAL(FLIGHT_VFR, forecasts[3].periods[0].category);  // LSZH CAVOK
+  TEST_ASSERT_EQUAL(0, forecasts[4].periodCount);                   // EHAM NIL
+  TEST_ASSERT_EQUAL(0, forecasts[5].periodCount);                   // EDDF CNL
+  TEST_ASSERT_EQUAL(TAF_MAX_PERIODS < 6 ? TAF_MAX_PERIODS : 6, forecasts[6].periodCount);  // KDEN on one line
+}
+
+// Every split into two chunks and every chunk size up to 64 bytes give the tables of the whole response
+static void test_split_chunks_match_whole_response() {
+  size_t len = sizeof(tafResponse) - 1;
+  decode(tafResponse, len, len, 1);
+  memcpy(expected, forecasts, sizeof(expected));
+  int wrong = 0;
+  for (size_t split = 0; split <= len; split++) {
+    decode(tafResponse, len, split, len);
+    for (int i = 0; i < STATION_COUNT; i++)
+      if (!sameForecast(forecasts[i], expected[i])) wrong++;
+  }
+  for (size_t chunk = 1; chunk <= 64; chunk++) {
+    decode(tafResponse, len, chunk, chunk);
+    for (int i = 0; i < STATION_COUNT; i++)
+      if (!sameForecast(forecasts[i], expected[i])) wrong++;
+  }
+  TEST_ASSERT_EQUAL(0, wrong);
+}
+
+// Writes text into the decoder through a 64 byte buffer, like fetchForecasts reads the body
+struct ChunkStream {
+  TafDecoder &decoder;
+  char chunk[64];
+  size_t len = 0;
+  unsigned long total = 0;
+  explicit ChunkStream(TafDecoder &decoder) : decoder(decoder) {}
+  void write(const char *text) {
+    while (*text) {
+      chunk[len++] = *text++;
+      if (len == sizeof(chunk)) flush();
+    }
+  }
+  void flush() {
+    tafDecoderFeed(decoder, chunk, len);
+    total += len;
+    len = 0;
+  }
+};
+
+// Megabytes of oversized reports: thousands of change groups, a group of 100 KB and many stations without a table.
+// The heap must not grow while they go through, the tables stay full and count what they dropped.
+static void test_oversized_stream_stays_bounded() {
+  TEST_ASSERT_LESS_OR_EQUAL(TAF_DECODER_MAX_BYTES, sizeof(TafDecoder));
+  for (int i = 0; i < STATION_COUNT; i++) forecasts[i] = Forecast();
+  TafDecoder decoder;
+  tafDecoderBegin(decoder, lookupForecast, nullptr, REPORTS_UTC);
+  ChunkStream stream(decoder);
+  char group[48];
+  unsigned long heapBefore = heapInUse();
+
+  stream.write("TAF EDDM 101100Z 1012/1118 24010KT 9999 FEW040\n");
+  for (int i = 0; i < 5000; i++) {
+    snprintf(group, sizeof(group), " FM1%02d%02d00 %03d%02dKT 9999 SCT0%02d\n", 12 + i / 600 % 12, i % 60, i % 36 * 10,
+             i % 30, 10 + i % 80);
+    stream.write(group);
+    stream.write(" TEMPO 1014/1016 4000 -SHRA BKN012 PROB30 1015/1017 TSRA\n");
+  }
+  for (int i = 0; i < 100000; i++) stream.write("X");
+  stream.write("=\n\n");
+  for (int i = 0; i < 20000; i++) {
+    snprintf(group, sizeof(group), "TAF K%03d 101100Z 1012/1118 ", i % 1000);
+    stream.write(group);
+    stream.write("18012KT P6SM FEW045 SCT250 FM101900 20015G25KT P6SM SCT035 BKN250\n\n");
+  }
+  stream.write("TAF LSZH 101100Z 1012/1118 VRB03KT CAVOK=\n");
+  stream.flush();
+  tafDecoderEnd(decoder);
+
+  TEST_ASSERT_EQUAL(heapBefore, heapInUse());
+  TEST_ASSERT_GREATER_THAN(2000000UL, stream.total);
+  TEST_ASSERT_EQUAL(TAF_MAX_PERIODS, forecasts[0].periodCount);
+  TEST_ASSERT_EQUAL(255, forecasts[0].droppedPeriods);  // Saturated, not wrapped
+  TEST_ASSERT_EQUAL(1, decoder.droppedGroups);
+  TEST_ASSERT_EQUAL(2, decoder.reports);
+  TEST_ASSERT_EQUAL(1, forecasts[3].periodCount);
+  TEST_ASSERT_EQUAL(FLIGHT_VFR, forecasts[3].periods[0].category);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_response_is_decoded);
+  RUN_TEST(test_split_chunks_match_whole_response);
+  RUN_TEST(test_oversized_stream_stays_bounded);
+  return UNITY_END();
+}
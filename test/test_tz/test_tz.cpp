@@ -0,0 +1,154 @@
+// Offline timezone lookup against the tz database of the host: for a corpus of airports the offset from the
+// generated tables has to match localtime() in the airport's zone every hour of 2024 to 2026.
+// Needs the zoneinfo files (/usr/share/zoneinfo), the suite is skipped without them.
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <unity.h>
+
+#include "calc.h"
+#include "tz.h"
+
+struct Airport {
+  const char *icao;
+  float lat, lon;
+  const char *zone;
+};
+
+// The tables are a 0.5 degree grid. Built without boundary polygons, a cell goes to the nearest zone.tab city, which
+// gets places near a border wrong when the neighbour has another rule (see tools/gen_tz_tables.py). The last ones
+// are close to a border and pass with the grid as committed.
+static const Airport AIRPORTS[] = {
+    {"EDDF", 50.033f, 8.570f, "Europe/Berlin"},
+    {"EDDM", 48.354f, 11.786f, "Europe/Berlin"},
+    {"EGLL", 51.470f, -0.454f, "Europe/London"},
+    {"EIDW", 53.421f, -6.270f, "Europe/Dublin"},  // Winter is the negative DST of the rule, in the explicit transitions
+    {"LFPG", 49.010f, 2.548f, "Europe/Paris"},
+    {"LEMD", 40.472f, -3.561f, "Europe/Madrid"},
+    {"LIRF", 41.800f, 12.239f, "Europe/Rome"},
+    {"LSZH", 47.465f, 8.549f, "Europe/Zurich"},
+    {"LOWW", 48.110f, 16.570f, "Europe/Vienna"},
+    {"EHAM", 52.309f, 4.764f, "Europe/Amsterdam"},
+    {"EKCH", 55.618f, 12.656f, "Europe/Copenhagen"},
+    {"ESSA", 59.652f, 17.919f, "Europe/Stockholm"},
+    {"EFHK", 60.317f, 24.963f, "Europe/Helsinki"},
+    {"EPWA", 52.166f, 20.967f, "Europe/Warsaw"},
+    {"LPPT", 38.774f, -9.134f, "Europe/Lisbon"},
+    {"LPLA", 38.762f, -27.091f, "Atlantic/Azores"},
+    {"LGAV", 37.936f, 23.947f, "Europe/Athens"},
+    {"LTFM", 41.262f, 28.742f, "Europe/Istanbul"},
+    {"UUEE", 55.973f, 37.415f, "Europe/Moscow"},
+    {"BIKF", 63.985f, -22.606f, "Atlantic/Reykjavik"},
+    {"KJFK", 40.640f, -73.779f, "America/New_York"},
+    {"KORD", 41.979f, -87.905f, "America/Chicago"},
+    {"KDEN", 39.856f, -104.674f, "America/Denver"},
+    {"KPHX", 33.434f, -112.012f, "America/Phoenix"},
+    {"KLAX", 33.943f, -118.408f, "America/Los_Angeles"},
+    {"KSEA", 47.450f, -122.309f, "America/Los_Angeles"},
+    {"PANC", 61.174f, -149.996f, "America/Anchorage"},
+    {"PHNL", 21.319f, -157.922f, "Pacific/Honolulu"},
+    {"CYYZ", 43.677f, -79.631f, "America/Toronto"},
+    {"CYVR", 49.195f, -123.184f, "America/Vancouver"},
+    {"MMMX", 19.436f, -99.072f, "America/Mexico_City"},
+    {"SBGR", -23.432f, -46.470f, "America/Sao_Paulo"},
+    {"SAEZ", -34.822f, -58.536f, "America/Argentina/Buenos_Aires"},
+    {"SCEL", -33.393f, -70.786f, "America/Santiago"},
+    {"SKBO", 4.702f, -74.147f, "America/Bogota"},
+    {"SPJC", -12.022f, -77.114f, "America/Lima"},
+    {"FAOR", -26.139f, 28.246f, "Africa/Johannesburg"},
+    {"HECA", 30.122f, 31.406f, "Africa/Cairo"},
+    {"DNMM", 6.577f, 3.321f, "Africa/Lagos"},
+    {"HKJK", -1.319f, 36.928f, "Africa/Nairobi"},
+    {"GMMN", 33.368f, -7.590f, "Africa/Casablanca"},  // +01 is suspended for Ramadan, only in the explicit transitions
+    {"OMDB", 25.253f, 55.364f, "Asia/Dubai"},
+    {"OERK", 24.958f, 46.699f, "Asia/Riyadh"},
+    {"OIIE", 35.416f, 51.152f, "Asia/Tehran"},
+    {"VIDP", 28.566f, 77.103f, "Asia/Kolkata"},
+    {"VABB", 19.089f, 72.868f, "Asia/Kolkata"},
+    {"VNKT", 27.697f, 85.359f, "Asia/Kathmandu"},
+    {"VTBS", 13.690f, 100.750f, "Asia/Bangkok"},
+    {"WSSS", 1.359f, 103.989f, "Asia/Singapore"},
+    {"WIII", -6.126f, 106.656f, "Asia/Jakarta"},
+    {"ZBAA", 40.080f, 116.585f, "Asia/Shanghai"},
+    {"VHHH", 22.309f, 113.915f, "Asia/Hong_Kong"},
+    {"RKSI", 37.469f, 126.451f, "Asia/Seoul"},
+    {"RJTT", 35.552f, 139.780f, "Asia/Tokyo"},
+    {"RPLL", 14.509f, 121.020f, "Asia/Manila"},
+    {"YSSY", -33.946f, 151.177f, "Australia/Sydney"},
+    {"YMML", -37.673f, 144.843f, "Australia/Melbourne"},
+    {"YBBN", -27.384f, 153.117f, "Australia/Brisbane"},
+    {"YPAD", -34.945f, 138.531f, "Australia/Adelaide"},
+    {"YPDN", -12.415f, 130.877f, "Australia/Darwin"},
+    {"YPPH", -31.940f, 115.967f, "Australia/Perth"},
+    {"NZAA", -37.008f, 174.792f, "Pacific/Auckland"},
+    {"NFFN", -17.755f, 177.443f, "Pacific/Fiji"},
+    {"EDNY", 47.671f, 9.511f, "Europe/Berlin"},
+    {"ENKR", 69.726f, 29.891f, "Europe/Oslo"},
+    {"KELP", 31.807f, -106.378f, "America/Denver"},
+    {"CYXY", 60.710f, -135.067f, "America/Whitehorse"},
+};
+
+#define HOURS (3 * 365 * 24 + 24)  // 2024-01-01 to 2027-01-01
+
+static unsigned long start2024;
+
+// Offset of zone at utc from the C library
+static long zoneOffset(time_t utc) {
+  struct tm local;
+  localtime_r(&utc, &local);
+  return local.tm_gmtoff;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_airports_match_tzdata() {
+  int mismatchedAirports = 0;
+  for (const Airport &airport : AIRPORTS) {
+    setenv("TZ", airport.zone, 1);
+    tzset();
+    int mismatches = 0;
+    unsigned long firstMismatch = 0;
+    long expectedAtFirst = 0, offsetAtFirst = 0;
+    for (unsigned long hour = 0; hour < HOURS; hour++) {
+      unsigned long utc = start2024 + hour * 3600;
+      long offset;
+      TEST_ASSERT_TRUE(offlineUtcOffset(airport.lat, airport.lon, utc, offset));
+      long expected = zoneOffset(utc);
+      if (offset != expected && mismatches++ == 0) {
+        firstMismatch = utc;
+        expectedAtFirst = expected;
+        offsetAtFirst = offset;
+      }
+    }
+    if (mismatches) {
+      mismatchedAirports++;
+      printf("%s %s: %d of %d hours differ, first at %lu: %ld s instead of %ld s\n", airport.icao, airport.zone,
+             mismatches, HOURS, firstMismatch, offsetAtFirst, expectedAtFirst);
+    }
+  }
+  unsetenv("TZ");
+  tzset();
+  TEST_ASSERT_EQUAL(0, mismatchedAirports);
+}
+
+// Outside the valid range there is no offset
+static void test_invalid_position() {
+  long offset;
+  TEST_ASSERT_FALSE(offlineUtcOffset(91, 0, start2024, offset));
+  TEST_ASSERT_FALSE(offlineUtcOffset(0, -181, start2024, offset));
+  TEST_ASSERT_FALSE(offlineUtcOffset(NAN, 0, start2024, offset));
+}
+
+int main(int argc, char **argv) {
+  start2024 = daysFromCivil(2024, 1, 1) * 86400UL;
+  UNITY_BEGIN();
+  if (access("/usr/share/zoneinfo/Europe/Berlin", R_OK) == 0)
+    RUN_TEST(test_airports_match_tzdata);
+  else
+    TEST_MESSAGE("No tz database at /usr/share/zoneinfo, comparison skipped");
+  RUN_TEST(test_invalid_position);
+  return UNITY_END();
+}
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""Generate the glyph subset fonts in src/fonts/ with lv_font_conv.
+
+The big clock only ever shows digits, ':' and '.' (getFormattedTime/getFormattedDate) and '-' while
+there is no time yet, so its fonts hold just these glyphs instead of the full Montserrat range.
+Airport names are transliterated to ASCII (normalizeString), their font is the printable ASCII range
+plus the home icon, compressed because it is only drawn when the station changes.
+
+Needs lv_font_conv 1.5.2 (npm i -g lv_font_conv@1.5.2, or npx) and the TTF files shipped with
+LVGL 9.1.0, which are looked up in .pio/libdeps/<env>/lvgl/scripts/built_in_font. Another converter version
+produces other bitmaps, so the generated files are meant to be committed once and only regenerated on purpose.
+Build with -D UI_SUBSET_FONTS to use them.
+
+    python3 tools/gen_fonts.py [--fonts DIR] [-o src/fonts]
+or  pio run -t fonts
+"""
+
+import argparse
+import glob
+import os
+import shutil
+import subprocess
+import sys
+
+PROJECT_DIR = os.path.normpath(os.path.join(os.path.dirname(__file__), ".."))
+
+LV_FONT_CONV_VERSION = "1.5.2"
+CLOCK_SYMBOLS = "0123456789:.-"
+HOME_ICON = "0xF015"  # LV_SYMBOL_HOME in FontAwesome
+
+# name, size, bpp, compressed, [(font file, --symbols or --range value, is range)]
+FONTS = [
+    ("font_clock_48", 48, 4, False, [("Montserrat-Medium.ttf", CLOCK_SYMBOLS, False)]),
+    ("font_clock_24", 24, 4, False, [("Montserrat-Medium.ttf", CLOCK_SYMBOLS, False)]),
+    ("font_airport_14", 14, 4, True, [("Montserrat-Medium.ttf", "0x20-0x7E", True),
+                                      ("FontAwesome5-Solid+Brands+Regular.woff", HOME_ICON, True)]),
+]
+
+
+def find_font_dir():
+    paths = sorted(glob.glob(os.path.join(PROJECT_DIR, ".pio", "libdeps", "*", "lvgl", "scripts", "built_in_font")))
+    return paths[0] if paths else None
+
+
+def converter():
+    if shutil.which("lv_font_conv"):
+        version = subprocess.run(["lv_font_conv", "--version"], capture_output=True, text=True).stdout.strip()
+        if version == LV_FONT_CONV_VERSION:
+            return ["lv_font_conv"]
+        print(f"lv_font_conv {version or 'of unknown version'} installed, using {LV_FONT_CONV_VERSION} through npx")
+    if shutil.which("npx"):
+        return ["npx", "--yes", "lv_font_conv@" + LV_FONT_CONV_VERSION]
+    sys.exit(f"lv_font_conv {LV_FONT_CONV_VERSION} not found, install it with: npm i -g lv_font_conv@{LV_FONT_CONV_VERSION}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--fonts", help="directory with Montserrat-Medium.ttf and the FontAwesome woff")
+    parser.add_argument("-o", "--output", default=os.path.join(PROJECT_DIR, "src", "fonts"))
+    args = parser.parse_args()
+
+    font_dir = args.fonts or find_font_dir()
+    if not font_dir:
+        sys.exit("LVGL font sources not found, run a build first or pass --fonts")
+    os.makedirs(args.output, exist_ok=True)
+    tool = converter()
+    for name, size, bpp, compressed, sources in FONTS:
+        cmd = tool + ["--size", str(size), "--bpp", str(bpp), "--format", "lvgl", "--lv-font-name", name,
+                      "-o", os.path.join(args.output, name + ".c")]
+        if not compressed:
+            cmd.append("--no-compress")
+        for font_file, glyphs, is_range in sources:
+            cmd += ["--font", os.path.join(font_dir, font_file), "--range" if is_range else "--symbols", glyphs]
+        print(" ".join(cmd))
+        subprocess.run(cmd, check=True)
+        print(f"{name}: {os.path.getsize(os.path.join(args.output, name + '.c'))} bytes of C source")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,329 @@
+#!/usr/bin/env python3
+"""Generate src/tz_tables.h, the offline lat/lon to UTC offset tables.
+
+The rules come from the POSIX TZ footer of the compiled tz database (/usr/share/zoneinfo).
+Zones whose explicit transitions do not follow their footer (Africa/Casablanca suspends +01
+for Ramadan) also get those transitions from TRANSITIONS_FROM to TRANSITIONS_TO.
+
+The zone grid is rasterized from timezone-boundary-builder polygons when --boundaries is
+given (https://github.com/evansiroky/timezone-boundary-builder, combined.json), otherwise
+every cell is assigned to the nearest zone reference location of zone.tab. The nearest
+location grid is wrong near borders between zones of different rules: a cell goes to the
+closer reference city, not to the country it lies in, so a place up to half the distance
+between two reference cities away from the border can get the neighbour's offset. Polygons
+leave only the 0.5 degree cell, up to about 35 km from a border.
+
+    python3 tools/gen_tz_tables.py [--zoneinfo DIR] [--boundaries combined.json] [-o src/tz_tables.h]
+or  pio run -t tztables
+"""
+
+import argparse
+import datetime
+import json
+import math
+import os
+import re
+import struct
+
+CELL_DEG = 0.5
+ROWS = int(180 / CELL_DEG)
+COLS = int(360 / CELL_DEG)
+TRANSITIONS_FROM = 1704067200  # 2024-01-01, explicit transitions kept from here
+TRANSITIONS_TO = 2524608000    # 2050-01-01, and the footer rule after this
+
+
+def read_posix_tz(zoneinfo, zone):
+    """Last line of a TZif v2+ file is the POSIX TZ string used after the last transition."""
+    with open(os.path.join(zoneinfo, zone), "rb") as f:
+        data = f.read()
+    if not data.startswith(b"TZif") or data[4:5] < b"2":
+        return None
+    footer = data.rstrip(b"\n").rsplit(b"\n", 1)[-1]
+    return footer.decode("ascii")
+
+
+def read_transitions(zoneinfo, zone):
+    """Explicit transitions of the v2 data block of a TZif file as (utc, offset) pairs."""
+    with open(os.path.join(zoneinfo, zone), "rb") as f:
+        data = f.read()
+    if not data.startswith(b"TZif") or data[4:5] < b"2":
+        return []
+    isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt = struct.unpack(">6l", data[20:44])
+    pos = 44 + timecnt * 5 + typecnt * 6 + charcnt + leapcnt * 8 + isstdcnt + isutcnt  # Skip the v1 block
+    isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt = struct.unpack(">6l", data[pos + 20:pos + 44])
+    pos += 44
+    times = struct.unpack(f">{timecnt}q", data[pos:pos + timecnt * 8])
+    types = data[pos + timecnt * 8:pos + timecnt * 9]
+    pos += timecnt * 9
+    offsets = [struct.unpack(">lBB", data[pos + i * 6:pos + i * 6 + 6])[0] for i in range(typecnt)]
+    return [(t, offsets[i]) for t, i in zip(times, types)]
+
+
+def transition_utc(year, month, week, wday, time_of_day, utc_offset):
+    """Same as transitionUtc() in src/tz.cpp."""
+    first = (datetime.date(year, month, 1) - datetime.date(1970, 1, 1)).days
+    day = 1 + (wday - (first + 4) % 7 + 7) % 7 + 7 * (week - 1)
+    length = ((datetime.date(year + (month == 12), month % 12 + 1, 1) - datetime.date(1970, 1, 1)).days) - first
+    while day > length:
+        day -= 7
+    return (first + day - 1) * 86400 + time_of_day - utc_offset
+
+
+def rule_offset(rule, utc):
+    """Offset of a parsed footer rule at utc, as offlineUtcOffset() computes it."""
+    std, dst, sm, sw, sd, st, em, ew, ed, et = rule
+    if sm == 0:
+        return std
+    year = datetime.datetime.fromtimestamp(utc, datetime.timezone.utc).year
+    start = transition_utc(year, sm, sw, sd, st, std)
+    end = transition_utc(year, em, ew, ed, et, dst)
+    in_dst = start <= utc < end if start < end else utc >= start or utc < end
+    return dst if in_dst else std
+
+
+def off_rule_transitions(zoneinfo, zone, rule):
+    """Transitions in the kept range if any of them disagrees with the footer rule, else none."""
+    kept = [(t, o) for t, o in read_transitions(zoneinfo, zone) if TRANSITIONS_FROM <= t < TRANSITIONS_TO]
+    if all(rule_offset(rule, t) == o for t, o in kept):
+        return ()
+    return tuple(kept)
+
+
+def parse_offset(text):
+    """POSIX offsets are hours west of UTC ("-1" is UTC+1), return seconds east of UTC."""
+    sign = -1 if text.startswith("-") else 1
+    parts = [int(p) for p in text.lstrip("+-").split(":")]
+    seconds = parts[0] * 3600 + (parts[1] * 60 if len(parts) > 1 else 0) + (parts[2] if len(parts) > 2 else 0)
+    return -sign * seconds
+
+
+def parse_time(text):
+    """Transition time of day in seconds, may be negative or beyond 24 h."""
+    if text is None:
+        return 7200
+    sign = -1 if text.startswith("-") else 1
+    parts = [int(p) for p in text.lstrip("+-").split(":")]
+    return sign * (parts[0] * 3600 + (parts[1] * 60 if len(parts) > 1 else 0) + (parts[2] if len(parts) > 2 else 0))
+
+
+NAME = r"(?:<[^>]+>|[A-Za-z]+)"
+OFFSET = r"[+-]?\d+(?::\d+){0,2}"
+RULE = re.compile(rf"^{NAME}({OFFSET})(?:{NAME}({OFFSET})?(?:,M(\d+)\.(\d)\.(\d)(?:/({OFFSET}))?,M(\d+)\.(\d)\.(\d)(?:/({OFFSET}))?)?)?$")
+
+
+def parse_rule(posix):
+    """Returns (stdOffset, dstOffset, startMonth, startWeek, startWday, startTime, endMonth, endWeek, endWday, endTime)."""
+    m = RULE.match(posix)
+    if not m:
+        raise ValueError(f"unsupported POSIX TZ string {posix!r}")
+    std = parse_offset(m.group(1))
+    if m.group(3) is None:
+        return (std, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+    dst = parse_offset(m.group(2)) if m.group(2) else std + 3600
+    return (std, dst, int(m.group(3)), int(m.group(4)), int(m.group(5)), parse_time(m.group(6)),
+            int(m.group(7)), int(m.group(8)), int(m.group(9)), parse_time(m.group(10)))
+
+
+def parse_iso6709(text):
+    """zone.tab coordinates: +DDMM+DDDMM or +DDMMSS+DDDMMSS."""
+    m = re.match(r"([+-]\d{4,6})([+-]\d{5,7})$", text)
+
+    def conv(s, deg_digits):
+        sign = -1 if s[0] == "-" else 1
+        s = s[1:]
+        d, mi, se = int(s[:deg_digits]), int(s[deg_digits:deg_digits + 2]), int(s[deg_digits + 2:] or 0)
+        return sign * (d + mi / 60 + se / 3600)
+
+    return conv(m.group(1), 2), conv(m.group(2), 3)
+
+
+# Extra reference locations for large single-zone countries whose only zone.tab entry sits far
+# from their borders, so the nearest-location grid does not hand their cities to a neighbour zone
+EXTRA_LOCATIONS = [
+    ("Asia/Kolkata", 19.08, 72.88), ("Asia/Kolkata", 28.61, 77.21), ("Asia/Kolkata", 13.08, 80.27),
+    ("Asia/Kolkata", 12.97, 77.59), ("Asia/Kolkata", 23.02, 72.57), ("Asia/Kolkata", 31.63, 74.87),
+    ("Asia/Kolkata", 26.14, 91.74), ("Asia/Kolkata", 8.52, 76.94),
+    ("Asia/Shanghai", 39.90, 116.40), ("Asia/Shanghai", 23.13, 113.26), ("Asia/Shanghai", 30.57, 104.07),
+    ("Asia/Shanghai", 25.04, 102.71), ("Asia/Shanghai", 29.65, 91.10), ("Asia/Shanghai", 45.80, 126.53),
+    ("Asia/Shanghai", 36.06, 103.83),
+    ("Asia/Tehran", 36.30, 59.60), ("Asia/Tehran", 29.59, 52.58), ("Asia/Tehran", 38.08, 46.29),
+    ("Asia/Tehran", 29.50, 60.86),
+]
+
+
+def read_zone_tab(zoneinfo):
+    zones = list(EXTRA_LOCATIONS)
+    with open(os.path.join(zoneinfo, "zone.tab"), encoding="utf-8") as f:
+        for line in f:
+            if line.startswith("#") or not line.strip():
+                continue
+            cols = line.rstrip("\n").split("\t")
+            lat, lon = parse_iso6709(cols[1])
+            zones.append((cols[2], lat, lon))
+    return zones
+
+
+def cell_center(row, col):
+    return -90 + (row + 0.5) * CELL_DEG, -180 + (col + 0.5) * CELL_DEG
+
+
+def grid_nearest(zones):
+    """Assign every cell to the zone with the closest reference location (great circle)."""
+    pts = [(math.radians(lat), math.radians(lon)) for _, lat, lon in zones]
+    sin_lat = [math.sin(p[0]) for p in pts]
+    cos_lat = [math.cos(p[0]) for p in pts]
+    grid = []
+    for row in range(ROWS):
+        lat, _ = cell_center(row, 0)
+        slat, clat = math.sin(math.radians(lat)), math.cos(math.radians(lat))
+        row_cells = []
+        for col in range(COLS):
+            lon = math.radians(cell_center(row, col)[1])
+            best, best_cos = 0, -2.0
+            for i, (_, plon) in enumerate(pts):
+                c = slat * sin_lat[i] + clat * cos_lat[i] * math.cos(lon - plon)
+                if c > best_cos:
+                    best, best_cos = i, c
+            row_cells.append(zones[best][0])
+        grid.append(row_cells)
+    return grid
+
+
+def point_in_ring(x, y, ring):
+    inside = False
+    j = len(ring) - 1
+    for i in range(len(ring)):
+        xi, yi = ring[i][0], ring[i][1]
+        xj, yj = ring[j][0], ring[j][1]
+        if (yi > y) != (yj > y) and x < (xj - xi) * (y - yi) / (yj - yi) + xi:
+            inside = not inside
+        j = i
+    return inside
+
+
+def grid_boundaries(path, zones):
+    """Rasterize timezone-boundary-builder polygons, cells outside every polygon fall back to the nearest zone."""
+    with open(path, encoding="utf-8") as f:
+        features = json.load(f)["features"]
+    polygons = []
+    for feature in features:
+        geometry = feature["geometry"]
+        for polygon in geometry["coordinates"] if geometry["type"] == "MultiPolygon" else [geometry["coordinates"]]:
+            xs = [p[0] for p in polygon[0]]
+            ys = [p[1] for p in polygon[0]]
+            polygons.append((feature["properties"]["tzid"], min(xs), max(xs), min(ys), max(ys), polygon))
+    grid = grid_nearest(zones)
+    for row in range(ROWS):
+        lat = cell_center(row, 0)[0]
+        candidates = [p for p in polygons if p[3] <= lat <= p[4]]
+        for col in range(COLS):
+            lon = cell_center(row, col)[1]
+            for tzid, x0, x1, _, _, polygon in candidates:
+                if x0 <= lon <= x1 and point_in_ring(lon, lat, polygon[0]) and not any(point_in_ring(lon, lat, h) for h in polygon[1:]):
+                    grid[row][col] = tzid
+                    break
+    return grid
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--zoneinfo", default="/usr/share/zoneinfo")
+    parser.add_argument("--boundaries", help="timezone-boundary-builder GeoJSON (combined.json)")
+    parser.add_argument("-o", "--output", default=os.path.normpath(os.path.join(os.path.dirname(__file__), "..", "src", "tz_tables.h")))
+    args = parser.parse_args()
+
+    zones = read_zone_tab(args.zoneinfo)
+    grid = grid_boundaries(args.boundaries, zones) if args.boundaries else grid_nearest(zones)
+
+    # Zones sharing a rule and transitions are merged, the grid stores rule indices directly
+    rules, rule_index, zone_rule = [], {}, {}
+    for tzid in sorted({z for row in grid for z in row}):
+        posix = read_posix_tz(args.zoneinfo, tzid)
+        rule = parse_rule(posix) if posix else (0,) * 10
+        key = (rule, off_rule_transitions(args.zoneinfo, tzid, rule))
+        if key not in rule_index:
+            rule_index[key] = len(rules)
+            rules.append((key, posix))
+        zone_rule[tzid] = rule_index[key]
+    transitions = []
+    rule_transitions = []
+    for (rule, kept), _ in rules:
+        rule_transitions.append((len(transitions) if kept else 0, len(kept)))
+        transitions.extend(kept)
+
+    runs, row_start = [], []
+    for row in grid:
+        row_start.append(len(runs))
+        for col, tzid in enumerate(row):
+            rule = zone_rule[tzid]
+            if col and runs[-1][1] == rule:
+                runs[-1][0] = col + 1
+            else:
+                runs.append([col + 1, rule])
+    row_start.append(len(runs))
+
+    source = os.path.basename(args.boundaries) if args.boundaries else "nearest zone.tab location"
+    out = []
+    out.append("// Generated by tools/gen_tz_tables.py, do not edit. Regenerate with: pio run -t tztables")
+    out.append(f"// Grid source: {source}, {CELL_DEG} deg cells, {len(rules)} rules, {len(transitions)} transitions, {len(runs)} runs")
+    out.append("#pragma once")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append(f"constexpr float TZ_CELL_DEG = {CELL_DEG}f;")
+    out.append(f"constexpr int TZ_ROWS = {ROWS};")
+    out.append(f"constexpr int TZ_COLS = {COLS};")
+    out.append("")
+    out.append("// Offsets in seconds east of UTC, transitions as POSIX Mm.w.d at a local time of day in seconds")
+    out.append("struct TzRule {")
+    out.append("  int32_t stdOffset;")
+    out.append("  int32_t dstOffset;  // May be below stdOffset (Europe/Dublin), even 0")
+    out.append("  uint8_t startMonth, startWeek, startWday;  // startMonth 0: no daylight saving time")
+    out.append("  int32_t startTime;")
+    out.append("  uint8_t endMonth, endWeek, endWday;")
+    out.append("  int32_t endTime;")
+    out.append("  uint16_t firstTransition, transitionCount;  // In TZ_TRANSITIONS, used instead of the rule until the last one")
+    out.append("};")
+    out.append("")
+    out.append("// Explicit transition of a zone that does not follow its rule: offset from utc on")
+    out.append("struct TzTransition {")
+    out.append("  uint32_t utc;")
+    out.append("  int32_t offset;")
+    out.append("};")
+    out.append("")
+    out.append("// Run of cells in a grid row, covering columns up to (excluding) endCol")
+    out.append("struct TzRun {")
+    out.append("  uint16_t endCol;")
+    out.append("  uint16_t rule;")
+    out.append("};")
+    out.append("")
+    out.append(f"constexpr TzRule TZ_RULES[{len(rules)}] = {{")
+    for ((rule, _), posix), (first, count) in zip(rules, rule_transitions):
+        out.append("  {%d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d},  // %s" % (rule + (first, count, posix or "UTC")))
+    out.append("};")
+    out.append("")
+    out.append(f"constexpr TzTransition TZ_TRANSITIONS[{max(len(transitions), 1)}] = {{")
+    for i in range(0, len(transitions), 6):
+        out.append("  " + ", ".join("{%d, %d}" % t for t in transitions[i:i + 6]) + ",")
+    if not transitions:
+        out.append("  {0, 0},")
+    out.append("};")
+    out.append("")
+    index_type = "uint16_t" if len(runs) < 65536 else "uint32_t"
+    out.append(f"constexpr {index_type} TZ_ROW_START[{len(row_start)}] = {{")
+    for i in range(0, len(row_start), 16):
+        out.append("  " + ", ".join(str(v) for v in row_start[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+    out.append(f"constexpr TzRun TZ_RUNS[{len(runs)}] = {{")
+    for i in range(0, len(runs), 8):
+        out.append("  " + ", ".join("{%d, %d}" % tuple(r) for r in runs[i:i + 8]) + ",")
+    out.append("};")
+    with open(args.output, "w", encoding="ascii") as f:
+        f.write("\n".join(out) + "\n")
+    size = len(runs) * 4 + len(row_start) * 2 + len(rules) * 28 + len(transitions) * 8
+    print(f"{args.output}: {len(rules)} rules, {len(transitions)} transitions, {len(runs)} runs, {size} bytes")
+
+
+if __name__ == "__main__":
+    main()
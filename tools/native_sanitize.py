@@ -0,0 +1,4 @@
+# PlatformIO extra script of the native env: link with the sanitizers the sources are compiled with
+Import("env")
+
+env.Append(LINKFLAGS=["-fsanitize=address,undefined"])
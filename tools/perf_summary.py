@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""Summarize a serial capture of the PERF_TELEMETRY CSV lines as percentiles.
+
+The firmware built with -D PERF_TELEMETRY prints one "PERF,..." line per second, the header line
+("PERF,ms,fps,...") is repeated every minute. Everything else in the capture (log lines, monitor
+timestamps in front of the lines) is ignored.
+
+    pio device monitor | tee capture.log
+    python3 tools/perf_summary.py capture.log [--skip 10]
+"""
+
+import argparse
+import sys
+
+PERCENTILES = (50, 90, 99)
+
+
+def percentile(values, p):
+    """Nearest rank percentile of a sorted list."""
+    rank = max(1, -(-p * len(values) // 100))
+    return values[rank - 1]
+
+
+def read_samples(lines):
+    header, samples = None, []
+    for line in lines:
+        pos = line.find("PERF,")
+        if pos < 0:
+            continue
+        fields = line[pos:].strip().split(",")[1:]
+        if fields and fields[0] == "ms":
+            header = fields
+            continue
+        if header is None or len(fields) != len(header):
+            continue
+        try:
+            samples.append([float(f) for f in fields])
+        except ValueError:
+            continue
+    return header, samples
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("capture", nargs="?", help="serial capture, stdin if omitted")
+    parser.add_argument("--skip", type=int, default=0, help="ignore the first N samples (boot, first fetch)")
+    args = parser.parse_args()
+
+    with open(args.capture, errors="replace") if args.capture else sys.stdin as f:
+        header, samples = read_samples(f)
+    samples = samples[args.skip:]
+    if not samples:
+        sys.exit("no PERF samples found")
+
+    print(f"{len(samples)} samples, {(samples[-1][0] - samples[0][0]) / 1000:.0f} s")
+    print(f"{'metric':<14}" + "".join(f"{'p%d' % p:>10}" for p in PERCENTILES) + f"{'max':>10}{'mean':>10}")
+    for column, name in enumerate(header):
+        if name == "ms":
+            continue
+        values = sorted(s[column] for s in samples)
+        row = [percentile(values, p) for p in PERCENTILES] + [values[-1], sum(values) / len(values)]
+        print(f"{name:<14}" + "".join(f"{v:>10.2f}" for v in row))
+
+
+if __name__ == "__main__":
+    main()
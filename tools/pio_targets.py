@@ -0,0 +1,29 @@
+# PlatformIO extra script: custom targets that regenerate the tables compiled into the firmware
+Import("env")
+
+env.AddCustomTarget(
+    name="tztables",
+    dependencies=None,
+    actions=['"$PYTHONEXE" "$PROJECT_DIR/tools/gen_tz_tables.py" -o "$PROJECT_DIR/src/tz_tables.h"'],
+    title="Timezone tables",
+    description="Regenerate src/tz_tables.h from the tz database",
+)
+
+env.AddCustomTarget(
+    name="fonts",
+    dependencies=None,
+    actions=['"$PYTHONEXE" "$PROJECT_DIR/tools/gen_fonts.py" -o "$PROJECT_DIR/src/fonts"'],
+    title="Subset fonts",
+    description="Regenerate the glyph subset fonts in src/fonts with lv_font_conv",
+)
+
+# Smoke test of the simulator environments: the run fails if a scenario draws more than its baseline in
+# test/simulator/<env>.txt or the main screen changed. Delete the file to record a new baseline.
+if env["PIOENV"].startswith("simulator"):
+    env.AddCustomTarget(
+        name="simcheck",
+        dependencies="$BUILD_DIR/${PROGNAME}${PROGSUFFIX}",
+        actions=['mkdir -p "$PROJECT_DIR/test/simulator" && SIM_BASELINE="$PROJECT_DIR/test/simulator/$PIOENV.txt" "$BUILD_DIR/${PROGNAME}${PROGSUFFIX}"'],
+        title="Simulator check",
+        description="Run the simulator scenarios against the recorded baseline",
+    )
@@ -0,0 +1,22 @@
+# PlatformIO extra script: builds with -D UI_SUBSET_FONTS need the generated fonts in src/fonts.
+# Missing fonts are generated with tools/gen_fonts.py, if that is not possible the build stops and says why.
+Import("env")
+
+import os
+import subprocess
+import sys
+
+FONTS = ("font_clock_48", "font_clock_24", "font_airport_14")
+
+if "UI_SUBSET_FONTS" in " ".join(env.GetProjectOption("build_flags", [])):
+    font_dir = os.path.join(env.subst("$PROJECT_SRC_DIR"), "fonts")
+    missing = [name for name in FONTS if not os.path.isfile(os.path.join(font_dir, name + ".c"))]
+    if missing:
+        print("Generating the subset fonts: " + ", ".join(missing))
+        generator = os.path.join(env.subst("$PROJECT_DIR"), "tools", "gen_fonts.py")
+        if subprocess.call([env.subst("$PYTHONEXE"), generator, "-o", font_dir]) != 0:
+            sys.stderr.write(
+                "Error: -D UI_SUBSET_FONTS needs src/fonts/%s.c and they could not be generated.\n"
+                "Install lv_font_conv (npm i -g lv_font_conv) and run `pio run -t fonts`, "
+                "or build without -D UI_SUBSET_FONTS.\n" % ".c, src/fonts/".join(missing))
+            env.Exit(1)